@@ -16,20 +16,125 @@
 // You should have received a copy of the GNU General Public License
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------//
-#include <QCoreApplication>
-#include <QPointer>
-#include "adcircmesh.h"
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AdcircModules.h"
 #include "benchmark/benchmark.h"
 
+//...The build sets the mesh path to the copy in testing/test_files
+#ifndef ADCMOD_BENCH_MESH
+#define ADCMOD_BENCH_MESH "../testing/test_files/ms-riv.grd"
+#endif
+
+static const std::string c_benchMesh = ADCMOD_BENCH_MESH;
+
 static void bench_readmesh(benchmark::State &state) {
-  AdcircMesh *mesh = new AdcircMesh(std::string(
-      "/home/zcobell/Development/QADCModules/testing/test_files/ms-riv.grd"));
+  std::unique_ptr<Adcirc::Geometry::Mesh> mesh(
+      new Adcirc::Geometry::Mesh(c_benchMesh));
   while (state.KeepRunning()) {
     mesh->read();
   }
-  delete mesh;
 }
 
 BENCHMARK(bench_readmesh);
 
-BENCHMARK_MAIN()
+//...Downstream passes over a mesh in file order (0) or after reordering with
+// reverse Cuthill-McKee (1), Hilbert (2), or Morton (3) ordering
+static std::unique_ptr<Adcirc::Geometry::Mesh> reorderedMesh(int strategy) {
+  using namespace Adcirc::Geometry;
+  std::unique_ptr<Mesh> mesh(new Mesh(c_benchMesh));
+  mesh->read();
+  if (strategy == 1) mesh->reorder(ReorderReverseCuthillMcKee);
+  if (strategy == 2) mesh->reorder(ReorderHilbert);
+  if (strategy == 3) mesh->reorder(ReorderMorton);
+  return mesh;
+}
+
+static void bench_reorder_topology(benchmark::State &state) {
+  auto mesh = reorderedMesh(state.range(0));
+  while (state.KeepRunning()) {
+    mesh->topology()->nodeTable()->build();
+    mesh->topology()->elementTable()->build();
+    mesh->topology()->faceTable()->build();
+  }
+}
+
+static void bench_reorder_nearestNode(benchmark::State &state) {
+  auto mesh = reorderedMesh(state.range(0));
+  mesh->buildNodalSearchTree();
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < mesh->numNodes(); ++i) {
+      benchmark::DoNotOptimize(
+          mesh->findNearestNode(mesh->node(i)->x(), mesh->node(i)->y()));
+    }
+  }
+}
+
+static void bench_reorder_gather(benchmark::State &state) {
+  auto mesh = reorderedMesh(state.range(0));
+  std::vector<double> z = mesh->z();
+  while (state.KeepRunning()) {
+    double sum = 0.0;
+    for (size_t i = 0; i < mesh->numElements(); ++i) {
+      auto e = mesh->element(i);
+      for (size_t j = 0; j < e->n(); ++j) {
+        sum += z[mesh->nodeIndexById(e->node(j)->id())];
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(bench_reorder_topology)->DenseRange(0, 3);
+BENCHMARK(bench_reorder_nearestNode)->DenseRange(0, 3);
+BENCHMARK(bench_reorder_gather)->DenseRange(0, 3);
+
+//...Least squares harmonic analysis of 100k nodes over an increasing number of
+// snaps. Memory use is independent of the number of snaps, so the time per
+// snap should stay flat
+static void bench_harmonicsAnalysis(benchmark::State &state) {
+  using namespace Adcirc::Harmonics;
+  const size_t numNodes = 100000;
+  const size_t numSnaps = state.range(0);
+  const std::vector<std::pair<std::string, double>> constituents = {
+      {"M2", 1.405189025e-04}, {"S2", 1.454441043e-04},
+      {"N2", 1.378796995e-04}, {"K1", 7.292115836e-05},
+      {"O1", 6.759774415e-05}};
+
+  std::vector<double> zc(numNodes), zs(numNodes), z(numNodes);
+  for (size_t i = 0; i < numNodes; ++i) {
+    zc[i] = std::cos(1e-4 * static_cast<double>(i));
+    zs[i] = std::sin(1e-4 * static_cast<double>(i));
+  }
+
+  while (state.KeepRunning()) {
+    HarmonicsAnalysis analysis(numNodes);
+    for (const auto &c : constituents) {
+      analysis.addConstituent(c.first, c.second);
+    }
+    for (size_t s = 0; s < numSnaps; ++s) {
+      const double t = 1800.0 * static_cast<double>(s);
+      const double a = std::cos(constituents[0].second * t);
+      const double b = std::sin(constituents[0].second * t);
+      for (size_t i = 0; i < numNodes; ++i) {
+        z[i] = a * zc[i] + b * zs[i];
+      }
+      analysis.add(t, z.data());
+    }
+    HarmonicsOutput result;
+    analysis.solve(&result);
+    benchmark::DoNotOptimize(result.amplitude(0)->data());
+  }
+  state.SetItemsProcessed(state.iterations() * numSnaps * numNodes);
+}
+
+BENCHMARK(bench_harmonicsAnalysis)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,15 @@
+find_package(benchmark REQUIRED)
+
+add_executable(adcircmodules_bench ${CMAKE_CURRENT_SOURCE_DIR}/bench/main.cpp)
+target_include_directories(adcircmodules_bench
+                           PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/src)
+target_compile_definitions(
+  adcircmodules_bench
+  PRIVATE
+    ADCMOD_BENCH_MESH="${CMAKE_CURRENT_SOURCE_DIR}/testing/test_files/ms-riv.grd"
+)
+add_dependencies(adcircmodules_bench adcircmodules_static)
+target_link_libraries(adcircmodules_bench adcircmodules_static
+                      adcircmodules_interface benchmark::benchmark)
+set_target_properties(adcircmodules_bench
+                      PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/bench)
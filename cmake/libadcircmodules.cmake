@@ -23,16 +23,29 @@ set(ADCIRCMODULES_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/StringConversion.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/NodalAttributes.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Attribute.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/AttributeColumn.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/AttributeMetadata.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputMetadata.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputRecord.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ReadOutput.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/WriteOutput.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/TimeReduction.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsRecord.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsAnalysis.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsSynthesis.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsOutput.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/CsrAdjacency.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ElementTable.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/NodeTable.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Meshchecker.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshQuality.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshReorder.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterizationPlan.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterFile.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/IdIndex.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/FeatureTable.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/ShapefileWriter.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/OgrWriter.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Multithreading.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Constants.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshPrivate.cpp
@@ -41,6 +54,7 @@ set(ADCIRCMODULES_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/KDTreePrivate.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Topology.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FaceTable.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/EdgeTable.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ProgressBar.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsOutputPrivate.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsRecordPrivate.cpp
@@ -55,6 +69,8 @@ if(GDAL_FOUND)
       ${CMAKE_CURRENT_SOURCE_DIR}/src/GriddataPrivate.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/Pixel.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterData.cpp
+      ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterIntegralTables.cpp
+      ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterMosaic.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataAverage.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataNearest.cpp
       ${CMAKE_CURRENT_SOURCE_DIR}/src/interpolation/GriddataHighest.cpp
@@ -72,6 +88,7 @@ set(HEADER_LIST
     ${CMAKE_CURRENT_SOURCE_DIR}/src/AdcircModules.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/AdcircModules_Global.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Attribute.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/AttributeColumn.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/AttributeMetadata.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Boundary.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Config.h
@@ -87,6 +104,8 @@ set(HEADER_LIST
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FileTypes.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsOutput.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsRecord.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsAnalysis.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/HarmonicsSynthesis.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/InterpolationMethods.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FileIO.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Projection.h
@@ -95,12 +114,18 @@ set(HEADER_LIST
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Node.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ReadOutput.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/WriteOutput.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/TimeReduction.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputRecord.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/OutputMetadata.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Meshchecker.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshQuality.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/MeshReorder.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/RasterizationPlan.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/CsrAdjacency.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/ElementTable.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/NodeTable.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/FaceTable.h
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/EdgeTable.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Topology.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Face.h
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Multithreading.h
@@ -171,8 +196,10 @@ if(GDAL_FOUND)
                              PRIVATE ${GDAL_INCLUDE_DIR})
   link_directories(${GDAL_LIBPATH})
   target_link_libraries(adcircmodules_interface INTERFACE ${GDAL_LIBRARY})
-  set(HEADER_LIST ${HEADER_LIST} ${CMAKE_SOURCE_DIR}/src/RasterData.h
-                  ${CMAKE_SOURCE_DIR}/src/Griddata.h)
+  set(HEADER_LIST
+      ${HEADER_LIST} ${CMAKE_SOURCE_DIR}/src/RasterData.h
+      ${CMAKE_SOURCE_DIR}/src/RasterIntegralTables.h
+      ${CMAKE_SOURCE_DIR}/src/Griddata.h)
 endif(GDAL_FOUND)
 
 set_target_properties(
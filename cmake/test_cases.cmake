@@ -25,6 +25,13 @@ if(UNIX OR CYGWIN)
         cxx_readHarmonicsVelocity.cpp
         cxx_readnetcdfHarmonicsElevation.cpp
         cxx_readnetcdfHarmonicsVelocity.cpp
+        cxx_harmonicsSynthesis.cpp
+        cxx_harmonicsAnalysis.cpp
+        cxx_timeReduction.cpp
+        cxx_hmdfStation.cpp
+        cxx_hmdfNetcdf.cpp
+        cxx_hmdfImeds.cpp
+        cxx_readOceanweather.cpp
         cxx_checkmesh.cpp
         cxx_read2dm.cpp
         cxx_kdtree.cpp
@@ -38,12 +45,21 @@ if(UNIX OR CYGWIN)
         cxx_makemesh.cpp
         cxx_date.cpp
         cxx_topolgy.cpp
+        cxx_meshQuality.cpp
+        cxx_reorderMesh.cpp
+        cxx_rasterizationPlan.cpp
+        cxx_stationInterpolation.cpp
+        cxx_attributeColumn.cpp
+        cxx_fort13RoundTrip.cpp
+        cxx_stringConversion.cpp
         )
 
     if(ENABLE_GDAL)
       set(TEST_LIST
-          ${TEST_LIST} cxx_interpolateRaster.cpp cxx_interpolateManning.cpp
-          cxx_interpolateDwind.cpp cxx_writeraster.cpp)
+          ${TEST_LIST} cxx_interpolateRaster.cpp cxx_interpolateRasterIntegral.cpp
+          cxx_interpolateRasterOverview.cpp cxx_interpolateRasterMosaic.cpp
+          cxx_interpolateManning.cpp cxx_interpolateDwind.cpp cxx_writeraster.cpp
+          cxx_writevectorfile.cpp)
     endif(ENABLE_GDAL)
 
     if(OpenSSL_FOUND)
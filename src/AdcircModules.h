@@ -30,18 +30,24 @@
 #include "FileTypes.h"
 #include "Griddata.h"
 #include "HarmonicsOutput.h"
+#include "HarmonicsAnalysis.h"
+#include "HarmonicsSynthesis.h"
 #include "HashType.h"
 #include "Hmdf.h"
 #include "InterpolationMethods.h"
 #include "KDTree.h"
 #include "Logging.h"
 #include "Mesh.h"
+#include "MeshQuality.h"
+#include "MeshReorder.h"
+#include "RasterizationPlan.h"
 #include "Meshchecker.h"
 #include "Multithreading.h"
 #include "NodalAttributes.h"
 #include "NodeTable.h"
 #include "Projection.h"
 #include "ReadOutput.h"
+#include "TimeReduction.h"
 #include "Topology.h"
 #include "WriteOutput.h"
 #include "Oceanweather.h"
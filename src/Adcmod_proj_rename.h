@@ -33,6 +33,9 @@
 #define adcmod_proj_todeg internal_proj_todeg
 #define adcmod_proj_context_set_database_path \
   internal_proj_context_set_database_path
+#define adcmod_proj_context_create internal_proj_context_create
+#define adcmod_proj_context_destroy internal_proj_context_destroy
+#define adcmod_proj_trans_generic internal_proj_trans_generic
 #else
 #define adcmod_proj_context_get_database_path proj_context_get_database_path
 #define adcmod_proj_create_crs_to_crs proj_create_crs_to_crs
@@ -44,4 +47,7 @@
 #define adcmod_proj_angular_output proj_angular_output
 #define adcmod_proj_todeg proj_todeg
 #define adcmod_proj_context_set_database_path proj_context_set_database_path
+#define adcmod_proj_context_create proj_context_create
+#define adcmod_proj_context_destroy proj_context_destroy
+#define adcmod_proj_trans_generic proj_trans_generic
 #endif
@@ -31,7 +31,10 @@ using namespace Adcirc::ModelParameters;
  * @brief Default Constructor
  */
 Attribute::Attribute()
-    : m_id(adcircmodules_default_value<size_t>()), m_node(nullptr) {
+    : m_id(adcircmodules_default_value<size_t>()),
+      m_node(nullptr),
+      m_column(nullptr),
+      m_index(0) {
   this->resize(1);
 }
 
@@ -40,14 +43,38 @@ Attribute::Attribute()
  * @param[in] size Number of nodal attributes to size this object for
  */
 Attribute::Attribute(size_t size)
-    : m_id(adcircmodules_default_value<size_t>()), m_node(nullptr) {
+    : m_id(adcircmodules_default_value<size_t>()),
+      m_node(nullptr),
+      m_column(nullptr),
+      m_index(0) {
   this->resize(size);
 }
 
 /**
- * @brief Resizes the object to a new number of values in this nodal attribute
+ * @brief Constructs a proxy for one node of an attribute column
+ * @param[in] column column holding the values
+ * @param[in] index position of the node in the column
+ * @param[in] id node id
+ * @param[in] node node that the values apply to, may be null
  */
-void Attribute::resize(size_t size) { this->m_values.resize(size); }
+Attribute::Attribute(AttributeColumn *column, size_t index, size_t id,
+                     Adcirc::Geometry::Node *node)
+    : m_id(id), m_node(node), m_column(column), m_index(index) {}
+
+/**
+ * @brief Resizes the object to a new number of values in this nodal attribute.
+ * The size of a proxy is set by its column and cannot be changed
+ */
+void Attribute::resize(size_t size) {
+  if (this->m_column != nullptr) {
+    if (size != this->m_column->numValues()) {
+      adcircmodules_throw_exception(
+          "Attribute: Cannot resize an attribute stored in a column");
+    }
+    return;
+  }
+  this->m_values.resize(size);
+}
 
 /**
  * @brief Returns the value of the nodal attribute at the specified index
@@ -58,6 +85,9 @@ double Attribute::value(size_t index) const {
   assert(index < this->size());
 
   if (index < this->size()) {
+    if (this->m_column != nullptr) {
+      return this->m_column->value(this->m_index, index);
+    }
     return m_values[index];
   } else {
     adcircmodules_throw_exception("Attribute: Index out of bounds");
@@ -69,7 +99,12 @@ double Attribute::value(size_t index) const {
  * @brief Returns a vector of all values for this nodal parameter
  * @return values for this nodal attribute
  */
-std::vector<double> Attribute::values() const { return this->m_values; }
+std::vector<double> Attribute::values() const {
+  if (this->m_column != nullptr) {
+    return this->m_column->values(this->m_index);
+  }
+  return this->m_values;
+}
 
 /**
  * @brief Set all values in the object to a single value
@@ -77,7 +112,11 @@ std::vector<double> Attribute::values() const { return this->m_values; }
  * present node
  */
 void Attribute::setValue(const double &value) {
-  std::fill(this->m_values.begin(), this->m_values.end(), value);
+  if (this->m_column != nullptr) {
+    this->m_column->fill(this->m_index, value);
+  } else {
+    std::fill(this->m_values.begin(), this->m_values.end(), value);
+  }
 }
 
 /**
@@ -89,7 +128,11 @@ void Attribute::setValue(size_t index, const double &value) {
   assert(index < this->size());
 
   if (index < this->size()) {
-    this->m_values[index] = value;
+    if (this->m_column != nullptr) {
+      this->m_column->setValue(this->m_index, index, value);
+    } else {
+      this->m_values[index] = value;
+    }
   } else {
     adcircmodules_throw_exception("Attribute: Index out of bounds");
   }
@@ -103,7 +146,11 @@ void Attribute::setValue(const std::vector<double> &values) {
   assert(values.size() == this->size());
 
   if (values.size() == this->size()) {
-    this->m_values = values;
+    if (this->m_column != nullptr) {
+      this->m_column->setValues(this->m_index, values);
+    } else {
+      this->m_values = values;
+    }
   } else {
     adcircmodules_throw_exception("Attribute: Index out of bounds");
   }
@@ -126,7 +173,10 @@ void Attribute::setNode(Adcirc::Geometry::Node *node) { this->m_node = node; }
  * @brief Returns the current size of this nodal attribute
  * @return size of nodal attribute
  */
-size_t Attribute::size() const { return this->m_values.size(); }
+size_t Attribute::size() const {
+  return this->m_column != nullptr ? this->m_column->numValues()
+                                   : this->m_values.size();
+}
 
 /**
  * @brief Returns idenfitier for the current nodal attribute as specified in the
@@ -146,11 +196,18 @@ void Attribute::setId(size_t id) { this->m_id = id; }
  * @brief Generates a string to print in a nodal attributes file for this object
  * @return string formatted attribute
  */
-std::string Attribute::write() {
+std::string Attribute::write() const {
   std::string f = boost::str(boost::format("%11i  ") % this->m_id);
-  for (auto &v : this->m_values) {
+  for (auto &v : this->values()) {
     f = f + boost::str(boost::format("%12.6f  ") % v);
   }
   f = f + "\n";
   return f;
 }
+
+/**
+ * @brief Returns true if the values are stored in an AttributeColumn rather
+ * than in this object
+ * @return true if this object is a proxy
+ */
+bool Attribute::isProxy() const { return this->m_column != nullptr; }
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "AdcircModules_Global.h"
+#include "AttributeColumn.h"
 #include "Node.h"
 
 namespace Adcirc {
@@ -38,6 +39,10 @@ namespace ModelParameters {
  * size (i.e. scalars like friction or 12-parametered values such as
  * directional wind reduction.
  *
+ * An Attribute either owns its values or acts as a proxy for one node of an
+ * AttributeColumn. The NodalAttributes class returns proxies, so changes made
+ * through them are written directly into the column.
+ *
  */
 
 class Attribute {
@@ -46,6 +51,11 @@ class Attribute {
 
   ADCIRCMODULES_EXPORT Attribute(size_t size);
 
+#ifndef SWIG
+  ADCIRCMODULES_EXPORT Attribute(AttributeColumn *column, size_t index,
+                                 size_t id, Adcirc::Geometry::Node *node);
+#endif
+
   void ADCIRCMODULES_EXPORT resize(size_t size);
 
   double ADCIRCMODULES_EXPORT value(size_t index) const;
@@ -63,7 +73,9 @@ class Attribute {
   size_t ADCIRCMODULES_EXPORT id() const;
   void ADCIRCMODULES_EXPORT setId(size_t id);
 
-  std::string ADCIRCMODULES_EXPORT write();
+  std::string ADCIRCMODULES_EXPORT write() const;
+
+  bool ADCIRCMODULES_EXPORT isProxy() const;
 
  private:
   /// ID number in the Adcirc Nodal Attributes file
@@ -74,6 +86,12 @@ class Attribute {
 
   /// Node that this value applies to
   Adcirc::Geometry::Node *m_node;
+
+  /// Column holding the values when this object is a proxy
+  AttributeColumn *m_column;
+
+  /// Position of the node in the column
+  size_t m_index;
 };
 }  // namespace ModelParameters
 }  // namespace Adcirc
@@ -0,0 +1,293 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "AttributeColumn.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cassert>
+
+#include "FPCompare.h"
+#include "Logging.h"
+
+using namespace Adcirc::ModelParameters;
+
+/**
+ * @brief Default constructor
+ */
+AttributeColumn::AttributeColumn() : m_numNodes(0), m_numValues(1) {
+  this->m_defaultValues.resize(1, 0.0);
+}
+
+/**
+ * @brief Constructor that sizes the column and sets every node to the default
+ * @param[in] numNodes number of nodes
+ * @param[in] defaultValues default value(s) of the attribute
+ */
+AttributeColumn::AttributeColumn(size_t numNodes,
+                                 const std::vector<double> &defaultValues)
+    : m_numNodes(0), m_numValues(1) {
+  this->resize(numNodes, defaultValues);
+}
+
+/**
+ * @brief Resizes the column and sets every node to the default value
+ * @param[in] numNodes number of nodes
+ * @param[in] defaultValues default value(s) of the attribute. The size sets
+ * the number of values per node
+ */
+void AttributeColumn::resize(size_t numNodes,
+                             const std::vector<double> &defaultValues) {
+  if (defaultValues.empty()) {
+    adcircmodules_throw_exception(
+        "AttributeColumn: At least one default value is required");
+  }
+  this->m_numNodes = numNodes;
+  this->m_numValues = defaultValues.size();
+  this->m_defaultValues = defaultValues;
+  this->m_values.resize(numNodes * this->m_numValues);
+  this->m_nonDefault.assign((numNodes + 63) / 64, 0);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < numNodes; ++i) {
+    std::copy(defaultValues.begin(), defaultValues.end(),
+              this->m_values.begin() + i * this->m_numValues);
+  }
+}
+
+/**
+ * @brief Number of nodes in the column
+ * @return number of nodes
+ */
+size_t AttributeColumn::numNodes() const { return this->m_numNodes; }
+
+/**
+ * @brief Number of values stored for each node
+ * @return number of values
+ */
+size_t AttributeColumn::numValues() const { return this->m_numValues; }
+
+/**
+ * @brief Returns a value at a node
+ * @param[in] node node position
+ * @param[in] index value index
+ * @return value
+ */
+double AttributeColumn::value(size_t node, size_t index) const {
+  assert(node < this->m_numNodes);
+  assert(index < this->m_numValues);
+  if (node >= this->m_numNodes || index >= this->m_numValues) {
+    adcircmodules_throw_exception("AttributeColumn: Index out of bounds");
+  }
+  return this->m_values[node * this->m_numValues + index];
+}
+
+/**
+ * @brief Returns all values at a node
+ * @param[in] node node position
+ * @return vector of values
+ */
+std::vector<double> AttributeColumn::values(size_t node) const {
+  assert(node < this->m_numNodes);
+  if (node >= this->m_numNodes) {
+    adcircmodules_throw_exception("AttributeColumn: Index out of bounds");
+  }
+  const double *r = this->row(node);
+  return std::vector<double>(r, r + this->m_numValues);
+}
+
+/**
+ * @brief Sets a single value at a node
+ * @param[in] node node position
+ * @param[in] index value index
+ * @param[in] value value to set
+ */
+void AttributeColumn::setValue(size_t node, size_t index, double value) {
+  assert(node < this->m_numNodes);
+  assert(index < this->m_numValues);
+  if (node >= this->m_numNodes || index >= this->m_numValues) {
+    adcircmodules_throw_exception("AttributeColumn: Index out of bounds");
+  }
+  this->m_values[node * this->m_numValues + index] = value;
+  this->setMask(node, !this->compareToDefault(node));
+}
+
+/**
+ * @brief Sets all values at a node to a single value
+ * @param[in] node node position
+ * @param[in] value value to set
+ */
+void AttributeColumn::fill(size_t node, double value) {
+  assert(node < this->m_numNodes);
+  if (node >= this->m_numNodes) {
+    adcircmodules_throw_exception("AttributeColumn: Index out of bounds");
+  }
+  double *r = this->mutableRow(node);
+  std::fill(r, r + this->m_numValues, value);
+  this->setMask(node, !this->compareToDefault(node));
+}
+
+/**
+ * @brief Sets all values at a node
+ * @param[in] node node position
+ * @param[in] values values to set. Must have numValues entries
+ */
+void AttributeColumn::setValues(size_t node,
+                                const std::vector<double> &values) {
+  if (values.size() != this->m_numValues) {
+    adcircmodules_throw_exception("AttributeColumn: Index out of bounds");
+  }
+  this->setValues(node, values.data());
+}
+
+/**
+ * @brief Sets all values at a node
+ * @param[in] node node position
+ * @param[in] values pointer to numValues values
+ */
+void AttributeColumn::setValues(size_t node, const double *values) {
+  assert(node < this->m_numNodes);
+  if (node >= this->m_numNodes) {
+    adcircmodules_throw_exception("AttributeColumn: Index out of bounds");
+  }
+  std::copy(values, values + this->m_numValues, this->mutableRow(node));
+  this->setMask(node, !this->compareToDefault(node));
+}
+
+/**
+ * @brief Returns true if the values at a node are the default values
+ * @param[in] node node position
+ * @return true if default
+ */
+bool AttributeColumn::isDefault(size_t node) const {
+  assert(node < this->m_numNodes);
+  return !(this->m_nonDefault[node / 64] & (uint64_t(1) << (node % 64)));
+}
+
+/**
+ * @brief Number of nodes with values different from the default
+ * @return number of non-default nodes
+ */
+size_t AttributeColumn::numNonDefault() const {
+  size_t n = 0;
+  for (auto w : this->m_nonDefault) {
+    n += std::bitset<64>(w).count();
+  }
+  return n;
+}
+
+/**
+ * @brief Default value(s) of the attribute
+ * @return default values
+ */
+const std::vector<double> &AttributeColumn::defaultValues() const {
+  return this->m_defaultValues;
+}
+
+/**
+ * @brief Changes the default value(s) and recomputes the non-default nodes
+ * @param[in] defaultValues new default value(s). Must have numValues entries
+ */
+void AttributeColumn::setDefaultValues(
+    const std::vector<double> &defaultValues) {
+  if (defaultValues.size() != this->m_numValues) {
+    adcircmodules_throw_exception(
+        "AttributeColumn: Default values do not match the column size");
+  }
+  this->m_defaultValues = defaultValues;
+  this->updateDefaultMask();
+}
+
+/**
+ * @brief Values for all nodes, numValues consecutive entries per node
+ * @return reference to the value array
+ */
+const std::vector<double> &AttributeColumn::data() const {
+  return this->m_values;
+}
+
+/**
+ * @brief Values for all nodes without copying them, numValues consecutive
+ * entries per node. The array is owned by the column and is only valid until
+ * the column is resized
+ * @return pointer to the value array
+ */
+const std::vector<double> *AttributeColumn::dataView() const {
+  return &this->m_values;
+}
+
+/**
+ * @brief Recomputes which nodes differ from the default values
+ *
+ * Each thread owns a range of whole 64-node words of the bitmap so that no
+ * two threads write to the same word.
+ */
+void AttributeColumn::updateDefaultMask() {
+  const size_t nw = this->m_nonDefault.size();
+#pragma omp parallel for schedule(static)
+  for (size_t w = 0; w < nw; ++w) {
+    uint64_t bits = 0;
+    const size_t first = w * 64;
+    const size_t last = std::min(first + 64, this->m_numNodes);
+    for (size_t i = first; i < last; ++i) {
+      if (!this->compareToDefault(i)) {
+        bits |= uint64_t(1) << (i - first);
+      }
+    }
+    this->m_nonDefault[w] = bits;
+  }
+}
+
+/**
+ * @brief Reorders the node values
+ * @param[in] order gather list, where entry i is the previous position of the
+ * node now at position i
+ */
+void AttributeColumn::permute(const std::vector<size_t> &order) {
+  if (order.size() != this->m_numNodes) {
+    adcircmodules_throw_exception(
+        "AttributeColumn: Permutation size does not match number of nodes");
+  }
+  std::vector<double> p(this->m_values.size());
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < this->m_numNodes; ++i) {
+    const double *r = this->row(order[i]);
+    std::copy(r, r + this->m_numValues, p.begin() + i * this->m_numValues);
+  }
+  this->m_values.swap(p);
+  this->updateDefaultMask();
+}
+
+bool AttributeColumn::compareToDefault(size_t node) const {
+  const double *r = this->row(node);
+  for (size_t k = 0; k < this->m_numValues; ++k) {
+    if (!Adcirc::FpCompare::equalTo(r[k], this->m_defaultValues[k])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void AttributeColumn::setMask(size_t node, bool nonDefault) {
+  const uint64_t bit = uint64_t(1) << (node % 64);
+  if (nonDefault) {
+    this->m_nonDefault[node / 64] |= bit;
+  } else {
+    this->m_nonDefault[node / 64] &= ~bit;
+  }
+}
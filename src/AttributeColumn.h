@@ -0,0 +1,120 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_ATTRIBUTECOLUMN_H
+#define ADCMOD_ATTRIBUTECOLUMN_H
+
+#include <cstdint>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+
+namespace Adcirc {
+namespace ModelParameters {
+
+/**
+ * @class AttributeColumn
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Contiguous storage of one nodal attribute for every node in the mesh
+ *
+ * The values for all nodes are held in a single array of numNodes *
+ * numValues entries, with the values for a node stored next to each other. A
+ * bitmap marks the nodes whose values differ from the attribute default so
+ * that the non-default nodes can be counted and written without comparing
+ * every value again.
+ *
+ * The bitmap is kept current by the setters. If the array returned by
+ * mutableData is modified directly, updateDefaultMask must be called before
+ * the column is written.
+ */
+class AttributeColumn {
+ public:
+  ADCIRCMODULES_EXPORT AttributeColumn();
+
+  ADCIRCMODULES_EXPORT AttributeColumn(
+      size_t numNodes, const std::vector<double> &defaultValues);
+
+  void ADCIRCMODULES_EXPORT resize(size_t numNodes,
+                                   const std::vector<double> &defaultValues);
+
+  size_t ADCIRCMODULES_EXPORT numNodes() const;
+  size_t ADCIRCMODULES_EXPORT numValues() const;
+
+  double ADCIRCMODULES_EXPORT value(size_t node, size_t index = 0) const;
+  std::vector<double> ADCIRCMODULES_EXPORT values(size_t node) const;
+
+  void ADCIRCMODULES_EXPORT setValue(size_t node, size_t index, double value);
+  void ADCIRCMODULES_EXPORT fill(size_t node, double value);
+  void ADCIRCMODULES_EXPORT setValues(size_t node,
+                                      const std::vector<double> &values);
+
+  bool ADCIRCMODULES_EXPORT isDefault(size_t node) const;
+  size_t ADCIRCMODULES_EXPORT numNonDefault() const;
+
+  const std::vector<double> ADCIRCMODULES_EXPORT &defaultValues() const;
+  void ADCIRCMODULES_EXPORT
+  setDefaultValues(const std::vector<double> &defaultValues);
+
+  const std::vector<double> ADCIRCMODULES_EXPORT *dataView() const;
+
+  void ADCIRCMODULES_EXPORT updateDefaultMask();
+
+  void ADCIRCMODULES_EXPORT permute(const std::vector<size_t> &order);
+
+#ifndef SWIG
+  const std::vector<double> ADCIRCMODULES_EXPORT &data() const;
+
+  const double *row(size_t node) const {
+    return m_values.data() + node * m_numValues;
+  }
+
+  double *mutableRow(size_t node) {
+    return m_values.data() + node * m_numValues;
+  }
+
+  std::vector<double> &mutableData() { return m_values; }
+
+  void ADCIRCMODULES_EXPORT setValues(size_t node, const double *values);
+#endif
+
+ private:
+  bool compareToDefault(size_t node) const;
+  void setMask(size_t node, bool nonDefault);
+
+  /// Number of nodes in the column
+  size_t m_numNodes;
+
+  /// Number of values stored for each node
+  size_t m_numValues;
+
+  /// Default value(s) of the attribute
+  std::vector<double> m_defaultValues;
+
+  /// Values for all nodes, numNodes * numValues
+  std::vector<double> m_values;
+
+  /// Bit set for each node whose values differ from the default
+  std::vector<uint64_t> m_nonDefault;
+};
+
+}  // namespace ModelParameters
+}  // namespace Adcirc
+
+#endif  // ADCMOD_ATTRIBUTECOLUMN_H
@@ -0,0 +1,133 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "CsrAdjacency.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "Logging.h"
+
+using namespace Adcirc::Geometry;
+
+/**
+ * @brief Default constructor
+ */
+CsrAdjacency::CsrAdjacency() : m_hasValues(false) {}
+
+/**
+ * @brief Builds the table from a list of entries
+ * @param numRows number of rows in the table
+ * @param entries list of row/column/value entries. The list is released once
+ * the table is built
+ * @param unique if true, only the first entry for each column in a row is kept
+ * @param storeValues if true, the value array is kept alongside the indices
+ *
+ * The entries are placed into rows with a counting sort. Counting and
+ * scattering are done in parallel and each row is then sorted by column so
+ * the table is identical regardless of the order the entries were placed.
+ */
+void CsrAdjacency::build(size_t numRows, std::vector<Entry> &entries,
+                         bool unique, bool storeValues) {
+  if (numRows >= std::numeric_limits<index_type>::max() ||
+      entries.size() >= std::numeric_limits<index_type>::max()) {
+    adcircmodules_throw_exception("Adjacency table is too large");
+  }
+
+  this->clear();
+  this->m_hasValues = storeValues;
+
+  std::vector<index_type> offsets(numRows + 1, 0);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < entries.size(); ++i) {
+    assert(entries[i].row < numRows);
+#pragma omp atomic
+    offsets[entries[i].row + 1]++;
+  }
+
+  for (size_t i = 0; i < numRows; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  std::vector<std::pair<index_type, index_type>> scattered(entries.size());
+  std::vector<index_type> cursor(offsets.begin(), offsets.end() - 1);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < entries.size(); ++i) {
+    index_type pos;
+#pragma omp atomic capture
+    pos = cursor[entries[i].row]++;
+    scattered[pos] = {entries[i].column, entries[i].value};
+  }
+
+  entries.clear();
+  entries.shrink_to_fit();
+  cursor.clear();
+  cursor.shrink_to_fit();
+
+  std::vector<index_type> counts(numRows + 1, 0);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (size_t r = 0; r < numRows; ++r) {
+    auto b = scattered.begin() + offsets[r];
+    auto e = scattered.begin() + offsets[r + 1];
+    std::sort(b, e);
+    if (unique) {
+      e = std::unique(b, e,
+                      [](const std::pair<index_type, index_type> &a,
+                         const std::pair<index_type, index_type> &c) {
+                        return a.first == c.first;
+                      });
+    }
+    counts[r + 1] = static_cast<index_type>(e - b);
+  }
+
+  for (size_t i = 0; i < numRows; ++i) {
+    counts[i + 1] += counts[i];
+  }
+
+  this->m_indices.resize(counts.back());
+  if (storeValues) this->m_values.resize(counts.back());
+
+#pragma omp parallel for schedule(static)
+  for (size_t r = 0; r < numRows; ++r) {
+    const index_type n = counts[r + 1] - counts[r];
+    for (index_type k = 0; k < n; ++k) {
+      const auto &s = scattered[offsets[r] + k];
+      this->m_indices[counts[r] + k] = s.first;
+      if (storeValues) this->m_values[counts[r] + k] = s.second;
+    }
+  }
+
+  this->m_offsets = std::move(counts);
+}
+
+/**
+ * @brief Releases the memory held by the table
+ */
+void CsrAdjacency::clear() {
+  this->m_offsets.clear();
+  this->m_offsets.shrink_to_fit();
+  this->m_indices.clear();
+  this->m_indices.shrink_to_fit();
+  this->m_values.clear();
+  this->m_values.shrink_to_fit();
+  this->m_hasValues = false;
+}
@@ -0,0 +1,128 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_CSRADJACENCY_H
+#define ADCMOD_CSRADJACENCY_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+
+namespace Adcirc {
+namespace Geometry {
+
+/**
+ * @class CsrAdjacency
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Adjacency list stored in compressed sparse row format
+ *
+ * The entries for all rows are held in a single array of 32-bit indices with
+ * an offset array marking where each row begins. An optional value array can
+ * be carried alongside the indices. Rows are sorted by index after the table
+ * is built so that the result does not depend on the number of threads used.
+ */
+class CsrAdjacency {
+ public:
+  using index_type = uint32_t;
+
+  /**
+   * @brief Input entry used to build the table
+   */
+  struct Entry {
+    index_type row;
+    index_type column;
+    index_type value;
+  };
+
+  /**
+   * @brief Non-owning view of the entries in a single row
+   */
+  class Range {
+   public:
+    Range() : m_begin(nullptr), m_end(nullptr) {}
+    Range(const index_type *begin, const index_type *end)
+        : m_begin(begin), m_end(end) {}
+
+    const index_type *begin() const { return m_begin; }
+    const index_type *end() const { return m_end; }
+    size_t size() const { return static_cast<size_t>(m_end - m_begin); }
+    bool empty() const { return m_begin == m_end; }
+    index_type operator[](size_t i) const {
+      assert(i < this->size());
+      return m_begin[i];
+    }
+
+   private:
+    const index_type *m_begin;
+    const index_type *m_end;
+  };
+
+  ADCIRCMODULES_EXPORT CsrAdjacency();
+
+  void ADCIRCMODULES_EXPORT build(size_t numRows, std::vector<Entry> &entries,
+                                  bool unique, bool storeValues);
+
+  void ADCIRCMODULES_EXPORT clear();
+
+  bool empty() const { return m_offsets.empty(); }
+
+  size_t numRows() const {
+    return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+  }
+
+  size_t numEntries() const { return m_indices.size(); }
+
+  bool hasValues() const { return m_hasValues; }
+
+  size_t size(size_t row) const {
+    assert(row + 1 < m_offsets.size());
+    return m_offsets[row + 1] - m_offsets[row];
+  }
+
+  Range row(size_t row) const {
+    assert(row + 1 < m_offsets.size());
+    return Range(m_indices.data() + m_offsets[row],
+                 m_indices.data() + m_offsets[row + 1]);
+  }
+
+  Range values(size_t row) const {
+    assert(row + 1 < m_offsets.size());
+    assert(m_hasValues);
+    return Range(m_values.data() + m_offsets[row],
+                 m_values.data() + m_offsets[row + 1]);
+  }
+
+  const std::vector<index_type> &offsets() const { return m_offsets; }
+  const std::vector<index_type> &indices() const { return m_indices; }
+
+ private:
+  std::vector<index_type> m_offsets;
+  std::vector<index_type> m_indices;
+  std::vector<index_type> m_values;
+  bool m_hasValues;
+};
+
+}  // namespace Geometry
+}  // namespace Adcirc
+
+#endif  // ADCMOD_CSRADJACENCY_H
@@ -0,0 +1,257 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "EdgeTable.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+#include "Logging.h"
+#include "MeshPrivate.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Geometry;
+
+namespace {
+
+struct EdgeKey {
+  uint64_t key;
+  uint32_t element;
+};
+
+/**
+ * @brief Stable least significant digit radix sort of the edge keys
+ * @param keys keys to sort
+ *
+ * Each pass sorts on one byte. Every thread counts and then scatters its own
+ * contiguous part of the array so the sort is stable. Passes where all keys
+ * share the same byte are skipped.
+ */
+void radixSort(std::vector<EdgeKey> &keys) {
+  constexpr size_t nBuckets = 256;
+  const size_t n = keys.size();
+  if (n < 2) return;
+
+#ifdef _OPENMP
+  const size_t nThreads =
+      std::max(static_cast<size_t>(1),
+               std::min(static_cast<size_t>(omp_get_max_threads()),
+                        n / nBuckets + 1));
+#else
+  const size_t nThreads = 1;
+#endif
+
+  std::vector<EdgeKey> buffer(n);
+  std::vector<std::array<size_t, nBuckets>> histogram(nThreads);
+
+  auto chunkBegin = [&](size_t t) { return t * n / nThreads; };
+
+  for (size_t pass = 0; pass < sizeof(uint64_t); ++pass) {
+    const size_t shift = 8 * pass;
+
+#pragma omp parallel num_threads(static_cast<int>(nThreads))
+    {
+#ifdef _OPENMP
+      const size_t t = static_cast<size_t>(omp_get_thread_num());
+#else
+      const size_t t = 0;
+#endif
+      auto &h = histogram[t];
+      h.fill(0);
+      for (size_t i = chunkBegin(t); i < chunkBegin(t + 1); ++i) {
+        h[(keys[i].key >> shift) & 0xff]++;
+      }
+    }
+
+    //...Convert the counts to starting positions ordered by bucket and
+    // then by thread. A pass where one bucket holds every key is skipped
+    bool skip = false;
+    size_t position = 0;
+    for (size_t b = 0; b < nBuckets; ++b) {
+      size_t bucketTotal = 0;
+      for (size_t t = 0; t < nThreads; ++t) {
+        const size_t c = histogram[t][b];
+        histogram[t][b] = position;
+        position += c;
+        bucketTotal += c;
+      }
+      if (bucketTotal == n) skip = true;
+    }
+    if (skip) continue;
+
+#pragma omp parallel num_threads(static_cast<int>(nThreads))
+    {
+#ifdef _OPENMP
+      const size_t t = static_cast<size_t>(omp_get_thread_num());
+#else
+      const size_t t = 0;
+#endif
+      auto &h = histogram[t];
+      for (size_t i = chunkBegin(t); i < chunkBegin(t + 1); ++i) {
+        buffer[h[(keys[i].key >> shift) & 0xff]++] = keys[i];
+      }
+    }
+    keys.swap(buffer);
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor
+ * @param[in] mesh pointer to MeshPrivate object
+ */
+EdgeTable::EdgeTable(Adcirc::Private::MeshPrivate *mesh)
+    : m_mesh(mesh), m_numElements(0), m_initialized(false) {}
+
+/**
+ * @brief Builds the list of unique edges
+ */
+void EdgeTable::build() {
+  if (!m_mesh) {
+    adcircmodules_throw_exception("No mesh defined");
+  }
+
+  const size_t ne = m_mesh->numElements();
+  if (m_mesh->numNodes() >= noElement() || ne >= noElement()) {
+    adcircmodules_throw_exception("Mesh is too large for the edge table");
+  }
+
+  std::vector<size_t> first(ne + 1, 0);
+  for (size_t i = 0; i < ne; ++i) {
+    first[i + 1] = first[i] + m_mesh->element(i)->n();
+  }
+
+  std::vector<EdgeKey> keys(first.back());
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < ne; ++i) {
+    Element *e = m_mesh->element(i);
+    for (size_t j = 0; j < e->n(); ++j) {
+      auto leg = e->elementLeg(j);
+      uint64_t n1 = m_mesh->nodeIndex(leg.first);
+      uint64_t n2 = m_mesh->nodeIndex(leg.second);
+      if (n1 > n2) std::swap(n1, n2);
+      keys[first[i] + j] = {(n1 << 32) | n2, static_cast<uint32_t>(i)};
+    }
+  }
+
+  radixSort(keys);
+
+  m_edges.clear();
+  m_edges.reserve(keys.size() / 2 + 1);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i].key != keys[i - 1].key) {
+      m_edges.push_back({static_cast<uint32_t>(keys[i].key >> 32),
+                         static_cast<uint32_t>(keys[i].key & 0xffffffff),
+                         keys[i].element, noElement(), 1});
+    } else {
+      Edge &edge = m_edges.back();
+      if (edge.numElements == 1) edge.element2 = keys[i].element;
+      edge.numElements++;
+    }
+  }
+  m_edges.shrink_to_fit();
+
+  m_numElements = ne;
+  m_initialized = true;
+}
+
+/**
+ * @brief Checks if the table has been built for the current mesh
+ * @return true if the table is initialized
+ */
+bool EdgeTable::initialized() const {
+  return m_initialized && m_mesh && m_numElements == m_mesh->numElements();
+}
+
+/**
+ * @brief Marks the table as out of date so that it is rebuilt when next
+ * requested
+ *
+ * The mesh calls this whenever its nodes or elements are added, removed or
+ * reordered. Code that changes the connectivity of an element directly
+ * through its pointer must call this itself.
+ */
+void EdgeTable::invalidate() {
+  m_edges.clear();
+  m_numElements = 0;
+  m_initialized = false;
+}
+
+/**
+ * @brief Number of unique edges in the mesh
+ * @return number of edges
+ */
+size_t EdgeTable::numEdges() const { return m_edges.size(); }
+
+/**
+ * @brief Checks if an edge belongs to only one element
+ * @param[in] index edge index
+ * @return true if the edge is on the mesh boundary
+ */
+bool EdgeTable::isBoundary(size_t index) const {
+  assert(index < m_edges.size());
+  return m_edges[index].numElements == 1;
+}
+
+/**
+ * @brief Returns the nodes that make up an edge
+ * @param[in] index edge index
+ * @return pair of node pointers, with the lower node index first
+ */
+std::pair<Node *, Node *> EdgeTable::nodes(size_t index) const {
+  assert(index < m_edges.size());
+  const Edge &e = m_edges[index];
+  return {m_mesh->node(e.node1), m_mesh->node(e.node2)};
+}
+
+/**
+ * @brief Returns the elements on either side of an edge
+ * @param[in] index edge index
+ * @return pair of element pointers. The second element is nullptr for
+ * boundary edges
+ */
+std::pair<Element *, Element *> EdgeTable::elements(size_t index) const {
+  assert(index < m_edges.size());
+  const Edge &e = m_edges[index];
+  return {m_mesh->element(e.element1),
+          e.element2 == noElement() ? nullptr : m_mesh->element(e.element2)};
+}
+
+/**
+ * @brief Returns the raw edge record
+ * @param[in] index edge index
+ * @return reference to edge
+ */
+const EdgeTable::Edge &EdgeTable::edge(size_t index) const {
+  assert(index < m_edges.size());
+  return m_edges[index];
+}
+
+/**
+ * @brief Returns the list of edges
+ * @return reference to the edge list
+ */
+const std::vector<EdgeTable::Edge> &EdgeTable::edges() const {
+  return m_edges;
+}
@@ -0,0 +1,100 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_EDGETABLE_H
+#define ADCMOD_EDGETABLE_H
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "Element.h"
+#include "Node.h"
+
+namespace Adcirc {
+namespace Private {
+class MeshPrivate;
+}
+
+namespace Geometry {
+
+/**
+ * @class EdgeTable
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief List of the unique element edges in the mesh and the elements on
+ * either side of each edge
+ *
+ * Each element leg is packed into a 64-bit key made from the smaller and
+ * larger node index. The keys are ordered with a parallel radix sort so that
+ * matching legs become adjacent. Edges are stored in ascending order of
+ * (node1, node2) where node1 is always the smaller node index.
+ */
+class EdgeTable {
+ public:
+  /**
+   * @brief Unique edge and the elements that share it
+   */
+  struct Edge {
+    uint32_t node1;
+    uint32_t node2;
+    uint32_t element1;
+    uint32_t element2;
+    uint32_t numElements;
+  };
+
+  ADCIRCMODULES_EXPORT explicit EdgeTable(Adcirc::Private::MeshPrivate *mesh);
+
+  void ADCIRCMODULES_EXPORT build();
+
+  bool ADCIRCMODULES_EXPORT initialized() const;
+
+  void ADCIRCMODULES_EXPORT invalidate();
+
+  size_t ADCIRCMODULES_EXPORT numEdges() const;
+
+  bool ADCIRCMODULES_EXPORT isBoundary(size_t index) const;
+
+  std::pair<Adcirc::Geometry::Node *, Adcirc::Geometry::Node *>
+      ADCIRCMODULES_EXPORT nodes(size_t index) const;
+
+  std::pair<Adcirc::Geometry::Element *, Adcirc::Geometry::Element *>
+      ADCIRCMODULES_EXPORT elements(size_t index) const;
+
+#ifndef SWIG
+  const Edge ADCIRCMODULES_EXPORT &edge(size_t index) const;
+  const std::vector<Edge> ADCIRCMODULES_EXPORT &edges() const;
+#endif
+
+  static constexpr uint32_t noElement() {
+    return std::numeric_limits<uint32_t>::max();
+  }
+
+ private:
+  Adcirc::Private::MeshPrivate *m_mesh;
+  std::vector<Edge> m_edges;
+  size_t m_numElements;
+  bool m_initialized;
+};
+}  // namespace Geometry
+}  // namespace Adcirc
+
+#endif  // ADCMOD_EDGETABLE_H
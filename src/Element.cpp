@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------*/
 #include "Element.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "AdcHash.h"
@@ -390,6 +391,26 @@ std::vector<double> Element::interpolationWeights(double x, double y) const {
   }
 }
 
+/**
+ * @brief Returns the interpolation weights for computing the value of a given
+ * point inside an element without allocating
+ * @param[in] x station location
+ * @param[in] y station location
+ * @param[out] weights interpolation weights for each vertex. Entries beyond
+ * the number of vertices are zero
+ */
+void Element::interpolationWeights(double x, double y,
+                                   std::array<double, 4> &weights) const {
+  weights.fill(0.0);
+  if (this->n() == 3) {
+    this->triangularInterpolation(x, y, weights.data());
+  } else {
+    const std::vector<double> w = this->polygonInterpolation(x, y);
+    std::copy(w.begin(), w.begin() + std::min(w.size(), weights.size()),
+              weights.begin());
+  }
+}
+
 /**
  * @brief Gets the hash of the element
  * @param[in] h type of cryptographic hash to generate
@@ -446,8 +467,18 @@ void Element::generateHash(Adcirc::Cryptography::HashType h) {
  */
 std::vector<double> Element::triangularInterpolation(double x, double y) const {
   std::vector<double> weights(3);
-  std::fill(weights.begin(), weights.end(), 0.0);
+  this->triangularInterpolation(x, y, weights.data());
+  return weights;
+}
 
+/**
+ * @brief Performs a barycentric interpolation into a caller provided array
+ * @param[in] x station location
+ * @param[in] y station location
+ * @param[out] weights array of at least three interpolation weights
+ */
+void Element::triangularInterpolation(double x, double y,
+                                      double *weights) const {
   const double x1 = this->node(0)->x();
   const double x2 = this->node(1)->x();
   const double x3 = this->node(2)->x();
@@ -461,8 +492,6 @@ std::vector<double> Element::triangularInterpolation(double x, double y) const {
   weights[0] = (((y2 - y3) * (x - x3) + (x3 - x2) * (y - y3)) / denom);
   weights[1] = (((y3 - y1) * (x - x3) + (x1 - x3) * (y - y3)) / denom);
   weights[2] = (1.0 - weights[0] - weights[1]);
-
-  return weights;
 }
 
 /**
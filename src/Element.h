@@ -19,6 +19,7 @@
 #ifndef ADCMOD_ELEMENT_H
 #define ADCMOD_ELEMENT_H
 
+#include <array>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -91,6 +92,8 @@ class Element {
   double ADCIRCMODULES_EXPORT area() const;
 
   std::vector<double> interpolationWeights(double x, double y) const;
+  void interpolationWeights(double x, double y,
+                            std::array<double, 4> &weights) const;
 
   std::string ADCIRCMODULES_EXPORT
   hash(Adcirc::Cryptography::HashType h =
@@ -113,6 +116,7 @@ class Element {
                         Adcirc::Cryptography::AdcircDefaultHash);
 
   std::vector<double> triangularInterpolation(double x, double y) const;
+  void triangularInterpolation(double x, double y, double *weights) const;
   std::vector<double> polygonInterpolation(double x, double y) const;
 };
 }  // namespace Geometry
@@ -54,14 +54,26 @@ void ElementTable::build() {
   if (this->m_mesh == nullptr) {
     return;
   }
-  this->m_elementTable.resize(this->m_mesh->numNodes());
-  for (size_t i = 0; i < this->m_mesh->numElements(); ++i) {
-    for (size_t j = 0; j < this->m_mesh->element(i)->n(); ++j) {
-      size_t n =
-          this->m_mesh->nodeIndexById(this->m_mesh->element(i)->node(j)->id());
-      this->m_elementTable[n].push_back(this->m_mesh->element(i));
+
+  const size_t ne = this->m_mesh->numElements();
+  std::vector<size_t> first(ne + 1, 0);
+  for (size_t i = 0; i < ne; ++i) {
+    first[i + 1] = first[i] + this->m_mesh->element(i)->n();
+  }
+
+  std::vector<CsrAdjacency::Entry> entries(first.back());
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < ne; ++i) {
+    Element *e = this->m_mesh->element(i);
+    for (size_t j = 0; j < e->n(); ++j) {
+      entries[first[i] + j] = {static_cast<CsrAdjacency::index_type>(
+                                   this->m_mesh->nodeIndex(e->node(j))),
+                               static_cast<CsrAdjacency::index_type>(i), 0};
     }
   }
+
+  this->m_elementTable.build(this->m_mesh->numNodes(), entries, false, false);
   this->m_initialized = true;
 }
 
@@ -71,10 +83,16 @@ void ElementTable::build() {
  * @return vector of element pointers around the node
  */
 std::vector<Element *> ElementTable::elementList(Node *n) {
-  size_t index = m_mesh->nodeIndexById(n->id());
-  if (index < m_mesh->numNodes())
-    return this->m_elementTable[index];
-  else
+  size_t index = m_mesh->nodeIndex(n);
+  if (index < m_mesh->numNodes()) {
+    const auto r = this->m_elementTable.row(index);
+    std::vector<Element *> list;
+    list.reserve(r.size());
+    for (const auto e : r) {
+      list.push_back(this->m_mesh->element(e));
+    }
+    return list;
+  } else
     adcircmodules_throw_exception("Node " + std::to_string(n->id()) +
                                   " not part of mesh");
   return std::vector<Element *>();
@@ -86,9 +104,9 @@ std::vector<Element *> ElementTable::elementList(Node *n) {
  * @return number of elements around a specified node
  */
 size_t ElementTable::numElementsAroundNode(Adcirc::Geometry::Node *n) {
-  size_t index = m_mesh->nodeIndexById(n->id());
+  size_t index = m_mesh->nodeIndex(n);
   if (index < m_mesh->numNodes())
-    return this->m_elementTable[index].size();
+    return this->m_elementTable.size(index);
   else
     return adcircmodules_default_value<size_t>();
 }
@@ -100,7 +118,7 @@ size_t ElementTable::numElementsAroundNode(Adcirc::Geometry::Node *n) {
  */
 size_t ElementTable::numElementsAroundNode(size_t nodeIndex) {
   if (nodeIndex < this->mesh()->numNodes()) {
-    return this->m_elementTable[nodeIndex].size();
+    return this->m_elementTable.size(nodeIndex);
   } else {
     adcircmodules_throw_exception("Out of bounds node request");
   }
@@ -116,10 +134,10 @@ size_t ElementTable::numElementsAroundNode(size_t nodeIndex) {
  */
 Adcirc::Geometry::Element *ElementTable::elementTable(Adcirc::Geometry::Node *n,
                                                       size_t listIndex) {
-  size_t index = m_mesh->nodeIndexById(n->id());
+  size_t index = m_mesh->nodeIndex(n);
   if (index < m_mesh->numNodes()) {
-    if (listIndex < this->m_elementTable[index].size()) {
-      return this->m_elementTable[index].at(listIndex);
+    if (listIndex < this->m_elementTable.size(index)) {
+      return this->m_mesh->element(this->m_elementTable.row(index)[listIndex]);
     } else {
       adcircmodules_throw_exception("Out of element table request");
     }
@@ -136,8 +154,9 @@ Adcirc::Geometry::Element *ElementTable::elementTable(Adcirc::Geometry::Node *n,
 Adcirc::Geometry::Element *ElementTable::elementTable(size_t nodeIndex,
                                                       size_t listIndex) {
   if (nodeIndex < this->mesh()->numNodes()) {
-    if (listIndex < this->m_elementTable[nodeIndex].size()) {
-      return this->m_elementTable[nodeIndex].at(listIndex);
+    if (listIndex < this->m_elementTable.size(nodeIndex)) {
+      return this->m_mesh->element(
+          this->m_elementTable.row(nodeIndex)[listIndex]);
     } else {
       adcircmodules_throw_exception("Out of element table request");
     }
@@ -147,6 +166,33 @@ Adcirc::Geometry::Element *ElementTable::elementTable(size_t nodeIndex,
   return nullptr;
 }
 
+/**
+ * @brief Returns the indices of the elements around a node without making a
+ * copy
+ * @param[in] n pointer to node
+ * @return range of element indices, in ascending order
+ */
+CsrAdjacency::Range ElementTable::elementIndices(
+    Adcirc::Geometry::Node *n) const {
+  return this->m_elementTable.row(this->m_mesh->nodeIndex(n));
+}
+
+/**
+ * @overload
+ * @param[in] nodeIndex node index in the mesh
+ */
+CsrAdjacency::Range ElementTable::elementIndices(size_t nodeIndex) const {
+  return this->m_elementTable.row(nodeIndex);
+}
+
+/**
+ * @brief Returns the underlying compressed table
+ * @return reference to the adjacency table
+ */
+const CsrAdjacency &ElementTable::adjacency() const {
+  return this->m_elementTable;
+}
+
 /**
  * @brief Returns the initialization status
  * @return true if initialized
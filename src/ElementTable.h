@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "AdcircModules_Global.h"
+#include "CsrAdjacency.h"
 #include "Element.h"
 
 namespace Adcirc {
@@ -59,6 +60,14 @@ class ElementTable {
   Adcirc::Geometry::Element ADCIRCMODULES_EXPORT *elementTable(
       size_t nodeIndex, size_t listIndex);
 
+#ifndef SWIG
+  CsrAdjacency::Range ADCIRCMODULES_EXPORT
+  elementIndices(Adcirc::Geometry::Node *n) const;
+  CsrAdjacency::Range ADCIRCMODULES_EXPORT
+  elementIndices(size_t nodeIndex) const;
+  const CsrAdjacency ADCIRCMODULES_EXPORT &adjacency() const;
+#endif
+
   void ADCIRCMODULES_EXPORT build();
 
   bool ADCIRCMODULES_EXPORT initialized() const;
@@ -67,7 +76,7 @@ class ElementTable {
   void ADCIRCMODULES_EXPORT setMesh(Adcirc::Private::MeshPrivate *mesh);
 
  private:
-  std::vector<std::vector<Adcirc::Geometry::Element *>> m_elementTable;
+  CsrAdjacency m_elementTable;
   Adcirc::Private::MeshPrivate *m_mesh;
 
   bool m_initialized;
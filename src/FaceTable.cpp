@@ -18,7 +18,6 @@
 //------------------------------------------------------------------------*/
 #include "FaceTable.h"
 
-#include <algorithm>
 #include <cassert>
 
 #include "Logging.h"
@@ -40,7 +39,7 @@ FaceTable::FaceTable(Adcirc::Private::MeshPrivate *mesh)
  * @return number of shared faces
  */
 size_t FaceTable::numSharedFaces(size_t index) const {
-  return m_elementNeighbors[index].size();
+  return m_elementNeighbors.size(index);
 }
 
 /**
@@ -48,7 +47,7 @@ size_t FaceTable::numSharedFaces(size_t index) const {
  * @param[in] element pointer to the element to query
  */
 size_t FaceTable::numSharedFaces(Adcirc::Geometry::Element *element) const {
-  return m_elementNeighbors[m_mesh->elementIndexById(element->id())].size();
+  return m_elementNeighbors.size(m_mesh->elementIndex(element));
 }
 
 /**
@@ -58,9 +57,7 @@ size_t FaceTable::numSharedFaces(Adcirc::Geometry::Element *element) const {
  * @return pointer to neighbor element
  */
 Element *FaceTable::neighbor(Element *element, size_t index) const {
-  size_t pos = m_mesh->elementIndexById(element->id());
-  assert(index < m_elementNeighbors[pos].size());
-  return m_elementNeighbors[pos][index];
+  return this->neighbor(m_mesh->elementIndex(element), index);
 }
 
 /**
@@ -69,9 +66,9 @@ Element *FaceTable::neighbor(Element *element, size_t index) const {
  * @param[in] index index of neighbor to return
  */
 Element *FaceTable::neighbor(size_t element, size_t index) const {
-  assert(element < m_elementNeighbors.size());
-  assert(index < m_elementNeighbors[element].size());
-  return m_elementNeighbors[element][index];
+  assert(element < m_elementNeighbors.numRows());
+  assert(index < m_elementNeighbors.size(element));
+  return m_mesh->element(m_elementNeighbors.row(element)[index]);
 }
 
 /**
@@ -81,8 +78,7 @@ Element *FaceTable::neighbor(size_t element, size_t index) const {
  */
 std::vector<Adcirc::Geometry::Element *> FaceTable::neighbors(
     Adcirc::Geometry::Element *element) const {
-  size_t index = m_mesh->elementIndexById(element->id());
-  return m_elementNeighbors[index];
+  return this->neighbors(m_mesh->elementIndex(element));
 }
 
 /**
@@ -91,8 +87,14 @@ std::vector<Adcirc::Geometry::Element *> FaceTable::neighbors(
  */
 std::vector<Adcirc::Geometry::Element *> FaceTable::neighbors(
     size_t index) const {
-  assert(index < m_elementNeighbors.size());
-  return m_elementNeighbors[index];
+  assert(index < m_elementNeighbors.numRows());
+  const auto r = m_elementNeighbors.row(index);
+  std::vector<Adcirc::Geometry::Element *> list;
+  list.reserve(r.size());
+  for (const auto e : r) {
+    list.push_back(m_mesh->element(e));
+  }
+  return list;
 }
 
 /**
@@ -100,12 +102,12 @@ std::vector<Adcirc::Geometry::Element *> FaceTable::neighbors(
  * @param[in] element pointer to element to search
  * @param[in] index return the ith shared face on the element
  * @return pair of node pointers making up a shared face
+ *
+ * The ith shared face is the face shared with the ith neighbor
  */
 std::pair<Node *, Node *> FaceTable::sharedFace(
     Adcirc::Geometry::Element *element, size_t index) const {
-  size_t pos = m_mesh->elementIndexById(element->id());
-  assert(index < m_elementNeighbors[pos].size());
-  return m_sharedFaces[pos][index]->nodes();
+  return this->sharedFace(m_mesh->elementIndex(element), index);
 }
 
 /**
@@ -115,78 +117,54 @@ std::pair<Node *, Node *> FaceTable::sharedFace(
  */
 std::pair<Node *, Node *> FaceTable::sharedFace(size_t element,
                                                 size_t index) const {
-  assert(element < m_mesh->numElements());
-  assert(index < m_sharedFaces.size());
-  return m_sharedFaces[element][index]->nodes();
+  assert(element < m_elementNeighbors.numRows());
+  assert(index < m_elementNeighbors.size(element));
+  return m_table[m_elementNeighbors.values(element)[index]].nodes();
+}
+
+/**
+ * @brief Returns the indices of the face sharing neighbors of an element
+ * without making a copy
+ * @param[in] index element index in the mesh
+ * @return range of element indices, in ascending order
+ */
+CsrAdjacency::Range FaceTable::neighborIndices(size_t index) const {
+  return m_elementNeighbors.row(index);
 }
 
 /**
- * @brief Constructs the internal table of element faces
+ * @brief Returns the underlying compressed table. The values hold the index
+ * of the shared face for each neighbor
+ * @return reference to the adjacency table
+ */
+const CsrAdjacency &FaceTable::adjacency() const { return m_elementNeighbors; }
+
+/**
+ * @brief Constructs the internal table of element faces from the mesh edge
+ * table
  */
 void FaceTable::build() {
   if (!m_mesh) {
     adcircmodules_throw_exception("No mesh defined");
   }
 
-  std::vector<Face> tempTable;
-  tempTable.reserve(m_mesh->numElements() * 4);
-  for (size_t i = 0; i < m_mesh->numElements(); ++i) {
-    auto face = m_mesh->element(i)->faces();
-    for (auto &j : face) {
-      auto fn1 = Adcirc::Geometry::FaceNode(j.first);
-      auto fn2 = Adcirc::Geometry::FaceNode(j.second);
-      if (fn1 < fn2) std::swap(fn1, fn2);
-      tempTable.emplace_back(
-          std::pair<FaceNode, FaceNode>(fn1, fn2),
-          std::pair<Element *, Element *>(m_mesh->element(i), nullptr));
-    }
-  }
-  std::sort(tempTable.begin(), tempTable.end());
-
-  size_t nf = 0;
-  for (size_t i = 0; i < tempTable.size() - 1; ++i) {
-    if (tempTable[i] == tempTable[i + 1]) {
-      tempTable[i].setElements(
-          {tempTable[i].elements().first, tempTable[i + 1].elements().first});
-      nf++;
-    }
+  const EdgeTable *edges = m_mesh->topology()->edgeTable();
+
+  m_table.clear();
+  std::vector<CsrAdjacency::Entry> entries;
+  entries.reserve(2 * edges->numEdges());
+  for (size_t i = 0; i < edges->numEdges(); ++i) {
+    const auto &edge = edges->edge(i);
+    if (edge.numElements < 2) continue;
+    const auto f = static_cast<CsrAdjacency::index_type>(m_table.size());
+    m_table.emplace_back(m_mesh->node(edge.node1), m_mesh->node(edge.node2),
+                         m_mesh->element(edge.element1),
+                         m_mesh->element(edge.element2));
+    entries.push_back({edge.element1, edge.element2, f});
+    entries.push_back({edge.element2, edge.element1, f});
   }
 
-  m_table.reserve(nf);
-  for (size_t i = tempTable.size(); i > 0; --i) {
-    if (tempTable[i].elements().second) {
-      m_table.push_back(std::move(tempTable[i]));
-    }
-  }
-  tempTable.clear();
-
-  auto it = std::unique(m_table.begin(), m_table.end());
-  m_table = std::vector<Face>(m_table.begin(), it);
-
-  m_elementNeighbors.resize(m_mesh->numElements());
-  m_sharedFaces.resize(m_mesh->numElements());
-  for (size_t i = 0; i < m_mesh->numElements(); ++i) {
-    m_elementNeighbors.reserve(m_mesh->element(i)->n());
-    m_sharedFaces[i].reserve(m_mesh->element(i)->n());
-  }
-
-  for (auto &f : m_table) {
-    if (f.elements().second == nullptr) continue;
-    size_t id1 = m_mesh->elementIndexById(f.elements().first->id());
-    size_t id2 = m_mesh->elementIndexById(f.elements().second->id());
-    m_elementNeighbors[id1].push_back(f.elements().second);
-    m_elementNeighbors[id2].push_back(f.elements().first);
-    m_sharedFaces[m_mesh->elementIndexById(f.elements().first->id())].push_back(
-        &f);
-    m_sharedFaces[m_mesh->elementIndexById(f.elements().second->id())]
-        .push_back(&f);
-  }
-
-  for (auto &f : m_elementNeighbors) {
-    std::sort(f.begin(), f.end());
-    auto it = std::unique(f.begin(), f.end());
-    f = std::vector<Adcirc::Geometry::Element *>(f.begin(), it);
-  }
+  m_elementNeighbors.build(m_mesh->numElements(), entries, true, true);
 
   this->m_initialized = true;
 }
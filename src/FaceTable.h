@@ -1,7 +1,10 @@
 #ifndef ADCMOD_FACETABLE_H
 #define ADCMOD_FACETABLE_H
 
+#include <vector>
+
 #include "AdcircModules_Global.h"
+#include "CsrAdjacency.h"
 #include "Face.h"
 
 namespace Adcirc {
@@ -45,6 +48,11 @@ class FaceTable {
   std::pair<Node *, Node *> ADCIRCMODULES_EXPORT sharedFace(size_t element,
                                                             size_t index) const;
 
+#ifndef SWIG
+  CsrAdjacency::Range ADCIRCMODULES_EXPORT neighborIndices(size_t index) const;
+  const CsrAdjacency ADCIRCMODULES_EXPORT &adjacency() const;
+#endif
+
   void ADCIRCMODULES_EXPORT build();
 
   bool ADCIRCMODULES_EXPORT initialized() const;
@@ -52,8 +60,7 @@ class FaceTable {
  private:
   bool m_initialized;
   std::vector<Face> m_table;
-  std::vector<std::vector<Element *>> m_elementNeighbors;
-  std::vector<std::vector<Face *>> m_sharedFaces;
+  CsrAdjacency m_elementNeighbors;
   Adcirc::Private::MeshPrivate *m_mesh;
 };
 }  // namespace Geometry
@@ -0,0 +1,156 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "FeatureTable.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace Adcirc::FileIO;
+
+/**
+ * @brief Constructor
+ * @param type geometry type of every feature in the table
+ * @param hasZ true if the vertices carry a z-value
+ */
+FeatureTable::FeatureTable(GeometryType type, bool hasZ)
+    : m_type(type), m_hasZ(hasZ), m_offsets(1, 0) {}
+
+/**
+ * @brief Adds an attribute field to the table
+ * @param name field name
+ * @param type field type
+ * @param width formatted width of the field for fixed width formats
+ * @param precision number of decimal places for fixed width formats
+ * @return index of the field
+ */
+size_t FeatureTable::addField(const std::string &name, FieldType type,
+                              int width, int precision) {
+  Field f;
+  f.name = name;
+  f.type = type;
+  f.width = width;
+  f.precision = precision;
+  this->allocateField(f);
+  this->m_fields.push_back(std::move(f));
+  return this->m_fields.size() - 1;
+}
+
+/**
+ * @brief Allocates storage for features with the same number of vertices
+ * @param numFeatures number of features
+ * @param verticesPerFeature number of vertices in each feature
+ */
+void FeatureTable::allocate(size_t numFeatures, size_t verticesPerFeature) {
+  this->m_offsets.resize(numFeatures + 1);
+  for (size_t i = 0; i <= numFeatures; ++i) {
+    this->m_offsets[i] = i * verticesPerFeature;
+  }
+  this->allocate(std::vector<size_t>());
+}
+
+/**
+ * @brief Allocates storage for features with varying numbers of vertices
+ * @param verticesPerFeature number of vertices in each feature. If empty, the
+ * current offsets are kept
+ */
+void FeatureTable::allocate(const std::vector<size_t> &verticesPerFeature) {
+  if (!verticesPerFeature.empty()) {
+    this->m_offsets.resize(verticesPerFeature.size() + 1);
+    this->m_offsets[0] = 0;
+    for (size_t i = 0; i < verticesPerFeature.size(); ++i) {
+      this->m_offsets[i + 1] = this->m_offsets[i] + verticesPerFeature[i];
+    }
+  }
+
+  const size_t nv = this->m_offsets.back();
+  this->m_x.resize(nv);
+  this->m_y.resize(nv);
+  if (this->m_hasZ) this->m_z.resize(nv);
+
+  for (auto &f : this->m_fields) {
+    this->allocateField(f);
+  }
+}
+
+void FeatureTable::allocateField(Field &f) {
+  if (f.type == FieldInteger) {
+    f.integers.resize(this->numFeatures());
+  } else {
+    f.doubles.resize(this->numFeatures());
+  }
+}
+
+/**
+ * @brief Geometry type of the features
+ * @return geometry type
+ */
+FeatureTable::GeometryType FeatureTable::geometryType() const {
+  return this->m_type;
+}
+
+/**
+ * @brief Returns true if the vertices carry a z-value
+ * @return true if z-values are stored
+ */
+bool FeatureTable::hasZ() const { return this->m_hasZ; }
+
+/**
+ * @brief Number of features in the table
+ * @return number of features
+ */
+size_t FeatureTable::numFeatures() const { return this->m_offsets.size() - 1; }
+
+/**
+ * @brief Number of attribute fields in the table
+ * @return number of fields
+ */
+size_t FeatureTable::numFields() const { return this->m_fields.size(); }
+
+/**
+ * @brief Number of vertices over all features
+ * @return number of vertices
+ */
+size_t FeatureTable::totalVertices() const { return this->m_offsets.back(); }
+
+/**
+ * @brief Returns an attribute field
+ * @param index field index
+ * @return reference to the field
+ */
+const FeatureTable::Field &FeatureTable::field(size_t index) const {
+  assert(index < this->m_fields.size());
+  return this->m_fields[index];
+}
+
+/**
+ * @brief Bounding box of all vertices as xmin, ymin, xmax, ymax, zmin, zmax
+ * @return vector of extents
+ */
+std::vector<double> FeatureTable::extent() const {
+  if (this->m_x.empty()) return std::vector<double>(6, 0.0);
+  const auto xr = std::minmax_element(this->m_x.begin(), this->m_x.end());
+  const auto yr = std::minmax_element(this->m_y.begin(), this->m_y.end());
+  double zmin = 0.0, zmax = 0.0;
+  if (this->m_hasZ) {
+    const auto zr = std::minmax_element(this->m_z.begin(), this->m_z.end());
+    zmin = *zr.first;
+    zmax = *zr.second;
+  }
+  return {*xr.first, *yr.first, *xr.second, *yr.second, zmin, zmax};
+}
@@ -0,0 +1,133 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_FEATURETABLE_H
+#define ADCMOD_FEATURETABLE_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Adcirc {
+namespace FileIO {
+
+/**
+ * @class FeatureTable
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Columnar storage of vector features and their attributes
+ *
+ * Vertex coordinates for all features are held in flat arrays with an offset
+ * array marking where each feature begins. Each attribute field is a single
+ * array with one entry per feature. Since each feature owns a disjoint range
+ * of every array, the table can be filled in parallel and handed to a writer
+ * without creating an object per feature.
+ *
+ * Polygons are stored as a single closed ring in clockwise order.
+ */
+class FeatureTable {
+ public:
+  enum GeometryType { FeaturePoint, FeatureLineString, FeaturePolygon };
+  enum FieldType { FieldInteger, FieldDouble };
+
+  struct Field {
+    std::string name;
+    FieldType type;
+    int width;
+    int precision;
+    std::vector<int64_t> integers;
+    std::vector<double> doubles;
+  };
+
+  FeatureTable(GeometryType type, bool hasZ);
+
+  size_t addField(const std::string &name, FieldType type, int width = 16,
+                  int precision = 0);
+
+  void allocate(size_t numFeatures, size_t verticesPerFeature);
+  void allocate(const std::vector<size_t> &verticesPerFeature);
+
+  GeometryType geometryType() const;
+  bool hasZ() const;
+
+  size_t numFeatures() const;
+  size_t numFields() const;
+  size_t totalVertices() const;
+
+  const Field &field(size_t index) const;
+
+  std::vector<double> extent() const;
+
+  size_t vertexOffset(size_t feature) const {
+    assert(feature < m_offsets.size());
+    return m_offsets[feature];
+  }
+
+  size_t numVertices(size_t feature) const {
+    assert(feature + 1 < m_offsets.size());
+    return m_offsets[feature + 1] - m_offsets[feature];
+  }
+
+  double x(size_t vertex) const { return m_x[vertex]; }
+  double y(size_t vertex) const { return m_y[vertex]; }
+  double z(size_t vertex) const { return m_hasZ ? m_z[vertex] : 0.0; }
+
+  void setVertex(size_t vertex, double x, double y, double z = 0.0) {
+    assert(vertex < m_x.size());
+    m_x[vertex] = x;
+    m_y[vertex] = y;
+    if (m_hasZ) m_z[vertex] = z;
+  }
+
+  int64_t integer(size_t field, size_t feature) const {
+    return m_fields[field].integers[feature];
+  }
+
+  double real(size_t field, size_t feature) const {
+    return m_fields[field].doubles[feature];
+  }
+
+  void setInteger(size_t field, size_t feature, int64_t value) {
+    assert(m_fields[field].type == FieldInteger);
+    m_fields[field].integers[feature] = value;
+  }
+
+  void setDouble(size_t field, size_t feature, double value) {
+    assert(m_fields[field].type == FieldDouble);
+    m_fields[field].doubles[feature] = value;
+  }
+
+ private:
+  void allocateField(Field &f);
+
+  GeometryType m_type;
+  bool m_hasZ;
+  std::vector<size_t> m_offsets;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_z;
+  std::vector<Field> m_fields;
+};
+
+}  // namespace FileIO
+}  // namespace Adcirc
+
+#endif  // ADCMOD_FEATURETABLE_H
@@ -20,6 +20,17 @@ enum MeshFormat {
   /// Deltares D-Flow FM format (*_net.nc)
   MeshDFlow = 0x205
 };
+
+enum MeshFeature {
+  /// Mesh nodes as points
+  FeatureNodes = 0x401,
+  /// Mesh elements as polygons
+  FeatureElements = 0x402,
+  /// Unique element edges as lines
+  FeatureConnectivity = 0x403,
+  /// Boundary condition nodes as points
+  FeatureBoundaries = 0x404
+};
 }
 
 namespace Harmonics {
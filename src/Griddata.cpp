@@ -36,7 +36,30 @@ Griddata::Griddata(const std::vector<double> &x, const std::vector<double> &y,
                    std::vector<double> resolution,
                    const std::string &rasterFile, int epsgQuery, int epsgRaster)
     : m_impl(std::make_unique<Adcirc::Private::GriddataPrivate>(
-          x, y, std::move(resolution), rasterFile, epsgQuery, epsgRaster)) {}
+          x, y, std::move(resolution), std::vector<std::string>{rasterFile},
+          epsgQuery, epsgRaster, std::vector<int>())) {}
+
+/**
+ * @brief Constructor which uses discrete point locations and a mosaic of
+ * rasters
+ * @param[in] x vector of query x locations
+ * @param[in] y vector of query y locations
+ * @param[in] resolution vector of representative sizes near these points. Used
+ * for various sizing functions
+ * @param[in] rasterFiles gdal compatible raster file names
+ * @param[in] epsgQuery coordinate system for the input point data
+ * @param[in] epsgRaster coordinate system for the raster data
+ * @param[in] priorities priority of each raster. Where rasters overlap, the
+ * raster with the highest priority that returns a value is used. If empty, the
+ * rasters are used in the order they are listed
+ */
+Griddata::Griddata(const std::vector<double> &x, const std::vector<double> &y,
+                   std::vector<double> resolution,
+                   const std::vector<std::string> &rasterFiles, int epsgQuery,
+                   int epsgRaster, const std::vector<int> &priorities)
+    : m_impl(std::make_unique<Adcirc::Private::GriddataPrivate>(
+          x, y, std::move(resolution), rasterFiles, epsgQuery, epsgRaster,
+          priorities)) {}
 
 /**
  * @brief Constructor that takes mesh and raster file
@@ -47,7 +70,23 @@ Griddata::Griddata(const std::vector<double> &x, const std::vector<double> &y,
 Griddata::Griddata(Adcirc::Geometry::Mesh *mesh, const std::string &rasterFile,
                    int epsgRaster)
     : m_impl(std::make_unique<Adcirc::Private::GriddataPrivate>(
-          mesh, rasterFile, epsgRaster)) {}
+          mesh, std::vector<std::string>{rasterFile}, epsgRaster,
+          std::vector<int>())) {}
+
+/**
+ * @brief Constructor that takes mesh and a mosaic of raster files
+ * @param[in] mesh pointer to mesh object
+ * @param[in] rasterFiles gdal compatible raster file names
+ * @param[in] epsgRaster coordinate system for the raster data
+ * @param[in] priorities priority of each raster. Where rasters overlap, the
+ * raster with the highest priority that returns a value is used. If empty, the
+ * rasters are used in the order they are listed
+ */
+Griddata::Griddata(Adcirc::Geometry::Mesh *mesh,
+                   const std::vector<std::string> &rasterFiles, int epsgRaster,
+                   const std::vector<int> &priorities)
+    : m_impl(std::make_unique<Adcirc::Private::GriddataPrivate>(
+          mesh, rasterFiles, epsgRaster, priorities)) {}
 
 /**
  * @brief Retrieves the filename of the raster currently being used for
@@ -426,6 +465,58 @@ void Griddata::setRasterInMemory(bool rasterInMemory) {
   this->m_impl->setRasterInMemory(rasterInMemory);
 }
 
+/**
+ * @brief Returns true if summed area tables are used to compute the average,
+ * highest and standard deviation methods
+ * @return true if integral tables are used
+ */
+bool Griddata::useIntegralTables() const {
+  return this->m_impl->useIntegralTables();
+}
+
+/**
+ * @brief Enables the use of summed area tables and a maximum pyramid when
+ * computing the average, highest and standard deviation methods
+ * @param[in] useIntegralTables true if integral tables should be used
+ *
+ * The raster is read into memory and the tables are built once before the
+ * interpolation begins. Window sums are then computed from the tables
+ * instead of visiting every pixel in the search radius, which is
+ * significantly faster for large filter sizes. The tables are not used with
+ * lookup tables or thresholding. Note that the tables require roughly three
+ * times the memory of the raster itself.
+ */
+void Griddata::setUseIntegralTables(bool useIntegralTables) {
+  this->m_impl->setUseIntegralTables(useIntegralTables);
+}
+
+/**
+ * @brief Returns the fraction of the search radius used to select a reduced
+ * resolution raster
+ * @return overview fraction. Zero when disabled
+ */
+double Griddata::rasterOverviewFraction() const {
+  return this->m_impl->rasterOverviewFraction();
+}
+
+/**
+ * @brief Enables the use of reduced resolution rasters for large search radii
+ * @param[in] rasterOverviewFraction fraction of the search radius that the
+ * pixel size must be below. Zero (default) always uses the full resolution
+ * raster
+ *
+ * For each query point, the coarsest raster with a pixel size below the given
+ * fraction of the search radius is used. Overviews stored with the raster
+ * (i.e. generated by gdaladdo) are used when available. Otherwise, the raster
+ * is read into memory and reduced resolution copies are generated by
+ * averaging 2x2 blocks of pixels. This only applies to the Average and
+ * InverseDistanceWeighted methods, so that coarse offshore nodes with large
+ * radii do not need to read millions of full resolution pixels.
+ */
+void Griddata::setRasterOverviewFraction(double rasterOverviewFraction) {
+  this->m_impl->setRasterOverviewFraction(rasterOverviewFraction);
+}
+
 /**
  * @brief Returns the datum shift that is added to the interpolated value
  * @return datum shift value
@@ -69,8 +69,22 @@ class Griddata {
                                 const std::string &rasterFile, int epsgQuery,
                                 int epsgRaster);
 
+  ADCIRCMODULES_EXPORT Griddata(const std::vector<double> &x,
+                                const std::vector<double> &y,
+                                std::vector<double> resolution,
+                                const std::vector<std::string> &rasterFiles,
+                                int epsgQuery, int epsgRaster,
+                                const std::vector<int> &priorities =
+                                    std::vector<int>());
+
   ADCIRCMODULES_EXPORT Griddata(Adcirc::Geometry::Mesh *mesh,
                                 const std::string &rasterFile, int epsgRaster);
+
+  ADCIRCMODULES_EXPORT Griddata(Adcirc::Geometry::Mesh *mesh,
+                                const std::vector<std::string> &rasterFiles,
+                                int epsgRaster,
+                                const std::vector<int> &priorities =
+                                    std::vector<int>());
   ADCIRCMODULES_EXPORT ~Griddata();
 
   std::string ADCIRCMODULES_EXPORT rasterFile() const;
@@ -127,6 +141,13 @@ class Griddata {
   bool ADCIRCMODULES_EXPORT rasterInMemory() const;
   void ADCIRCMODULES_EXPORT setRasterInMemory(bool rasterInMemory);
 
+  bool ADCIRCMODULES_EXPORT useIntegralTables() const;
+  void ADCIRCMODULES_EXPORT setUseIntegralTables(bool useIntegralTables);
+
+  double ADCIRCMODULES_EXPORT rasterOverviewFraction() const;
+  void ADCIRCMODULES_EXPORT
+  setRasterOverviewFraction(double rasterOverviewFraction);
+
   double ADCIRCMODULES_EXPORT datumShift() const;
   void ADCIRCMODULES_EXPORT setDatumShift(double datumShift);
 
@@ -46,15 +46,19 @@ using namespace Adcirc::Private;
 
 Griddata::~Griddata() = default;
 
-GriddataPrivate::GriddataPrivate(Mesh *mesh, const std::string &rasterFile,
-                                 int epsgRaster)
+GriddataPrivate::GriddataPrivate(Mesh *mesh,
+                                 const std::vector<std::string> &rasterFiles,
+                                 int epsgRaster,
+                                 const std::vector<int> &priorities)
     : m_config(GriddataConfig(false, NoThreshold, 0.0, 0.0, 1.0, -9999.0,
                               std::vector<double>())),
-      m_raster(std::make_unique<Adcirc::Raster::Rasterdata>(rasterFile)),
-      m_rasterFile(rasterFile),
+      m_rasters(GriddataPrivate::generateMosaic(rasterFiles, priorities)),
+      m_rasterFile(rasterFiles.front()),
       m_epsg(epsgRaster),
       m_showProgressBar(false),
-      m_rasterInMemory(false) {
+      m_rasterInMemory(false),
+      m_useIntegralTables(false),
+      m_rasterOverviewFraction(0.0) {
   auto locations =
       Adcirc::Private::GriddataPrivate::meshToQueryPoints(mesh, epsgRaster);
   auto resolution = mesh->computeMeshSize(epsgRaster);
@@ -71,15 +75,18 @@ GriddataPrivate::GriddataPrivate(Mesh *mesh, const std::string &rasterFile,
 GriddataPrivate::GriddataPrivate(const std::vector<double> &x,
                                  const std::vector<double> &y,
                                  const std::vector<double> &resolution,
-                                 const std::string &rasterFile, int epsgQuery,
-                                 int epsgRaster)
+                                 const std::vector<std::string> &rasterFiles,
+                                 int epsgQuery, int epsgRaster,
+                                 const std::vector<int> &priorities)
     : m_config(GriddataConfig(false, NoThreshold, 0.0, 0.0, 1.0, -9999.0,
                               std::vector<double>())),
-      m_raster(std::make_unique<Adcirc::Raster::Rasterdata>(rasterFile)),
-      m_rasterFile(rasterFile),
+      m_rasters(GriddataPrivate::generateMosaic(rasterFiles, priorities)),
+      m_rasterFile(rasterFiles.front()),
       m_epsg(epsgRaster),
       m_showProgressBar(false),
-      m_rasterInMemory(false) {
+      m_rasterInMemory(false),
+      m_useIntegralTables(false),
+      m_rasterOverviewFraction(0.0) {
   assert(!x.empty());
   assert(x.size() == y.size());
 
@@ -100,6 +107,33 @@ GriddataPrivate::GriddataPrivate(const std::vector<double> &x,
   }
 }
 
+/**
+ * @brief Generates the raster mosaic from the list of files
+ * @param rasterFiles list of raster files
+ * @param priorities priority of each raster, higher values are used first. If
+ * empty, the rasters are prioritized in the order they are listed
+ * @return raster mosaic
+ */
+std::unique_ptr<Adcirc::Raster::RasterMosaic> GriddataPrivate::generateMosaic(
+    const std::vector<std::string> &rasterFiles,
+    const std::vector<int> &priorities) {
+  if (rasterFiles.empty()) {
+    adcircmodules_throw_exception("No raster files were specified");
+  }
+  if (!priorities.empty() && priorities.size() != rasterFiles.size()) {
+    adcircmodules_throw_exception(
+        "The number of raster priorities must match the number of rasters");
+  }
+  auto mosaic = std::make_unique<Adcirc::Raster::RasterMosaic>();
+  for (size_t i = 0; i < rasterFiles.size(); ++i) {
+    const int priority = priorities.empty()
+                             ? static_cast<int>(rasterFiles.size() - i)
+                             : priorities[i];
+    mosaic->addRaster(rasterFiles[i], priority);
+  }
+  return mosaic;
+}
+
 std::vector<Adcirc::Point> GriddataPrivate::meshToQueryPoints(
     Adcirc::Geometry::Mesh *m, int epsgRaster) {
   std::vector<Adcirc::Point> qp;
@@ -317,41 +351,164 @@ void GriddataPrivate::setRasterInMemory(bool rasterInMemory) {
   this->m_rasterInMemory = rasterInMemory;
 }
 
+bool GriddataPrivate::useIntegralTables() const {
+  return this->m_useIntegralTables;
+}
+
+void GriddataPrivate::setUseIntegralTables(bool useIntegralTables) {
+  this->m_useIntegralTables = useIntegralTables;
+}
+
+double GriddataPrivate::rasterOverviewFraction() const {
+  return this->m_rasterOverviewFraction;
+}
+
+void GriddataPrivate::setRasterOverviewFraction(double rasterOverviewFraction) {
+  this->m_rasterOverviewFraction = std::max(0.0, rasterOverviewFraction);
+}
+
+/**
+ * @brief Generates the list of reduced resolution rasters for each raster in
+ * the mosaic, ordered from finest to coarsest
+ *
+ * Overviews stored with the raster file are used when they are available.
+ * Otherwise, the raster is read into memory and successively downsampled
+ * until the pixel size is larger than any query will request.
+ */
+void GriddataPrivate::buildRasterLevels() {
+  this->m_rasterLevels.clear();
+  this->m_rasterLevels.resize(this->m_rasters->size());
+  if (this->m_rasterOverviewFraction <= 0.0) return;
+
+  double maxTarget = 0.0;
+  for (const auto &a : m_attributes) {
+    maxTarget = std::max(maxTarget,
+                         this->m_rasterOverviewFraction * a.queryResolution());
+  }
+
+  for (size_t t = 0; t < this->m_rasters->size(); ++t) {
+    auto raster = this->m_rasters->raster(t);
+    auto &levels = this->m_rasterLevels[t];
+    const size_t nOverviews = raster->overviewCount();
+    if (nOverviews > 0) {
+      for (size_t i = 0; i < nOverviews; ++i) {
+        auto ov = raster->overview(i);
+        if (ov) {
+          if (this->m_rasterInMemory) ov->read();
+          levels.push_back(std::move(ov));
+        }
+      }
+      std::sort(levels.begin(), levels.end(),
+                [](const std::unique_ptr<Adcirc::Raster::Rasterdata> &a,
+                   const std::unique_ptr<Adcirc::Raster::Rasterdata> &b) {
+                  return a->dx() < b->dx();
+                });
+    } else {
+      raster->read();
+      const Adcirc::Raster::Rasterdata *r = raster;
+      while (r->nx() > 2 && r->ny() > 2 &&
+             std::max(r->dx(), r->dy()) * 2.0 <= maxTarget) {
+        levels.push_back(r->downsample());
+        r = levels.back().get();
+      }
+    }
+  }
+}
+
+/**
+ * @brief Selects the raster to use for a query point
+ * @param tile index of the raster in the mosaic
+ * @param index query point index
+ * @param method interpolation method being used
+ * @return coarsest raster with a pixel size smaller than the overview
+ * fraction of the query radius, or the full resolution raster
+ *
+ * Only the averaging methods use the reduced resolution rasters since the
+ * other methods depend on individual pixel values
+ */
+const Adcirc::Raster::Rasterdata *GriddataPrivate::selectRaster(
+    size_t tile, size_t index, const Interpolation::Method &method) const {
+  const Adcirc::Raster::Rasterdata *r = this->m_rasters->raster(tile);
+  if (tile >= this->m_rasterLevels.size() ||
+      this->m_rasterLevels[tile].empty() ||
+      (method != Average && method != InverseDistanceWeighted)) {
+    return r;
+  }
+  const double target =
+      this->m_rasterOverviewFraction * m_attributes[index].queryResolution();
+  for (const auto &level : this->m_rasterLevels[tile]) {
+    if (std::max(level->dx(), level->dy()) > target) break;
+    r = level.get();
+  }
+  return r;
+}
+
+/**
+ * @brief Computes the value at a query point using the rasters in the mosaic
+ * @param index query point index
+ * @param method interpolation method to use
+ * @return interpolated value
+ *
+ * The rasters that overlap the search radius are tried from highest to lowest
+ * priority until one returns a value. If none do, the result from the last
+ * raster is returned.
+ */
 double GriddataPrivate::calculatePoint(const size_t index,
                                        const Interpolation::Method &method) {
+  if (method == NoMethod) return this->defaultValue();
+  const auto &a = m_attributes[index];
+  const auto tiles = this->m_rasters->candidates(
+      a.point().x(), a.point().y(), a.queryResolution());
+  if (tiles.empty()) {
+    return this->calculatePoint(this->m_rasters->primary(), index, method);
+  }
+
+  double v = GriddataMethod::methodErrorValue();
+  for (const auto t : tiles) {
+    v = this->calculatePoint(t, index, method);
+    if (v != GriddataMethod::methodErrorValue() && v != this->defaultValue()) {
+      break;
+    }
+  }
+  return v;
+}
+
+double GriddataPrivate::calculatePoint(const size_t tile, const size_t index,
+                                       const Interpolation::Method &method) {
   std::unique_ptr<GriddataMethod> calc_method;
+  const auto raster = this->selectRaster(tile, index, method);
   switch (method) {
     case Average:
       calc_method = std::make_unique<GriddataAverage>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     case Nearest:
       calc_method = std::make_unique<GriddataNearest>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     case Highest:
       calc_method = std::make_unique<GriddataHighest>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     case PlusTwoSigma:
       calc_method = std::make_unique<GriddataStandardDeviation>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     case BilskieEtAll:
       calc_method = std::make_unique<GriddataBilskie>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     case InverseDistanceWeighted:
       calc_method = std::make_unique<GriddataInverseDistanceWeighted>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     case InverseDistanceWeightedNPoints:
       calc_method = std::make_unique<GriddataInverseDistanceWeightedNPoints>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     case AverageNearestNPoints:
       calc_method = std::make_unique<GriddataAverageNearestNPoints>(
-          m_raster.get(), &m_attributes[index], &m_config);
+          raster, &m_attributes[index], &m_config);
       break;
     default:
       return this->defaultValue();
@@ -369,12 +526,11 @@ void GriddataPrivate::setThresholdMethod(
 }
 
 std::vector<double> GriddataPrivate::extents() const {
-  if (this->m_raster) {
-    if (!this->m_raster->isOpen()) {
-      this->m_raster->open();
+  if (this->m_rasters) {
+    if (!this->m_rasters->isOpen()) {
+      this->m_rasters->open();
     }
-    return std::vector<double>{this->m_raster->xmin(), this->m_raster->ymin(),
-                               this->m_raster->xmax(), this->m_raster->ymax()};
+    return this->m_rasters->extents();
   } else {
     return std::vector<double>(4);
   }
@@ -397,8 +553,8 @@ void GriddataPrivate::setDatumShift(double datumShift) {
 }
 
 void GriddataPrivate::checkRasterOpen() {
-  if (!this->m_raster->isOpen()) {
-    bool success = this->m_raster->open();
+  if (!this->m_rasters->isOpen()) {
+    bool success = this->m_rasters->open();
     if (!success) {
       adcircmodules_throw_exception("Could not open the raster file.");
     }
@@ -410,26 +566,38 @@ std::vector<double> GriddataPrivate::computeValuesFromRaster(
   this->checkRasterOpen();
   ProgressBar progress(m_attributes.size());
 
-  if (this->m_rasterInMemory) {
-    this->m_raster->read();
+  for (size_t t = 0; t < this->m_rasters->size(); ++t) {
+    if (this->m_rasterInMemory || this->m_useIntegralTables) {
+      this->m_rasters->raster(t)->read();
+    }
+    if (this->m_useIntegralTables && !useLookupTable) {
+      this->m_rasters->raster(t)->buildIntegralTables();
+    }
   }
 
+  this->buildRasterLevels();
+
   this->m_config.setUseLookup(useLookupTable);
 
   std::vector<double> result(m_attributes.size(), m_config.defaultValue());
 
   if (this->showProgressBar()) progress.begin();
 
-#pragma omp parallel for schedule(dynamic) default(none) \
-    shared(progress, result, useLookupTable)
-  for (size_t i = 0; i < m_attributes.size(); ++i) {
-    if (this->m_showProgressBar) progress.tick();
-    if (m_attributes[i].interpolationFlag() != Interpolation::NoMethod) {
-      double v = this->calculatePoint(i, m_attributes[i].interpolationFlag());
-      if (v == GriddataMethod::methodErrorValue()) {
-        v = this->calculatePoint(i, m_attributes[i].backupFlag());
+#pragma omp parallel default(none) shared(progress, result, useLookupTable)
+  {
+    ProgressBar::LocalCounter counter(&progress);
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < m_attributes.size(); ++i) {
+      if (this->m_showProgressBar) counter.tick();
+      if (m_attributes[i].interpolationFlag() != Interpolation::NoMethod) {
+        double v =
+            this->calculatePoint(i, m_attributes[i].interpolationFlag());
+        if (v == GriddataMethod::methodErrorValue()) {
+          v = this->calculatePoint(i, m_attributes[i].backupFlag());
+        }
+        result[i] = v;
       }
-      result[i] = v;
     }
   }
 
@@ -443,7 +611,9 @@ GriddataPrivate::computeDirectionalWindReduction(bool useLookupTable) {
   this->checkRasterOpen();
 
   if (this->m_rasterInMemory) {
-    this->m_raster->read();
+    for (size_t t = 0; t < this->m_rasters->size(); ++t) {
+      this->m_rasters->raster(t)->read();
+    }
   }
 
   this->m_config.setUseLookup(useLookupTable);
@@ -454,12 +624,21 @@ GriddataPrivate::computeDirectionalWindReduction(bool useLookupTable) {
   ProgressBar progress(m_attributes.size());
   if (this->showProgressBar()) progress.begin();
 
-#pragma omp parallel for schedule(dynamic) default(none) \
-    shared(progress, result, useLookupTable)
-  for (size_t i = 0; i < m_attributes.size(); ++i) {
-    if (this->m_showProgressBar) progress.tick();
-    GriddataWindRoughness wind(m_raster.get(), &m_attributes[i], &m_config);
-    result[i] = wind.computeMultiple();
+#pragma omp parallel default(none) shared(progress, result, useLookupTable)
+  {
+    ProgressBar::LocalCounter counter(&progress);
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < m_attributes.size(); ++i) {
+      if (this->m_showProgressBar) counter.tick();
+      const auto tiles = this->m_rasters->candidates(
+          m_attributes[i].point().x(), m_attributes[i].point().y(), 0.0);
+      const size_t tile =
+          tiles.empty() ? this->m_rasters->primary() : tiles.front();
+      GriddataWindRoughness wind(this->m_rasters->raster(tile),
+                                 &m_attributes[i], &m_config);
+      result[i] = wind.computeMultiple();
+    }
   }
 
   if (this->m_showProgressBar) progress.end();
@@ -33,6 +33,7 @@
 #include "PixelValueVector.h"
 #include "Point.h"
 #include "RasterData.h"
+#include "RasterMosaic.h"
 
 namespace Adcirc {
 namespace Private {
@@ -41,10 +42,12 @@ class GriddataPrivate {
  public:
   GriddataPrivate(const std::vector<double> &x, const std::vector<double> &y,
                   const std::vector<double> &resolution,
-                  const std::string &rasterFile, int epsgQuery, int epsgRaster);
+                  const std::vector<std::string> &rasterFiles, int epsgQuery,
+                  int epsgRaster, const std::vector<int> &priorities);
 
-  GriddataPrivate(Adcirc::Geometry::Mesh *mesh, const std::string &rasterFile,
-                  int epsgRaster);
+  GriddataPrivate(Adcirc::Geometry::Mesh *mesh,
+                  const std::vector<std::string> &rasterFiles, int epsgRaster,
+                  const std::vector<int> &priorities);
 
   std::string rasterFile() const;
   void setRasterFile(const std::string &rasterFile);
@@ -90,6 +93,12 @@ class GriddataPrivate {
   bool rasterInMemory() const;
   void setRasterInMemory(bool rasterInMemory);
 
+  bool useIntegralTables() const;
+  void setUseIntegralTables(bool useIntegralTables);
+
+  double rasterOverviewFraction() const;
+  void setRasterOverviewFraction(double rasterOverviewFraction);
+
   double datumShift() const;
   void setDatumShift(double datumShift);
 
@@ -105,16 +114,29 @@ class GriddataPrivate {
 
  private:
   double calculatePoint(size_t index, const Interpolation::Method &method);
+  double calculatePoint(size_t tile, size_t index,
+                        const Interpolation::Method &method);
 
   void checkRasterOpen();
 
+  void buildRasterLevels();
+
+  const Adcirc::Raster::Rasterdata *selectRaster(
+      size_t tile, size_t index, const Interpolation::Method &method) const;
+
+  static std::unique_ptr<Adcirc::Raster::RasterMosaic> generateMosaic(
+      const std::vector<std::string> &rasterFiles,
+      const std::vector<int> &priorities);
+
   static std::vector<Point> meshToQueryPoints(Adcirc::Geometry::Mesh *m,
                                               int epsgRaster);
 
   static std::vector<Point> convertQueryPointCoordinates(
       const std::vector<Point> &input, int epsgInput, int epsgOutput);
 
-  std::unique_ptr<Adcirc::Raster::Rasterdata> m_raster;
+  std::unique_ptr<Adcirc::Raster::RasterMosaic> m_rasters;
+  std::vector<std::vector<std::unique_ptr<Adcirc::Raster::Rasterdata>>>
+      m_rasterLevels;
   std::vector<Adcirc::Private::GriddataAttribute> m_attributes;
   Adcirc::Private::GriddataConfig m_config;
 
@@ -124,6 +146,8 @@ class GriddataPrivate {
 
   bool m_showProgressBar;
   bool m_rasterInMemory;
+  bool m_useIntegralTables;
+  double m_rasterOverviewFraction;
 };
 
 }  // namespace Private
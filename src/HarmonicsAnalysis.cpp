@@ -0,0 +1,422 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "HarmonicsAnalysis.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "HarmonicsOutput.h"
+#include "Logging.h"
+
+using namespace Adcirc::Harmonics;
+
+namespace {
+
+/**
+ * @brief Cholesky factorization of a symmetric positive definite matrix
+ * @param[inout] a row major n x n matrix. Replaced by the lower triangular
+ * factor
+ * @param[in] n matrix dimension
+ * @return false if the matrix is singular or not positive definite
+ */
+bool choleskyFactor(double *a, size_t n) {
+  for (size_t j = 0; j < n; ++j) {
+    const double diagonal = a[j * n + j];
+    double d = diagonal;
+    for (size_t k = 0; k < j; ++k) {
+      d -= a[j * n + k] * a[j * n + k];
+    }
+    if (!(d > 1e-12 * diagonal)) return false;
+    const double ljj = std::sqrt(d);
+    a[j * n + j] = ljj;
+    for (size_t i = j + 1; i < n; ++i) {
+      double s = a[i * n + j];
+      for (size_t k = 0; k < j; ++k) {
+        s -= a[i * n + k] * a[j * n + k];
+      }
+      a[i * n + j] = s / ljj;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Solves L * L^T * x = b using a Cholesky factor
+ * @param[in] l row major lower triangular factor
+ * @param[in] n matrix dimension
+ * @param[inout] x right hand side, replaced by the solution
+ */
+void choleskySolve(const double *l, size_t n, double *x) {
+  for (size_t i = 0; i < n; ++i) {
+    double s = x[i];
+    for (size_t k = 0; k < i; ++k) {
+      s -= l[i * n + k] * x[k];
+    }
+    x[i] = s / l[i * n + i];
+  }
+  for (size_t i = n; i-- > 0;) {
+    double s = x[i];
+    for (size_t k = i + 1; k < n; ++k) {
+      s -= l[k * n + i] * x[k];
+    }
+    x[i] = s / l[i * n + i];
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor
+ * @param numNodes number of nodes in the data that will be analyzed
+ * @param isVelocity true if the data has u and v components
+ */
+HarmonicsAnalysis::HarmonicsAnalysis(size_t numNodes, bool isVelocity)
+    : m_numNodes(numNodes),
+      m_isVelocity(isVelocity),
+      m_defaultValue(-99999.0),
+      m_numSnaps(0),
+      m_numColumns(0) {}
+
+/**
+ * @brief Adds a constituent to the analysis. Constituents must be added
+ * before any data
+ * @param name constituent name
+ * @param frequency frequency, rad/s. Use 0 for the steady term
+ * @param nodalFactor nodal factor
+ * @param equilibriumArg equilibrium argument, degrees
+ */
+void HarmonicsAnalysis::addConstituent(const std::string &name,
+                                       double frequency, double nodalFactor,
+                                       double equilibriumArg) {
+  if (this->m_numSnaps > 0) {
+    adcircmodules_throw_exception(
+        "HarmonicsAnalysis: Constituents must be added before data");
+  }
+  if (nodalFactor == 0.0) {
+    adcircmodules_throw_exception(
+        "HarmonicsAnalysis: Nodal factor must be nonzero");
+  }
+  this->m_names.push_back(name);
+  this->m_frequency.push_back(frequency);
+  this->m_nodalFactor.push_back(nodalFactor);
+  this->m_equilibriumArg.push_back(equilibriumArg);
+  this->m_numColumns = 0;
+}
+
+size_t HarmonicsAnalysis::numConstituents() const {
+  return this->m_names.size();
+}
+
+size_t HarmonicsAnalysis::numNodes() const { return this->m_numNodes; }
+
+/**
+ * @brief Number of snaps added to the analysis
+ * @return number of snaps
+ */
+size_t HarmonicsAnalysis::numSnaps() const { return this->m_numSnaps; }
+
+bool HarmonicsAnalysis::isVelocity() const { return this->m_isVelocity; }
+
+/**
+ * @brief Value used to mark dry or missing nodes
+ * @return default value
+ */
+double HarmonicsAnalysis::defaultValue() const { return this->m_defaultValue; }
+
+/**
+ * @brief Sets the value used to mark dry or missing nodes. Nodes with this
+ * value are left out of the analysis for that snap
+ * @param defaultValue default value
+ */
+void HarmonicsAnalysis::setDefaultValue(double defaultValue) {
+  this->m_defaultValue = defaultValue;
+}
+
+/**
+ * @brief Clears all data added to the analysis. The constituents are kept
+ */
+void HarmonicsAnalysis::reset() {
+  this->m_numSnaps = 0;
+  this->m_numColumns = 0;
+  this->m_normal.clear();
+  this->m_rhs.clear();
+  this->m_missing.clear();
+}
+
+void HarmonicsAnalysis::buildColumns() {
+  if (this->m_names.empty()) {
+    adcircmodules_throw_exception("HarmonicsAnalysis: No constituents added");
+  }
+
+  const size_t nc = this->numConstituents();
+  this->m_cosColumn.resize(nc);
+  this->m_sinColumn.resize(nc);
+
+  size_t column = 0;
+  for (size_t c = 0; c < nc; ++c) {
+    this->m_cosColumn[c] = column++;
+  }
+  for (size_t c = 0; c < nc; ++c) {
+    if (this->m_frequency[c] != 0.0) {
+      this->m_sinColumn[c] = column++;
+    }
+  }
+  this->m_numColumns = column;
+  for (size_t c = 0; c < nc; ++c) {
+    if (this->m_frequency[c] == 0.0) {
+      this->m_sinColumn[c] = this->m_numColumns;
+    }
+  }
+
+  const size_t nComponents = this->m_isVelocity ? 2 : 1;
+  this->m_normal.assign(this->m_numColumns * this->m_numColumns, 0.0);
+  this->m_rhs.assign(nComponents * this->m_numColumns * this->m_numNodes, 0.0);
+  this->m_missing.clear();
+}
+
+void HarmonicsAnalysis::basis(double time, double *phi) const {
+  for (size_t c = 0; c < this->numConstituents(); ++c) {
+    const double arg = this->m_frequency[c] * time;
+    phi[this->m_cosColumn[c]] = std::cos(arg);
+    if (this->m_sinColumn[c] < this->m_numColumns) {
+      phi[this->m_sinColumn[c]] = std::sin(arg);
+    }
+  }
+}
+
+/**
+ * @brief Adds a snap to the analysis
+ * @param time time in seconds
+ * @param u water level or u-velocity at each node
+ * @param v v-velocity at each node. Required for velocity data
+ */
+void HarmonicsAnalysis::add(double time, const double *u, const double *v) {
+  if (this->m_isVelocity && v == nullptr) {
+    adcircmodules_throw_exception(
+        "HarmonicsAnalysis: Velocity analysis requires two components");
+  }
+  if (this->m_numColumns == 0) this->buildColumns();
+
+  const size_t nu = this->m_numColumns;
+  const size_t nn = this->m_numNodes;
+  const size_t nComponents = this->m_isVelocity ? 2 : 1;
+  const double defaultValue = this->m_defaultValue;
+
+  std::vector<double> phi(nu);
+  this->basis(time, phi.data());
+  for (size_t a = 0; a < nu; ++a) {
+    for (size_t b = 0; b < nu; ++b) {
+      this->m_normal[a * nu + b] += phi[a] * phi[b];
+    }
+  }
+
+  auto isMissing = [defaultValue](double z) {
+    return z == defaultValue || std::isnan(z);
+  };
+
+  const size_t numBlocks = (nn + c_blockSize - 1) / c_blockSize;
+  double *rhs = this->m_rhs.data();
+  std::vector<size_t> missing;
+
+#pragma omp parallel
+  {
+    std::vector<size_t> localMissing;
+    std::vector<double> buffer(2 * c_blockSize);
+
+#pragma omp for schedule(static)
+    for (size_t b = 0; b < numBlocks; ++b) {
+      const size_t i0 = b * c_blockSize;
+      const size_t i1 = std::min(nn, i0 + c_blockSize);
+      double *bu = buffer.data();
+      double *bv = buffer.data() + c_blockSize;
+      for (size_t i = i0; i < i1; ++i) {
+        const bool miss = isMissing(u[i]) || (v != nullptr && isMissing(v[i]));
+        bu[i - i0] = miss ? 0.0 : u[i];
+        if (v != nullptr) bv[i - i0] = miss ? 0.0 : v[i];
+        if (miss) localMissing.push_back(i);
+      }
+
+      for (size_t k = 0; k < nComponents; ++k) {
+        const double *value = k == 0 ? bu : bv;
+        for (size_t col = 0; col < nu; ++col) {
+          const double p = phi[col];
+          double *r = rhs + (k * nu + col) * nn;
+#pragma omp simd
+          for (size_t i = i0; i < i1; ++i) {
+            r[i] += p * value[i - i0];
+          }
+        }
+      }
+    }
+
+#pragma omp critical(harmonicsAnalysisMissing)
+    missing.insert(missing.end(), localMissing.begin(), localMissing.end());
+  }
+
+  for (auto node : missing) {
+    auto &m = this->m_missing[node];
+    if (m.empty()) m.assign(nu * nu, 0.0);
+    for (size_t a = 0; a < nu; ++a) {
+      for (size_t b = 0; b < nu; ++b) {
+        m[a * nu + b] += phi[a] * phi[b];
+      }
+    }
+  }
+
+  this->m_numSnaps++;
+}
+
+/**
+ * @brief Adds a snap to the analysis
+ * @param record output record. The record time is used as the snap time
+ */
+void HarmonicsAnalysis::add(Adcirc::Output::OutputRecord *record) {
+  if (record->numNodes() != this->m_numNodes) {
+    adcircmodules_throw_exception(
+        "HarmonicsAnalysis: Record size does not match the analysis");
+  }
+  if (this->m_isVelocity != record->metadata()->isVector()) {
+    adcircmodules_throw_exception(
+        "HarmonicsAnalysis: Record type does not match the analysis");
+  }
+  std::vector<double> u = record->values(0);
+  if (this->m_isVelocity) {
+    std::vector<double> v = record->values(1);
+    this->add(record->time(), u.data(), v.data());
+  } else {
+    this->add(record->time(), u.data());
+  }
+}
+
+/**
+ * @brief Adds every remaining snap in an output file to the analysis
+ * @param reader output file. Opened if it is not already open
+ *
+ * Snaps are read and released one at a time so that the file does not need
+ * to fit in memory. Any records already held by the reader are released.
+ */
+void HarmonicsAnalysis::add(Adcirc::Output::ReadOutput *reader) {
+  if (!reader->isOpen()) reader->open();
+  reader->clear();
+  for (size_t i = reader->currentSnap(); i < reader->numSnaps(); ++i) {
+    reader->read();
+    this->add(reader->dataAt(0));
+    reader->clearAt(0);
+  }
+}
+
+/**
+ * @brief Solves for the amplitude and phase of each constituent at each node
+ * @param output harmonics object to fill. It is initialized with the
+ * constituents and nodes of this analysis and can then be written as a
+ * fort.53/fort.54 or netCDF file
+ *
+ * Nodes that were missing in too many snaps to resolve the constituents are
+ * given an amplitude and phase of zero.
+ */
+void HarmonicsAnalysis::solve(HarmonicsOutput *output) const {
+  if (this->m_numColumns == 0 || this->m_numSnaps < this->m_numColumns) {
+    adcircmodules_throw_exception(
+        "HarmonicsAnalysis: Not enough snaps to resolve the constituents");
+  }
+
+  constexpr double rad2deg = 180.0 / M_PI;
+  const size_t nc = this->numConstituents();
+  const size_t nu = this->m_numColumns;
+  const size_t nn = this->m_numNodes;
+  const size_t nComponents = this->m_isVelocity ? 2 : 1;
+
+  std::vector<double> factor = this->m_normal;
+  if (!choleskyFactor(factor.data(), nu)) {
+    adcircmodules_throw_exception(
+        "HarmonicsAnalysis: Constituents cannot be separated with the data "
+        "provided");
+  }
+
+  output->initialize(this->m_names, this->m_frequency, this->m_nodalFactor,
+                     this->m_equilibriumArg, nn, this->m_isVelocity);
+
+  std::vector<double *> amplitude(nComponents * nc);
+  std::vector<double *> phase(nComponents * nc);
+  for (size_t c = 0; c < nc; ++c) {
+    if (this->m_isVelocity) {
+      amplitude[c] = output->u_amplitude(c)->data();
+      phase[c] = output->u_phase(c)->data();
+      amplitude[nc + c] = output->v_amplitude(c)->data();
+      phase[nc + c] = output->v_phase(c)->data();
+    } else {
+      amplitude[c] = output->amplitude(c)->data();
+      phase[c] = output->phase(c)->data();
+    }
+  }
+
+  size_t unresolved = 0;
+
+#pragma omp parallel
+  {
+    std::vector<double> local(nu * nu);
+    std::vector<double> x(nu + 1);
+
+#pragma omp for schedule(dynamic, c_blockSize) reduction(+ : unresolved)
+    for (size_t i = 0; i < nn; ++i) {
+      const double *l = factor.data();
+      auto it = this->m_missing.find(i);
+      bool ok = true;
+      if (it != this->m_missing.end()) {
+        for (size_t k = 0; k < nu * nu; ++k) {
+          local[k] = this->m_normal[k] - it->second[k];
+        }
+        ok = choleskyFactor(local.data(), nu);
+        l = local.data();
+      }
+      if (!ok) unresolved++;
+
+      for (size_t k = 0; k < nComponents; ++k) {
+        if (ok) {
+          for (size_t col = 0; col < nu; ++col) {
+            x[col] = this->m_rhs[(k * nu + col) * nn + i];
+          }
+          choleskySolve(l, nu, x.data());
+        }
+        x[nu] = 0.0;
+
+        for (size_t c = 0; c < nc; ++c) {
+          if (!ok) {
+            amplitude[k * nc + c][i] = 0.0;
+            phase[k * nc + c][i] = 0.0;
+            continue;
+          }
+          const double a = x[this->m_cosColumn[c]];
+          const double b = x[this->m_sinColumn[c]];
+          double g = std::atan2(b, a) * rad2deg + this->m_equilibriumArg[c];
+          g = std::fmod(g, 360.0);
+          if (g < 0.0) g += 360.0;
+          amplitude[k * nc + c][i] = std::hypot(a, b) / this->m_nodalFactor[c];
+          phase[k * nc + c][i] = g;
+        }
+      }
+    }
+  }
+
+  if (unresolved > 0) {
+    Adcirc::Logging::warning(
+        "HarmonicsAnalysis: " + std::to_string(unresolved) +
+        " nodes were missing too often to resolve the constituents");
+  }
+}
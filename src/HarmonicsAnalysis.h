@@ -0,0 +1,124 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_HARMONICSANALYSIS_H
+#define ADCMOD_HARMONICSANALYSIS_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "OutputRecord.h"
+#include "ReadOutput.h"
+
+namespace Adcirc {
+namespace Harmonics {
+
+class HarmonicsOutput;
+
+/**
+ * @class HarmonicsAnalysis
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Least squares harmonic analysis of water levels or velocities
+ *
+ * Each constituent contributes a cos(w * t) and a sin(w * t) column to the
+ * least squares problem, or a single column for a steady (zero frequency)
+ * term. The normal equations are accumulated one snap at a time, so the
+ * memory used depends on the number of nodes and constituents but not on the
+ * number of snaps. The normal matrix is the same at every node unless a node
+ * is missing values, so a single matrix is kept along with a correction for
+ * each node that has been dry. Only the right hand side is kept for every
+ * node. The system is solved at each node once all snaps have been added.
+ *
+ * Times are in seconds relative to the reference time used for the
+ * equilibrium arguments, which is the time reported in ADCIRC output files.
+ */
+class HarmonicsAnalysis {
+ public:
+  ADCIRCMODULES_EXPORT HarmonicsAnalysis(size_t numNodes,
+                                         bool isVelocity = false);
+
+  void ADCIRCMODULES_EXPORT addConstituent(const std::string &name,
+                                           double frequency,
+                                           double nodalFactor = 1.0,
+                                           double equilibriumArg = 0.0);
+
+  size_t ADCIRCMODULES_EXPORT numConstituents() const;
+  size_t ADCIRCMODULES_EXPORT numNodes() const;
+  size_t ADCIRCMODULES_EXPORT numSnaps() const;
+  bool ADCIRCMODULES_EXPORT isVelocity() const;
+
+  double ADCIRCMODULES_EXPORT defaultValue() const;
+  void ADCIRCMODULES_EXPORT setDefaultValue(double defaultValue);
+
+  void ADCIRCMODULES_EXPORT add(Adcirc::Output::OutputRecord *record);
+
+  void ADCIRCMODULES_EXPORT add(Adcirc::Output::ReadOutput *reader);
+
+#ifndef SWIG
+  void ADCIRCMODULES_EXPORT add(double time, const double *u,
+                                const double *v = nullptr);
+#endif
+
+  void ADCIRCMODULES_EXPORT solve(HarmonicsOutput *output) const;
+
+  void ADCIRCMODULES_EXPORT reset();
+
+ private:
+  void buildColumns();
+  void basis(double time, double *phi) const;
+
+  static constexpr size_t c_blockSize = 256;
+
+  size_t m_numNodes;
+  bool m_isVelocity;
+  double m_defaultValue;
+  size_t m_numSnaps;
+
+  std::vector<std::string> m_names;
+  std::vector<double> m_frequency;
+  std::vector<double> m_nodalFactor;
+  std::vector<double> m_equilibriumArg;
+
+  /// Number of least squares columns
+  size_t m_numColumns;
+
+  /// Column of the cosine term for each constituent
+  std::vector<size_t> m_cosColumn;
+
+  /// Column of the sine term for each constituent, or numColumns for a
+  /// steady term
+  std::vector<size_t> m_sinColumn;
+
+  /// Normal matrix summed over all snaps
+  std::vector<double> m_normal;
+
+  /// Right hand side ordered by component, column and node
+  std::vector<double> m_rhs;
+
+  /// Contribution to the normal matrix from snaps where a node was missing
+  std::unordered_map<size_t, std::vector<double>> m_missing;
+};
+
+}  // namespace Harmonics
+}  // namespace Adcirc
+
+#endif  // ADCMOD_HARMONICSANALYSIS_H
@@ -19,6 +19,7 @@
 #include "HarmonicsOutput.h"
 
 #include "HarmonicsOutputPrivate.h"
+#include "HarmonicsSynthesis.h"
 
 namespace Adcirc {
 namespace Harmonics {
@@ -196,6 +197,25 @@ Adcirc::Harmonics::HarmonicsRecord* HarmonicsOutput::v_phase(size_t index) {
   return this->m_impl->v_phase(index);
 }
 
+/**
+ * @brief Sets up the constituents and node count for a new set of harmonics
+ * data. All amplitudes and phases are set to zero
+ * @param[in] names constituent names
+ * @param[in] frequency constituent frequencies, rad/s
+ * @param[in] nodalFactor constituent nodal factors
+ * @param[in] equilibriumArg constituent equilibrium arguments, degrees
+ * @param[in] numNodes number of nodes
+ * @param[in] isVelocity true for velocity (fort.54 type) data
+ */
+void HarmonicsOutput::initialize(const std::vector<std::string>& names,
+                                 const std::vector<double>& frequency,
+                                 const std::vector<double>& nodalFactor,
+                                 const std::vector<double>& equilibriumArg,
+                                 size_t numNodes, bool isVelocity) {
+  this->m_impl->initialize(names, frequency, nodalFactor, equilibriumArg,
+                           numNodes, isVelocity);
+}
+
 /**
  * @brief Returns the number of constituents in the file
  * @return number of constituents
@@ -248,5 +268,77 @@ size_t HarmonicsOutput::nodeIdToArrayIndex(size_t id) {
  */
 int HarmonicsOutput::filetype() const { return this->m_impl->filetype(); }
 
+/**
+ * @brief Returns a pointer to the amplitudes of a constituent at all nodes
+ * @param[in] constituent constituent index
+ * @param[in] component 0 for elevation or u-velocity, 1 for v-velocity
+ * @return pointer to numNodes values
+ *
+ * After a file is read, the amplitudes and phases are held in one block
+ * ordered by field, constituent and node, so the amplitudes of constituent
+ * i + 1 directly follow those of constituent i
+ */
+const double* HarmonicsOutput::amplitudeData(size_t constituent,
+                                             size_t component) const {
+  return this->m_impl->data(2 * component, constituent);
+}
+
+/**
+ * @brief Returns a pointer to the phases of a constituent at all nodes
+ * @param[in] constituent constituent index
+ * @param[in] component 0 for elevation or u-velocity, 1 for v-velocity
+ * @return pointer to numNodes values, in degrees
+ */
+const double* HarmonicsOutput::phaseData(size_t constituent,
+                                         size_t component) const {
+  return this->m_impl->data(2 * component + 1, constituent);
+}
+
+/**
+ * @brief Number of bytes read from an ascii harmonics file at one time
+ * @return read size in bytes
+ */
+size_t HarmonicsOutput::asciiReadSize() const {
+  return this->m_impl->asciiReadSize();
+}
+
+/**
+ * @brief Sets the number of bytes read from an ascii harmonics file at one
+ * time. Records that are split across reads are carried into the next read
+ * @param[in] bytes read size in bytes
+ */
+void HarmonicsOutput::setAsciiReadSize(size_t bytes) {
+  this->m_impl->setAsciiReadSize(bytes);
+}
+
+/**
+ * @brief Reconstructs the water level or velocity at all nodes from the
+ * harmonic constituents
+ * @param[in] time time in seconds from the harmonic reference time
+ * @param[in] record record number to assign to the output
+ * @return output record. Velocity files produce a vector record
+ */
+Adcirc::Output::OutputRecord HarmonicsOutput::synthesize(double time,
+                                                         size_t record) {
+  return HarmonicsSynthesis(this).toOutputRecord(time, record);
+}
+
+/**
+ * @brief Reconstructs a time series from the harmonic constituents
+ * @param[in] times times in seconds from the harmonic reference time
+ * @param[in] nodes array positions of the nodes to reconstruct. All nodes are
+ * used if empty
+ * @param[in] component 0 for elevation or u-velocity, 1 for v-velocity
+ * @return values ordered as [time][node]
+ *
+ * Use HarmonicsSynthesis directly when the same nodes are evaluated more than
+ * once so that the node terms are only computed one time.
+ */
+std::vector<std::vector<double>> HarmonicsOutput::synthesize(
+    const std::vector<double>& times, const std::vector<size_t>& nodes,
+    size_t component) {
+  return HarmonicsSynthesis(this, nodes).timeseries(times, component);
+}
+
 }  // namespace Harmonics
 }  // namespace Adcirc
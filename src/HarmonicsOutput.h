@@ -3,10 +3,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "AdcircModules_Global.h"
 #include "FileTypes.h"
 #include "HarmonicsRecord.h"
+#include "OutputRecord.h"
 
 namespace Adcirc {
 namespace Private {
@@ -82,6 +84,13 @@ class HarmonicsOutput {
   Adcirc::Harmonics::HarmonicsRecord ADCIRCMODULES_EXPORT* v_phase(
       size_t index);
 
+  void ADCIRCMODULES_EXPORT
+  initialize(const std::vector<std::string>& names,
+             const std::vector<double>& frequency,
+             const std::vector<double>& nodalFactor,
+             const std::vector<double>& equilibriumArg, size_t numNodes,
+             bool isVelocity = false);
+
   size_t ADCIRCMODULES_EXPORT numConstituents() const;
 
   void ADCIRCMODULES_EXPORT setNumConstituents(const size_t& numConstituents);
@@ -96,6 +105,25 @@ class HarmonicsOutput {
 
   int ADCIRCMODULES_EXPORT filetype() const;
 
+#ifndef SWIG
+  const double ADCIRCMODULES_EXPORT* amplitudeData(size_t constituent,
+                                                   size_t component = 0) const;
+
+  const double ADCIRCMODULES_EXPORT* phaseData(size_t constituent,
+                                               size_t component = 0) const;
+#endif
+
+  size_t ADCIRCMODULES_EXPORT asciiReadSize() const;
+  void ADCIRCMODULES_EXPORT setAsciiReadSize(size_t bytes);
+
+  Adcirc::Output::OutputRecord ADCIRCMODULES_EXPORT synthesize(
+      double time, size_t record = 1);
+
+  std::vector<std::vector<double>> ADCIRCMODULES_EXPORT
+  synthesize(const std::vector<double>& times,
+             const std::vector<size_t>& nodes = std::vector<size_t>(),
+             size_t component = 0);
+
  private:
   std::unique_ptr<Adcirc::Private::HarmonicsOutputPrivate> m_impl;
 };
@@ -19,6 +19,7 @@
 #include "HarmonicsOutputPrivate.h"
 
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -37,14 +38,63 @@
 using namespace Adcirc::Harmonics;
 using namespace Adcirc::Private;
 
+namespace {
+
+/// Default number of bytes read from an ascii harmonics file at one time
+constexpr size_t c_readSize = 64 * 1024 * 1024;
+
+/**
+ * @brief Returns the position following the end of the current line
+ * @param[in] p position in the current line
+ * @param[in] end end of the buffer
+ * @return start of the next line, or nullptr if no line ending was found
+ */
+const char* findNextLine(const char* p, const char* end) {
+  const void* nl = std::memchr(p, '\n', static_cast<size_t>(end - p));
+  return nl == nullptr ? nullptr : static_cast<const char*>(nl) + 1;
+}
+
+/**
+ * @brief Parses a fixed number of floating point values from a line
+ * @param[in] begin start of the line
+ * @param[in] end end of the line
+ * @param[in] n number of values expected
+ * @param[out] values array of n values
+ * @return true if all values were found on the line
+ */
+bool parseHarmonicsLine(const char* begin, const char* end, size_t n,
+                        double* values) {
+  for (size_t k = 0; k < n; ++k) {
+    if (!Adcirc::StringConversion::parseDouble(begin, end, values[k])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 HarmonicsOutput::~HarmonicsOutput() = default;
 
 HarmonicsOutputPrivate::HarmonicsOutputPrivate(const std::string& filename)
     : m_filename(filename),
       m_numNodes(0),
       m_numConstituents(0),
+      m_sequentialNodes(false),
       m_isVelocity(false),
-      m_filetype(Adcirc::Harmonics::HarmonicsUnknown) {}
+      m_filetype(Adcirc::Harmonics::HarmonicsUnknown),
+      m_asciiReadSize(c_readSize) {}
+
+size_t HarmonicsOutputPrivate::asciiReadSize() const {
+  return this->m_asciiReadSize;
+}
+
+void HarmonicsOutputPrivate::setAsciiReadSize(size_t bytes) {
+  if (bytes == 0) {
+    adcircmodules_throw_exception("Harmonics read size must be positive");
+  }
+  this->m_asciiReadSize = bytes;
+}
 
 std::string HarmonicsOutputPrivate::filename() const {
   return this->m_filename;
@@ -185,6 +235,13 @@ void HarmonicsOutputPrivate::setNumNodes(const size_t& numNodes) {
 bool HarmonicsOutputPrivate::isVelocity() const { return this->m_isVelocity; }
 
 size_t HarmonicsOutputPrivate::nodeIdToArrayIndex(size_t id) {
+  if (this->m_sequentialNodes) {
+    if (id == 0 || id > this->numNodes()) {
+      adcircmodules_throw_exception("Node not found in data");
+      return adcircmodules_default_value<size_t>();
+    }
+    return id - 1;
+  }
   auto i = this->m_nodeIndex.find(id);
   if (i == this->m_nodeIndex.end()) {
     adcircmodules_throw_exception("Node not found in data");
@@ -196,6 +253,107 @@ size_t HarmonicsOutputPrivate::nodeIdToArrayIndex(size_t id) {
 
 int HarmonicsOutputPrivate::filetype() const { return this->m_filetype; }
 
+size_t HarmonicsOutputPrivate::numFields() const {
+  return this->isVelocity() ? 4 : 2;
+}
+
+const double* HarmonicsOutputPrivate::data(size_t field,
+                                           size_t constituent) const {
+  assert(field < this->numFields());
+  assert(constituent < this->numConstituents());
+  const std::vector<HarmonicsRecord>* records;
+  if (this->isVelocity()) {
+    const std::vector<HarmonicsRecord>* r[] = {
+        &this->m_uamplitude, &this->m_uphase, &this->m_vamplitude,
+        &this->m_vphase};
+    records = r[field];
+  } else {
+    records = field == 0 ? &this->m_amplitude : &this->m_phase;
+  }
+  if (constituent >= records->size()) {
+    adcircmodules_throw_exception("Index out of bounds");
+    return nullptr;
+  }
+  return (*records)[constituent].data();
+}
+
+/**
+ * @brief Sets up the constituents and allocates storage for the amplitudes
+ * and phases at each node. Existing data is discarded
+ * @param[in] names constituent names
+ * @param[in] frequency constituent frequencies, rad/s
+ * @param[in] nodalFactor constituent nodal factors
+ * @param[in] equilibriumArg constituent equilibrium arguments, degrees
+ * @param[in] numNodes number of nodes
+ * @param[in] isVelocity true for a velocity (fort.54 type) file
+ */
+void HarmonicsOutputPrivate::initialize(
+    const std::vector<std::string>& names, const std::vector<double>& frequency,
+    const std::vector<double>& nodalFactor,
+    const std::vector<double>& equilibriumArg, size_t numNodes,
+    bool isVelocity) {
+  const size_t n = names.size();
+  if (frequency.size() != n || nodalFactor.size() != n ||
+      equilibriumArg.size() != n) {
+    adcircmodules_throw_exception("Constituent arrays must be the same size");
+  }
+
+  this->m_isVelocity = isVelocity;
+  this->setNumNodes(numNodes);
+  this->setNumConstituents(n);
+  this->m_index.clear();
+  this->m_reverseIndex.clear();
+  this->m_consituentNames.clear();
+  this->m_nodeIndex.clear();
+  this->m_sequentialNodes = true;
+
+  for (size_t i = 0; i < n; ++i) {
+    std::string name = boost::to_upper_copy<std::string>(names[i]);
+    this->m_index[name] = i;
+    this->m_reverseIndex[i] = name;
+    this->m_consituentNames.push_back(name);
+
+    std::vector<HarmonicsRecord*> records;
+    if (this->isVelocity()) {
+      records = {this->u_amplitude(i), this->v_amplitude(i), this->u_phase(i),
+                 this->v_phase(i)};
+    } else {
+      records = {this->amplitude(i), this->phase(i)};
+    }
+    for (auto r : records) {
+      r->setName(name);
+      r->setFrequency(frequency[i]);
+      r->setNodalFactor(nodalFactor[i]);
+      r->setEquilibriumArg(equilibriumArg[i]);
+    }
+  }
+
+  this->allocate();
+}
+
+/**
+ * @brief Places the values of every record in a single contiguous block
+ *
+ * The record arrays must already be sized to the number of constituents
+ */
+void HarmonicsOutputPrivate::allocate() {
+  const size_t nc = this->numConstituents();
+  const size_t nn = this->numNodes();
+  this->m_data.assign(this->numFields() * nc * nn, 0.0);
+  for (size_t i = 0; i < nc; ++i) {
+    double* d = this->m_data.data();
+    if (this->isVelocity()) {
+      this->m_uamplitude[i].attach(d + (0 * nc + i) * nn, nn);
+      this->m_uphase[i].attach(d + (1 * nc + i) * nn, nn);
+      this->m_vamplitude[i].attach(d + (2 * nc + i) * nn, nn);
+      this->m_vphase[i].attach(d + (3 * nc + i) * nn, nn);
+    } else {
+      this->m_amplitude[i].attach(d + (0 * nc + i) * nn, nn);
+      this->m_phase[i].attach(d + (1 * nc + i) * nn, nn);
+    }
+  }
+}
+
 void HarmonicsOutputPrivate::read() {
   this->getFiletype();
 
@@ -392,9 +550,8 @@ void HarmonicsOutputPrivate::writeNetcdfFormatElevation(const int& ncid) {
     count[0] = this->numNodes();
     count[1] = 1;
 
-    nc_put_vara(ncid, varid[0], start, count,
-                this->m_amplitude[i].values().data());
-    nc_put_vara(ncid, varid[1], start, count, this->m_phase[i].values().data());
+    nc_put_vara(ncid, varid[0], start, count, this->m_amplitude[i].data());
+    nc_put_vara(ncid, varid[1], start, count, this->m_phase[i].data());
   }
 }
 
@@ -412,14 +569,10 @@ void HarmonicsOutputPrivate::writeNetcdfFormatVelocity(const int& ncid) {
     count[0] = this->numNodes();
     count[1] = 1;
 
-    nc_put_vara(ncid, varid[0], start, count,
-                this->m_uamplitude[i].values().data());
-    nc_put_vara(ncid, varid[1], start, count,
-                this->m_uphase[i].values().data());
-    nc_put_vara(ncid, varid[2], start, count,
-                this->m_vamplitude[i].values().data());
-    nc_put_vara(ncid, varid[3], start, count,
-                this->m_vphase[i].values().data());
+    nc_put_vara(ncid, varid[0], start, count, this->m_uamplitude[i].data());
+    nc_put_vara(ncid, varid[1], start, count, this->m_uphase[i].data());
+    nc_put_vara(ncid, varid[2], start, count, this->m_vamplitude[i].data());
+    nc_put_vara(ncid, varid[3], start, count, this->m_vphase[i].data());
   }
 }
 
@@ -476,47 +629,9 @@ void HarmonicsOutputPrivate::readAsciiHeader(std::ifstream& fid) {
     adcircmodules_throw_exception("Error reading file data");
   }
 
-  this->m_isVelocity = this->checkFormatAsciiVelocity(fid);
-  this->setNumConstituents(n);
-
-  for (size_t i = 0; i < this->numConstituents(); ++i) {
-    this->m_index[names[i]] = i;
-    this->m_reverseIndex[i] = names[i];
-    this->m_consituentNames.push_back(names[i]);
-    if (this->isVelocity()) {
-      this->u_amplitude(i)->setName(names[i]);
-      this->u_amplitude(i)->setFrequency(frequency[i]);
-      this->u_amplitude(i)->setNodalFactor(nodalFactor[i]);
-      this->u_amplitude(i)->setEquilibriumArg(equilibriumArg[i]);
-      this->v_amplitude(i)->setName(names[i]);
-      this->v_amplitude(i)->setFrequency(frequency[i]);
-      this->v_amplitude(i)->setNodalFactor(nodalFactor[i]);
-      this->v_amplitude(i)->setEquilibriumArg(equilibriumArg[i]);
-      this->u_phase(i)->setName(names[i]);
-      this->u_phase(i)->setFrequency(frequency[i]);
-      this->u_phase(i)->setNodalFactor(nodalFactor[i]);
-      this->u_phase(i)->setEquilibriumArg(equilibriumArg[i]);
-      this->v_phase(i)->setName(names[i]);
-      this->v_phase(i)->setFrequency(frequency[i]);
-      this->v_phase(i)->setNodalFactor(nodalFactor[i]);
-      this->v_phase(i)->setEquilibriumArg(equilibriumArg[i]);
-      this->u_amplitude(i)->resize(this->numNodes());
-      this->v_amplitude(i)->resize(this->numNodes());
-      this->u_phase(i)->resize(this->numNodes());
-      this->v_phase(i)->resize(this->numNodes());
-    } else {
-      this->amplitude(i)->setName(names[i]);
-      this->amplitude(i)->setFrequency(frequency[i]);
-      this->amplitude(i)->setNodalFactor(nodalFactor[i]);
-      this->amplitude(i)->setEquilibriumArg(equilibriumArg[i]);
-      this->phase(i)->setName(names[i]);
-      this->phase(i)->setFrequency(frequency[i]);
-      this->phase(i)->setNodalFactor(nodalFactor[i]);
-      this->phase(i)->setEquilibriumArg(equilibriumArg[i]);
-      this->amplitude(i)->resize(this->numNodes());
-      this->phase(i)->resize(this->numNodes());
-    }
-  }
+  bool isVelocity = this->checkFormatAsciiVelocity(fid);
+  this->initialize(names, frequency, nodalFactor, equilibriumArg,
+                   this->numNodes(), isVelocity);
 
   return;
 }
@@ -556,45 +671,114 @@ void HarmonicsOutputPrivate::readAsciiFormat() {
   }
 
   this->readAsciiHeader(fid);
+  this->readAsciiBody(fid);
 
-  for (size_t i = 0; i < this->numNodes(); ++i) {
-    std::string line;
-    std::getline(fid, line);
+  fid.close();
 
-    size_t node;
-    FileIO::AdcircIO::splitStringBoundary0Format(line, node);
+  return;
+}
 
-    this->m_nodeIndex[node] = i;
+/**
+ * @brief Reads the node records of an ascii harmonics file
+ * @param[in] fid file positioned after the header
+ *
+ * The file is read in large blocks. Each node record is a node line followed
+ * by one line per constituent, so the complete records in a block are found
+ * by counting lines. The records are then decoded in parallel directly into
+ * the contiguous data block, and any partial record at the end of the block
+ * is carried into the next read.
+ */
+void HarmonicsOutputPrivate::readAsciiBody(std::ifstream& fid) {
+  const size_t nc = this->numConstituents();
+  const size_t nn = this->numNodes();
+  const size_t linesPerNode = nc + 1;
+  const size_t valuesPerLine = this->numFields();
+  double* const data = this->m_data.data();
+
+  std::vector<size_t> ids(nn);
+  std::vector<const char*> records;
+  std::string buffer;
+  size_t node = 0;
+  bool error = false;
+
+  while (node < nn) {
+    const size_t carried = buffer.size();
+    buffer.resize(carried + this->m_asciiReadSize);
+    fid.read(&buffer[carried],
+             static_cast<std::streamsize>(this->m_asciiReadSize));
+    buffer.resize(carried + static_cast<size_t>(fid.gcount()));
+    const bool eof = !fid;
+    if (eof && (buffer.empty() || buffer.back() != '\n')) {
+      buffer.push_back('\n');
+    }
 
-    for (size_t j = 0; j < this->numConstituents(); ++j) {
-      std::getline(fid, line);
-      if (this->isVelocity()) {
-        double um, up, vm, vp;
-        if (!FileIO::AdcircIO::splitStringHarmonicsVelocityFormat(line, um, up,
-                                                                  vm, vp)) {
-          adcircmodules_throw_exception(
-              "Error reading harmonics velocity string");
-        }
+    const char* const end = buffer.data() + buffer.size();
+    const char* p = buffer.data();
+    records.clear();
+    while (node + records.size() < nn) {
+      const char* q = p;
+      size_t k = 0;
+      for (; k < linesPerNode && q != nullptr; ++k) {
+        q = findNextLine(q, end);
+      }
+      if (q == nullptr) break;
+      records.push_back(p);
+      p = q;
+    }
 
-        this->u_amplitude(j)->set(i, um);
-        this->u_phase(j)->set(i, up);
-        this->v_amplitude(j)->set(i, vm);
-        this->v_phase(j)->set(i, vp);
-      } else {
-        double a, p;
-        if (!FileIO::AdcircIO::splitStringHarmonicsElevationFormat(line, a,
-                                                                   p)) {
-          adcircmodules_throw_exception(
-              "Error reading harmonics elevation string");
+    const size_t nRecords = records.size();
+    if (nRecords == 0) {
+      if (eof) {
+        adcircmodules_throw_exception("Unexpected end of harmonics file");
+      }
+      continue;
+    }
+    records.push_back(p);
+
+#pragma omp parallel for schedule(static)
+    for (size_t r = 0; r < nRecords; ++r) {
+      const size_t i = node + r;
+      const char* line = records[r];
+      const char* lineEnd = findNextLine(line, records[r + 1]);
+
+      bool ok = StringConversion::parseSizet(line, lineEnd, ids[i]);
+
+      double v[4];
+      for (size_t j = 0; j < nc && ok; ++j) {
+        line = lineEnd;
+        lineEnd = findNextLine(line, records[r + 1]);
+        ok = parseHarmonicsLine(line, lineEnd, valuesPerLine, v);
+        for (size_t f = 0; f < valuesPerLine && ok; ++f) {
+          data[(f * nc + j) * nn + i] = v[f];
         }
+      }
 
-        this->amplitude(j)->set(i, a);
-        this->phase(j)->set(i, p);
+      if (!ok) {
+#pragma omp atomic write
+        error = true;
       }
     }
+
+    if (error) {
+      adcircmodules_throw_exception("Error reading harmonics data string");
+    }
+
+    node += nRecords;
+    buffer.erase(0, static_cast<size_t>(p - buffer.data()));
   }
 
-  fid.close();
+  this->m_sequentialNodes = true;
+  for (size_t i = 0; i < nn && this->m_sequentialNodes; ++i) {
+    this->m_sequentialNodes = ids[i] == i + 1;
+  }
+
+  this->m_nodeIndex.clear();
+  if (!this->m_sequentialNodes) {
+    this->m_nodeIndex.reserve(nn);
+    for (size_t i = 0; i < nn; ++i) {
+      this->m_nodeIndex[ids[i]] = i;
+    }
+  }
 
   return;
 }
@@ -741,22 +925,18 @@ void HarmonicsOutputPrivate::readNetcdfFormatHeader(int ncid,
     for (size_t i = 0; i < this->numConstituents(); ++i) {
       this->m_index[this->m_consituentNames[i]] = i;
       this->m_reverseIndex[i] = this->m_consituentNames[i];
-      this->u_amplitude(i)->resize(this->numNodes());
       this->u_amplitude(i)->setName(this->m_consituentNames[i]);
       this->u_amplitude(i)->setFrequency(frequency[i]);
       this->u_amplitude(i)->setEquilibriumArg(equilibriumArg[i]);
       this->u_amplitude(i)->setNodalFactor(nodeFactor[i]);
-      this->v_amplitude(i)->resize(this->numNodes());
       this->v_amplitude(i)->setName(this->m_consituentNames[i]);
       this->v_amplitude(i)->setFrequency(frequency[i]);
       this->v_amplitude(i)->setEquilibriumArg(equilibriumArg[i]);
       this->v_amplitude(i)->setNodalFactor(nodeFactor[i]);
-      this->u_phase(i)->resize(this->numNodes());
       this->u_phase(i)->setName(this->m_consituentNames[i]);
       this->u_phase(i)->setFrequency(frequency[i]);
       this->u_phase(i)->setEquilibriumArg(equilibriumArg[i]);
       this->u_phase(i)->setNodalFactor(nodeFactor[i]);
-      this->v_phase(i)->resize(this->numNodes());
       this->v_phase(i)->setName(this->m_consituentNames[i]);
       this->v_phase(i)->setFrequency(frequency[i]);
       this->v_phase(i)->setEquilibriumArg(equilibriumArg[i]);
@@ -768,12 +948,10 @@ void HarmonicsOutputPrivate::readNetcdfFormatHeader(int ncid,
     for (size_t i = 0; i < this->numConstituents(); ++i) {
       this->m_index[this->m_consituentNames[i]] = i;
       this->m_reverseIndex[i] = this->m_consituentNames[i];
-      this->amplitude(i)->resize(this->numNodes());
       this->amplitude(i)->setName(this->m_consituentNames[i]);
       this->amplitude(i)->setFrequency(frequency[i]);
       this->amplitude(i)->setEquilibriumArg(equilibriumArg[i]);
       this->amplitude(i)->setNodalFactor(nodeFactor[i]);
-      this->phase(i)->resize(this->numNodes());
       this->phase(i)->setName(this->m_consituentNames[i]);
       this->phase(i)->setFrequency(frequency[i]);
       this->phase(i)->setEquilibriumArg(equilibriumArg[i]);
@@ -781,6 +959,8 @@ void HarmonicsOutputPrivate::readNetcdfFormatHeader(int ncid,
     }
   }
 
+  this->allocate();
+
   int vid;
   if (this->isVelocity()) {
     ierr = nc_inq_varid(ncid, "u_amp", &vid);
@@ -835,23 +1015,21 @@ void HarmonicsOutputPrivate::readNetcdfElevationData(int ncid,
                                                      std::vector<int>& varids) {
   assert(varids.size() == 2);
 
-  std::vector<double> v(this->numNodes());
   size_t start[2], count[2];
   for (size_t i = 0; i < this->numConstituents(); ++i) {
     start[0] = 0;
     start[1] = i;
     count[0] = this->numNodes();
     count[1] = 1;
-    int ierr = nc_get_vara(ncid, varids[0], start, count, v.data());
+    int ierr =
+        nc_get_vara(ncid, varids[0], start, count, this->amplitude(i)->data());
     if (ierr != NC_NOERR) {
       adcircmodules_throw_exception("Error reading harmonic elevation data");
     }
-    this->amplitude(i)->set(v);
-    ierr = nc_get_vara(ncid, varids[1], start, count, v.data());
+    ierr = nc_get_vara(ncid, varids[1], start, count, this->phase(i)->data());
     if (ierr != NC_NOERR) {
       adcircmodules_throw_exception("Error reading harmonic elevation data");
     }
-    this->phase(i)->set(v);
   }
 
   return;
@@ -861,7 +1039,6 @@ void HarmonicsOutputPrivate::readNetcdfVelocityData(int ncid,
                                                     std::vector<int>& varids) {
   assert(varids.size() == 4);
 
-  std::vector<double> v(this->numNodes());
   size_t start[2], count[2];
 
   for (size_t i = 0; i < this->numConstituents(); ++i) {
@@ -870,31 +1047,15 @@ void HarmonicsOutputPrivate::readNetcdfVelocityData(int ncid,
     count[0] = this->numNodes();
     count[1] = 1;
 
-    int ierr = nc_get_vara(ncid, varids[0], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic velocity data");
-    }
-    std::vector<double> ua(v.data(), v.data() + this->numNodes());
-    this->u_amplitude(i)->set(ua);
-
-    ierr = nc_get_vara(ncid, varids[1], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic velocity data");
-    }
-    this->u_phase(i)->set(v);
-
-    ierr = nc_get_vara(ncid, varids[2], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic velocity data");
-    }
-    this->v_amplitude(i)->set(v);
-
-    ierr = nc_get_vara(ncid, varids[3], start, count, v.data());
-    if (ierr != NC_NOERR) {
-      adcircmodules_throw_exception("Error reading harmonic velocity data");
+    HarmonicsRecord* records[] = {this->u_amplitude(i), this->u_phase(i),
+                                  this->v_amplitude(i), this->v_phase(i)};
+    for (size_t j = 0; j < 4; ++j) {
+      int ierr =
+          nc_get_vara(ncid, varids[j], start, count, records[j]->data());
+      if (ierr != NC_NOERR) {
+        adcircmodules_throw_exception("Error reading harmonic velocity data");
+      }
     }
-
-    this->v_phase(i)->set(v);
   }
 
   return;
@@ -77,6 +77,18 @@ class HarmonicsOutputPrivate {
 
   int filetype() const;
 
+  void initialize(const std::vector<std::string>& names,
+                  const std::vector<double>& frequency,
+                  const std::vector<double>& nodalFactor,
+                  const std::vector<double>& equilibriumArg, size_t numNodes,
+                  bool isVelocity);
+
+  size_t numFields() const;
+  const double* data(size_t field, size_t constituent) const;
+
+  size_t asciiReadSize() const;
+  void setAsciiReadSize(size_t bytes);
+
  private:
   int m_filetype;
   bool m_isVelocity;
@@ -84,6 +96,16 @@ class HarmonicsOutputPrivate {
   std::vector<std::string> m_consituentNames;
   size_t m_numConstituents;
   size_t m_numNodes;
+  bool m_sequentialNodes;
+
+  /// Number of bytes read from an ascii file at one time
+  size_t m_asciiReadSize;
+
+  /// Values for all records ordered by field, constituent and node. The
+  /// fields are amplitude and phase, or u-amplitude, u-phase, v-amplitude and
+  /// v-phase for velocity files
+  std::vector<double> m_data;
+
   std::vector<Adcirc::Harmonics::HarmonicsRecord> m_amplitude;
   std::vector<Adcirc::Harmonics::HarmonicsRecord> m_phase;
   std::vector<Adcirc::Harmonics::HarmonicsRecord> m_uamplitude;
@@ -101,6 +123,9 @@ class HarmonicsOutputPrivate {
   void readAsciiFormat();
   void readNetcdfFormat();
   void readAsciiHeader(std::ifstream& fid);
+  void readAsciiBody(std::ifstream& fid);
+
+  void allocate();
 
   bool checkFormatAsciiVelocity(std::ifstream& fid);
   bool checkFormatNetcdfVelocity(const int& ncid);
@@ -139,5 +139,30 @@ void HarmonicsRecord::setEquilibriumArg(double equilibriumArg) {
   this->m_impl->setEquilibriumArg(equilibriumArg);
 }
 
+/**
+ * @brief Returns a pointer to the values in this record
+ * @return pointer to the first of numNodes values
+ *
+ * Records that belong to a HarmonicsOutput object point into the contiguous
+ * block held by that object
+ */
+const double* HarmonicsRecord::data() const { return this->m_impl->data(); }
+
+/**
+ * @brief Returns a pointer to the values in this record
+ * @return pointer to the first of numNodes values
+ */
+double* HarmonicsRecord::data() { return this->m_impl->data(); }
+
+/**
+ * @brief Places the values of this record in storage owned by a
+ * HarmonicsOutput object
+ * @param[in] data pointer to numNodes values
+ * @param[in] numNodes number of values
+ */
+void HarmonicsRecord::attach(double* data, size_t numNodes) {
+  this->m_impl->attach(data, numNodes);
+}
+
 }  // namespace Harmonics
 }  // namespace Adcirc
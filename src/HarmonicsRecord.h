@@ -12,6 +12,7 @@ namespace Adcirc {
 namespace Private {
 // Forward declaration for pimpl class
 class HarmonicsRecordPrivate;
+class HarmonicsOutputPrivate;
 }  // namespace Private
 
 namespace Harmonics {
@@ -52,7 +53,16 @@ class HarmonicsRecord {
   double ADCIRCMODULES_EXPORT equilibriumArg() const;
   void ADCIRCMODULES_EXPORT setEquilibriumArg(double equilibriumArg);
 
+#ifndef SWIG
+  const double ADCIRCMODULES_EXPORT* data() const;
+  double ADCIRCMODULES_EXPORT* data();
+#endif
+
  private:
+  friend class Adcirc::Private::HarmonicsOutputPrivate;
+
+  void attach(double* data, size_t numNodes);
+
   std::unique_ptr<Adcirc::Private::HarmonicsRecordPrivate> m_impl;
 };
 }  // namespace Harmonics
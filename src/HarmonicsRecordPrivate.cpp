@@ -18,6 +18,7 @@
 //------------------------------------------------------------------------*/
 #include "HarmonicsRecordPrivate.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "DefaultValues.h"
@@ -30,13 +31,61 @@ HarmonicsRecordPrivate::HarmonicsRecordPrivate()
       m_numNodes(0),
       m_frequency(0.0),
       m_equilibriumArg(0.0),
-      m_nodalFactor(0.0) {}
+      m_nodalFactor(0.0),
+      m_view(nullptr) {}
+
+/**
+ * @brief Copy constructor. A copy of a record that is attached to external
+ * storage owns a copy of the values
+ * @param h record to copy
+ */
+HarmonicsRecordPrivate::HarmonicsRecordPrivate(const HarmonicsRecordPrivate &h)
+    : m_numNodes(h.m_numNodes),
+      m_name(h.m_name),
+      m_data(h.data(), h.data() + h.m_numNodes),
+      m_frequency(h.m_frequency),
+      m_nodalFactor(h.m_nodalFactor),
+      m_equilibriumArg(h.m_equilibriumArg),
+      m_view(nullptr) {}
 
 void HarmonicsRecordPrivate::resize(size_t numNodes) {
+  if (this->m_view != nullptr) {
+    if (numNodes != this->m_numNodes) {
+      adcircmodules_throw_exception(
+          "HarmonicsRecord: Cannot resize a record attached to a harmonics "
+          "file");
+    }
+    return;
+  }
   this->m_numNodes = numNodes;
   this->m_data.resize(numNodes);
 }
 
+/**
+ * @brief Uses external storage for the values of this record
+ * @param data pointer to numNodes values owned by the caller
+ * @param numNodes number of values
+ *
+ * Any values held by the record are released.
+ */
+void HarmonicsRecordPrivate::attach(double *data, size_t numNodes) {
+  this->m_view = data;
+  this->m_numNodes = numNodes;
+  std::vector<double>().swap(this->m_data);
+}
+
+bool HarmonicsRecordPrivate::isAttached() const {
+  return this->m_view != nullptr;
+}
+
+const double *HarmonicsRecordPrivate::data() const {
+  return this->m_view != nullptr ? this->m_view : this->m_data.data();
+}
+
+double *HarmonicsRecordPrivate::data() {
+  return this->m_view != nullptr ? this->m_view : this->m_data.data();
+}
+
 double HarmonicsRecordPrivate::frequency() const { return this->m_frequency; }
 
 void HarmonicsRecordPrivate::setFrequency(double frequency) {
@@ -65,12 +114,14 @@ void HarmonicsRecordPrivate::setName(const std::string &name) {
   this->m_name = name;
 }
 
-std::vector<double> HarmonicsRecordPrivate::values() { return this->m_data; }
+std::vector<double> HarmonicsRecordPrivate::values() {
+  return std::vector<double>(this->data(), this->data() + this->m_numNodes);
+}
 
 double HarmonicsRecordPrivate::value(size_t index) {
-  assert(index < this->m_data.size());
-  if (index < this->m_data.size()) {
-    return this->m_data[index];
+  assert(index < this->m_numNodes);
+  if (index < this->m_numNodes) {
+    return this->data()[index];
   } else {
     adcircmodules_throw_exception("HarmonicsRecord: Index out of bounds");
     return adcircmodules_default_value<double>();
@@ -78,9 +129,9 @@ double HarmonicsRecordPrivate::value(size_t index) {
 }
 
 void HarmonicsRecordPrivate::set(size_t index, double data) {
-  assert(index < this->m_data.size());
-  if (index < this->m_data.size()) {
-    this->m_data[index] = data;
+  assert(index < this->m_numNodes);
+  if (index < this->m_numNodes) {
+    this->data()[index] = data;
   } else {
     adcircmodules_throw_exception("HarmonicsRecord: Index out of bounds");
     return;
@@ -89,11 +140,11 @@ void HarmonicsRecordPrivate::set(size_t index, double data) {
 }
 
 void HarmonicsRecordPrivate::set(const std::vector<double> &value) {
-  assert(value.size() == this->m_data.size());
-  if (value.size() != this->m_data.size()) {
+  assert(value.size() == this->m_numNodes);
+  if (value.size() != this->m_numNodes) {
     adcircmodules_throw_exception("HarmonicsRecord: Invalid data size");
     return;
   }
-  this->m_data = value;
+  std::copy(value.begin(), value.end(), this->data());
   return;
 }
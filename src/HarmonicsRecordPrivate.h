@@ -27,6 +27,7 @@ namespace Private {
 class HarmonicsRecordPrivate {
  public:
   HarmonicsRecordPrivate();
+  HarmonicsRecordPrivate(const HarmonicsRecordPrivate& h);
 
   std::string name() const;
   void setName(const std::string& name);
@@ -39,6 +40,12 @@ class HarmonicsRecordPrivate {
 
   void resize(size_t numNodes);
 
+  void attach(double* data, size_t numNodes);
+  bool isAttached() const;
+
+  const double* data() const;
+  double* data();
+
   double frequency() const;
   void setFrequency(double frequency);
 
@@ -55,6 +62,7 @@ class HarmonicsRecordPrivate {
   double m_frequency;
   double m_nodalFactor;
   double m_equilibriumArg;
+  double* m_view;
 };
 }  // namespace Private
 }  // namespace Adcirc
@@ -0,0 +1,254 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "HarmonicsSynthesis.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "HarmonicsOutput.h"
+#include "Logging.h"
+
+using namespace Adcirc::Harmonics;
+
+/**
+ * @brief Constructor. Precomputes the node terms for each constituent
+ * @param harmonics harmonics file that has already been read
+ * @param nodes array positions of the nodes to reconstruct. If empty, all
+ * nodes in the file are used
+ */
+HarmonicsSynthesis::HarmonicsSynthesis(HarmonicsOutput *harmonics,
+                                       const std::vector<size_t> &nodes)
+    : m_numNodes(0), m_numConstituents(0), m_numComponents(1) {
+  if (harmonics == nullptr) {
+    adcircmodules_throw_exception("Harmonics object is null");
+  }
+
+  constexpr double deg2rad = M_PI / 180.0;
+
+  this->m_numConstituents = harmonics->numConstituents();
+  this->m_numComponents = harmonics->isVelocity() ? 2 : 1;
+  this->m_numNodes = nodes.empty() ? harmonics->numNodes() : nodes.size();
+
+  for (auto n : nodes) {
+    if (n >= harmonics->numNodes()) {
+      adcircmodules_throw_exception("Node index out of bounds");
+    }
+  }
+
+  const size_t nc = this->m_numConstituents;
+  const size_t nn = this->m_numNodes;
+
+  this->m_frequency.resize(nc);
+  this->m_equilibriumArg.resize(nc);
+  this->m_p.resize(this->m_numComponents * nc * nn);
+  this->m_q.resize(this->m_numComponents * nc * nn);
+
+  for (size_t c = 0; c < nc; ++c) {
+    const HarmonicsRecord *r =
+        harmonics->isVelocity() ? harmonics->u_amplitude(c)
+                                : harmonics->amplitude(c);
+    this->m_frequency[c] = r->frequency();
+    this->m_equilibriumArg[c] = r->equilibriumArg() * deg2rad;
+    const double f = r->nodalFactor();
+
+    for (size_t k = 0; k < this->m_numComponents; ++k) {
+      const double *a = harmonics->amplitudeData(c, k);
+      const double *g = harmonics->phaseData(c, k);
+      double *p = this->m_p.data() + (k * nc + c) * nn;
+      double *q = this->m_q.data() + (k * nc + c) * nn;
+
+#pragma omp parallel for schedule(static)
+      for (size_t i = 0; i < nn; ++i) {
+        const size_t n = nodes.empty() ? i : nodes[i];
+        const double fa = f * a[n];
+        const double phase = g[n] * deg2rad;
+        p[i] = fa * std::cos(phase);
+        q[i] = fa * std::sin(phase);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Number of nodes that are reconstructed
+ * @return number of nodes
+ */
+size_t HarmonicsSynthesis::numNodes() const { return this->m_numNodes; }
+
+/**
+ * @brief Number of constituents used in the reconstruction
+ * @return number of constituents
+ */
+size_t HarmonicsSynthesis::numConstituents() const {
+  return this->m_numConstituents;
+}
+
+/**
+ * @brief Number of components. 1 for elevations, 2 for velocities
+ * @return number of components
+ */
+size_t HarmonicsSynthesis::numComponents() const {
+  return this->m_numComponents;
+}
+
+/**
+ * @brief Computes cos and sin of (w * t + V0 + u) for each time and
+ * constituent
+ * @param times times in seconds from the harmonic reference time
+ * @param numTimes number of times
+ * @param c cosine terms, ordered by time then constituent
+ * @param s sine terms, ordered by time then constituent
+ *
+ * When the times are evenly spaced, each step is a rotation by w * dt. The
+ * exact values are recomputed every c_resyncInterval steps so that rounding
+ * in the rotation does not accumulate.
+ */
+void HarmonicsSynthesis::phasors(const double *times, size_t numTimes,
+                                 std::vector<double> &c,
+                                 std::vector<double> &s) const {
+  const size_t nc = this->m_numConstituents;
+  c.resize(numTimes * nc);
+  s.resize(numTimes * nc);
+
+  bool uniform = numTimes > 2;
+  const double dt = numTimes > 1 ? times[1] - times[0] : 0.0;
+  for (size_t t = 2; t < numTimes && uniform; ++t) {
+    const double expected = times[0] + static_cast<double>(t) * dt;
+    uniform = std::abs(times[t] - expected) <=
+              1e-9 * std::max(1.0, std::abs(expected));
+  }
+
+  for (size_t k = 0; k < nc; ++k) {
+    const double w = this->m_frequency[k];
+    const double e = this->m_equilibriumArg[k];
+    const double cdt = std::cos(w * dt);
+    const double sdt = std::sin(w * dt);
+    for (size_t t = 0; t < numTimes; ++t) {
+      if (!uniform || t % c_resyncInterval == 0) {
+        const double arg = w * times[t] + e;
+        c[t * nc + k] = std::cos(arg);
+        s[t * nc + k] = std::sin(arg);
+      } else {
+        const double c0 = c[(t - 1) * nc + k];
+        const double s0 = s[(t - 1) * nc + k];
+        c[t * nc + k] = c0 * cdt - s0 * sdt;
+        s[t * nc + k] = s0 * cdt + c0 * sdt;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Reconstructs a component at a set of times
+ * @param times times in seconds from the harmonic reference time
+ * @param numTimes number of times
+ * @param component 0 for elevation or u-velocity, 1 for v-velocity
+ * @param output array of numTimes * numNodes values, ordered by time then node
+ */
+void HarmonicsSynthesis::evaluate(const double *times, size_t numTimes,
+                                  size_t component, double *output) const {
+  if (component >= this->m_numComponents) {
+    adcircmodules_throw_exception("Component out of range");
+  }
+
+  std::vector<double> cs, sn;
+  this->phasors(times, numTimes, cs, sn);
+
+  const size_t nc = this->m_numConstituents;
+  const size_t nn = this->m_numNodes;
+  const double *pBase = this->m_p.data() + component * nc * nn;
+  const double *qBase = this->m_q.data() + component * nc * nn;
+  const size_t numBlocks = (nn + c_blockSize - 1) / c_blockSize;
+
+  //...Blocks of nodes are kept small enough that the output row stays in
+  // cache while each constituent is added to it
+#pragma omp parallel for schedule(static)
+  for (size_t b = 0; b < numBlocks; ++b) {
+    const size_t i0 = b * c_blockSize;
+    const size_t i1 = std::min(nn, i0 + c_blockSize);
+    for (size_t t = 0; t < numTimes; ++t) {
+      double *o = output + t * nn;
+      std::fill(o + i0, o + i1, 0.0);
+      for (size_t k = 0; k < nc; ++k) {
+        const double ck = cs[t * nc + k];
+        const double sk = sn[t * nc + k];
+        const double *p = pBase + k * nn;
+        const double *q = qBase + k * nn;
+#pragma omp simd
+        for (size_t i = i0; i < i1; ++i) {
+          o[i] += ck * p[i] + sk * q[i];
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Reconstructs a component at a single time
+ * @param time time in seconds from the harmonic reference time
+ * @param component 0 for elevation or u-velocity, 1 for v-velocity
+ * @return value at each node
+ */
+std::vector<double> HarmonicsSynthesis::evaluate(double time,
+                                                 size_t component) const {
+  std::vector<double> v(this->m_numNodes);
+  this->evaluate(&time, 1, component, v.data());
+  return v;
+}
+
+/**
+ * @brief Reconstructs a component at a series of times
+ * @param times times in seconds from the harmonic reference time
+ * @param component 0 for elevation or u-velocity, 1 for v-velocity
+ * @return values ordered as [time][node]
+ */
+std::vector<std::vector<double>> HarmonicsSynthesis::timeseries(
+    const std::vector<double> &times, size_t component) const {
+  std::vector<double> flat(times.size() * this->m_numNodes);
+  this->evaluate(times.data(), times.size(), component, flat.data());
+
+  std::vector<std::vector<double>> result(times.size());
+  for (size_t t = 0; t < times.size(); ++t) {
+    auto begin = flat.begin() + t * this->m_numNodes;
+    result[t].assign(begin, begin + this->m_numNodes);
+  }
+  return result;
+}
+
+/**
+ * @brief Reconstructs all components at a single time as an output record
+ * @param time time in seconds from the harmonic reference time
+ * @param record record number to assign
+ * @return output record with one value per reconstructed node
+ */
+Adcirc::Output::OutputRecord HarmonicsSynthesis::toOutputRecord(
+    double time, size_t record) const {
+  const bool isVector = this->m_numComponents == 2;
+  Adcirc::Output::OutputRecord r(record, this->m_numNodes, isVector, false,
+                                 this->m_numComponents);
+  r.setTime(time);
+  if (isVector) {
+    auto u = this->evaluate(time, 0);
+    auto v = this->evaluate(time, 1);
+    r.setAll(u, v);
+  } else {
+    r.setAll(this->evaluate(time, 0));
+  }
+  return r;
+}
@@ -0,0 +1,102 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_HARMONICSSYNTHESIS_H
+#define ADCMOD_HARMONICSSYNTHESIS_H
+
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "OutputRecord.h"
+
+namespace Adcirc {
+namespace Harmonics {
+
+class HarmonicsOutput;
+
+/**
+ * @class HarmonicsSynthesis
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Reconstructs water levels or velocities from harmonic constituents
+ *
+ * The value at a node is the sum over the constituents of
+ * f * A * cos(w * t + (V0 + u) - phase), where t is the time in seconds from
+ * the reference time of the harmonic analysis. Each term is expanded as
+ * cos(w * t + V0 + u) * f * A * cos(phase) +
+ * sin(w * t + V0 + u) * f * A * sin(phase) so that the node terms are
+ * computed once when the object is constructed. Evaluating a time is then a
+ * multiply and add over nodes for each constituent. For evenly spaced times,
+ * the cos and sin of each constituent are advanced with a rotation instead of
+ * being evaluated at every step.
+ *
+ * Elevation files have one component. Velocity files have two, u and v.
+ */
+class HarmonicsSynthesis {
+ public:
+  ADCIRCMODULES_EXPORT explicit HarmonicsSynthesis(
+      HarmonicsOutput *harmonics,
+      const std::vector<size_t> &nodes = std::vector<size_t>());
+
+  size_t ADCIRCMODULES_EXPORT numNodes() const;
+  size_t ADCIRCMODULES_EXPORT numConstituents() const;
+  size_t ADCIRCMODULES_EXPORT numComponents() const;
+
+  std::vector<double> ADCIRCMODULES_EXPORT evaluate(double time,
+                                                    size_t component = 0) const;
+
+  std::vector<std::vector<double>> ADCIRCMODULES_EXPORT
+  timeseries(const std::vector<double> &times, size_t component = 0) const;
+
+  Adcirc::Output::OutputRecord ADCIRCMODULES_EXPORT
+  toOutputRecord(double time, size_t record = 1) const;
+
+#ifndef SWIG
+  void ADCIRCMODULES_EXPORT evaluate(const double *times, size_t numTimes,
+                                     size_t component, double *output) const;
+#endif
+
+ private:
+  void phasors(const double *times, size_t numTimes, std::vector<double> &c,
+               std::vector<double> &s) const;
+
+  static constexpr size_t c_blockSize = 256;
+  static constexpr size_t c_resyncInterval = 256;
+
+  size_t m_numNodes;
+  size_t m_numConstituents;
+  size_t m_numComponents;
+
+  /// Angular frequency of each constituent, rad/s
+  std::vector<double> m_frequency;
+
+  /// Equilibrium argument of each constituent, radians
+  std::vector<double> m_equilibriumArg;
+
+  /// f * A * cos(phase) by component, constituent and node
+  std::vector<double> m_p;
+
+  /// f * A * sin(phase) by component, constituent and node
+  std::vector<double> m_q;
+};
+
+}  // namespace Harmonics
+}  // namespace Adcirc
+
+#endif  // ADCMOD_HARMONICSSYNTHESIS_H
@@ -18,7 +18,11 @@
 //------------------------------------------------------------------------*/
 #include "Hmdf.h"
 
+#include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 
 #if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
@@ -33,6 +37,7 @@
 #include "Logging.h"
 #include "NetcdfTimeseries.h"
 #include "Projection.h"
+#include "StringConversion.h"
 #include "boost/algorithm/string.hpp"
 #include "boost/algorithm/string/replace.hpp"
 #include "boost/format.hpp"
@@ -46,17 +51,246 @@ using namespace Adcirc::Output;
     return ierr;            \
   }
 
+namespace {
+
+/// Number of samples formatted by one task when writing text files
+constexpr size_t c_writeChunk = 8192;
+
+/// Number of formatting tasks held in memory before being written
+constexpr size_t c_writeBatch = 256;
+
+constexpr long long c_millisecondsPerDay = 86400000;
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+/**
+ * @brief Number of days between 1970-01-01 and a date in the proleptic
+ * Gregorian calendar. Days past the end of the month roll into the next month
+ * @param y year
+ * @param m month [1-12]
+ * @param d day of the month
+ * @return days since 1970-01-01
+ */
+long long daysFromCivil(long long y, unsigned m, unsigned d) {
+  y -= m <= 2;
+  const long long era = (y >= 0 ? y : y - 399) / 400;
+  const auto yoe = static_cast<unsigned>(y - era * 400);
+  const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + static_cast<long long>(doe) - 719468;
+}
+
+/**
+ * @brief Converts days since 1970-01-01 to a date in the proleptic Gregorian
+ * calendar
+ * @param[in] z days since 1970-01-01
+ * @param[out] y year
+ * @param[out] m month [1-12]
+ * @param[out] d day of the month [1-31]
+ */
+void civilFromDays(long long z, long long &y, unsigned &m, unsigned &d) {
+  z += 719468;
+  const long long era = (z >= 0 ? z : z - 146096) / 146097;
+  const auto doe = static_cast<unsigned>(z - era * 146097);
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const unsigned mp = (5 * doy + 2) / 153;
+  d = doy - (153 * mp + 2) / 5 + 1;
+  m = mp < 10 ? mp + 3 : mp - 9;
+  y = static_cast<long long>(yoe) + era * 400 + (m <= 2);
+}
+
+/**
+ * @brief Date and time of day decoded from milliseconds since the epoch
+ */
+struct CivilTime {
+  explicit CivilTime(long long epochMilliseconds) {
+    long long days = epochMilliseconds / c_millisecondsPerDay;
+    long long ms = epochMilliseconds - days * c_millisecondsPerDay;
+    if (ms < 0) {
+      days -= 1;
+      ms += c_millisecondsPerDay;
+    }
+    civilFromDays(days, year, month, day);
+    const auto t = static_cast<unsigned>(ms);
+    hour = t / 3600000;
+    minute = (t / 60000) % 60;
+    second = (t / 1000) % 60;
+    millisecond = t % 1000;
+  }
+  long long year;
+  unsigned month, day, hour, minute, second, millisecond;
+};
+
+/**
+ * @brief Writes a zero padded integer, equivalent to printf("%0*lli")
+ * @param[in] out output position
+ * @param[in] value value to write
+ * @param[in] width minimum number of digits
+ * @return position following the value
+ */
+char *writeInteger(char *out, long long value, int width) {
+  if (value < 0) {
+    *out++ = '-';
+    value = -value;
+  }
+  char digits[24];
+  int n = 0;
+  do {
+    digits[n++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  for (int i = n; i < width; ++i) *out++ = '0';
+  while (n > 0) *out++ = digits[--n];
+  return out;
+}
+
+/**
+ * @brief Reads a two digit field from a fixed format date
+ */
+unsigned fixedField(const char *p) {
+  return static_cast<unsigned>(p[0] - '0') * 10 +
+         static_cast<unsigned>(p[1] - '0');
+}
+
+/**
+ * @brief Checks if a line begins with a date in the form "YYYY MM DD HH mm"
+ * @param[in] p start of the date
+ * @param[in] end end of the line
+ * @return true if the fixed format can be read without further checks
+ */
+bool isFixedImedsDate(const char *p, const char *end) {
+  if (end - p < 17 || isDigit(p[16])) return false;
+  static const char pattern[] = "dddd dd dd dd dd";
+  for (size_t i = 0; i < 16; ++i) {
+    if (pattern[i] == 'd' ? !isDigit(p[i]) : p[i] != ' ') return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Parses an IMEDS data line of the form "YYYY MM DD HH mm [ss] value"
+ * @param[in] p start of the line
+ * @param[in] end end of the line
+ * @param[out] time milliseconds since 1970-01-01 00:00:00
+ * @param[out] value data value
+ * @return true if the line is a valid data line
+ */
+bool parseImedsLine(const char *p, const char *end, long long &time,
+                    double &value) {
+  while (p < end && (*p == ' ' || *p == '\t')) ++p;
+
+  size_t f[5];
+  if (isFixedImedsDate(p, end)) {
+    f[0] = fixedField(p) * 100 + fixedField(p + 2);
+    f[1] = fixedField(p + 5);
+    f[2] = fixedField(p + 8);
+    f[3] = fixedField(p + 11);
+    f[4] = fixedField(p + 14);
+    p += 16;
+  } else {
+    for (auto &v : f) {
+      if (!Adcirc::StringConversion::parseSizet(p, end, v)) return false;
+    }
+  }
+  if (f[1] < 1 || f[1] > 12 || f[2] < 1 || f[2] > 31 || f[3] > 24 ||
+      f[4] > 60) {
+    return false;
+  }
+
+  double a, b;
+  if (!Adcirc::StringConversion::parseDouble(p, end, a)) return false;
+  long long second = 0;
+  if (Adcirc::StringConversion::parseDouble(p, end, b)) {
+    if (a < 0.0 || a > 60.0 || a != std::floor(a)) return false;
+    second = static_cast<long long>(a);
+    value = b;
+  } else {
+    value = a;
+  }
+
+  const long long days = daysFromCivil(static_cast<long long>(f[0]),
+                                       static_cast<unsigned>(f[1]),
+                                       static_cast<unsigned>(f[2]));
+  time = ((days * 24 + static_cast<long long>(f[3])) * 60 +
+          static_cast<long long>(f[4])) *
+             60000 +
+         second * 1000;
+  return true;
+}
+
+/**
+ * @brief Formats the stations of a file in parallel and writes the text in
+ * station order
+ * @param[in] out output file
+ * @param[in] stations stations to write
+ * @param[in] format function called as format(station index, first sample,
+ * end sample, text) that appends the text for a range of samples. The header
+ * is written with the first sample and any trailer with the last
+ *
+ * Long time series are split into chunks so that the work is balanced when
+ * a file has only a few stations, and only a limited number of chunks is held
+ * in memory before being written.
+ */
+template <typename Formatter>
+void writeStationText(std::ofstream &out,
+                      const std::vector<Adcirc::Output::HmdfStation> &stations,
+                      const Formatter &format) {
+  struct Task {
+    size_t station;
+    size_t begin;
+    size_t end;
+  };
+
+  std::vector<Task> tasks;
+  for (size_t s = 0; s < stations.size(); ++s) {
+    const size_t n = stations[s].numSnaps();
+    size_t i = 0;
+    do {
+      const size_t e = std::min(n, i + c_writeChunk);
+      tasks.push_back({s, i, e});
+      i = e;
+    } while (i < n);
+  }
+
+  std::vector<std::string> text(std::min(tasks.size(), c_writeBatch));
+  for (size_t t0 = 0; t0 < tasks.size(); t0 += c_writeBatch) {
+    const size_t t1 = std::min(tasks.size(), t0 + c_writeBatch);
+#pragma omp parallel for schedule(dynamic)
+    for (size_t t = t0; t < t1; ++t) {
+      std::string &s = text[t - t0];
+      s.clear();
+      format(tasks[t].station, tasks[t].begin, tasks[t].end, s);
+    }
+    for (size_t t = t0; t < t1; ++t) {
+      out.write(text[t - t0].data(),
+                static_cast<std::streamsize>(text[t - t0].size()));
+    }
+  }
+}
+
+}  // namespace
+
 Hmdf::Hmdf(size_t dimension)
-    : m_dimension(dimension), m_success(false), m_null(true), m_epsg(-1) {}
+    : m_dimension(dimension),
+      m_success(false),
+      m_null(true),
+      m_epsg(-1),
+      m_netcdfLayout(HmdfNetcdfLegacy) {}
 
 Hmdf::Hmdf(size_t dimension, const Adcirc::Output::Hmdf *stations)
-    : m_dimension(dimension), m_success(false), m_null(true), m_epsg(-1) {
+    : m_dimension(dimension),
+      m_success(false),
+      m_null(true),
+      m_epsg(-1),
+      m_netcdfLayout(HmdfNetcdfLegacy) {
   for (auto i = 0; i < stations->nstations(); ++i) {
     HmdfStation s(dimension);
     s.setLongitude(stations->station(i)->longitude());
     s.setLatitude(stations->station(i)->latitude());
     s.setName(stations->station(i)->name());
     s.setId(stations->station(i)->id());
+    s.setPositiveDirection(stations->station(i)->positiveDirection());
     this->addStation(s);
   }
 }
@@ -65,6 +299,25 @@ int Hmdf::getEpsg() const { return this->m_epsg; }
 
 void Hmdf::setEpsg(int epsg) { this->m_epsg = epsg; }
 
+/**
+ * @brief Layout used when writing netCDF files
+ * @return netCDF layout
+ */
+Hmdf::HmdfNetcdfLayout Hmdf::netcdfLayout() const {
+  return this->m_netcdfLayout;
+}
+
+/**
+ * @brief Sets the layout used when writing netCDF files. The legacy layout
+ * defines a dimension and a pair of variables for every station. The DSG
+ * layout follows the CF discrete sampling geometry conventions and holds all
+ * stations in a single set of variables
+ * @param layout netCDF layout
+ */
+void Hmdf::setNetcdfLayout(Hmdf::HmdfNetcdfLayout layout) {
+  this->m_netcdfLayout = layout;
+}
+
 void Hmdf::reproject(int epsg) {
   if (this->m_epsg == -1) {
     adcircmodules_throw_exception(
@@ -167,59 +420,128 @@ bool Hmdf::null() const { return this->m_null; }
 
 void Hmdf::setNull(bool null) { this->m_null = null; }
 
+/**
+ * @brief Reads an IMEDS format file
+ * @param filename name of the file to read
+ * @return 0 on success
+ *
+ * The file is read into memory in a single pass. Line starts are located
+ * first, then every line is decoded in parallel as either a data line or a
+ * station header. The data lines following each header are then gathered
+ * into the stations in parallel.
+ */
 int Hmdf::readImeds(const std::string &filename) {
   if (this->m_dimension > 1) {
     adcircmodules_throw_exception(
         "imeds format files cannot contain vector data.");
   }
-  std::ifstream fid(filename.c_str());
-  if (fid.bad()) return -1;
+  std::ifstream fid(filename.c_str(), std::ios::binary);
+  if (!fid.is_open() || fid.bad()) return -1;
+
+  std::string buffer;
+  fid.seekg(0, std::ios::end);
+  buffer.resize(static_cast<size_t>(fid.tellg()));
+  fid.seekg(0, std::ios::beg);
+  fid.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+  fid.close();
+
+  const char *const end = buffer.data() + buffer.size();
+  std::vector<const char *> lines;
+  for (const char *p = buffer.data(); p < end;) {
+    lines.push_back(p);
+    const void *nl = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    p = nl == nullptr ? end : static_cast<const char *>(nl) + 1;
+  }
+  lines.push_back(end);
+  const size_t nLines = lines.size() - 1;
 
   //...Read Header
-  std::string templine;
-  std::getline(fid, templine);
-  this->m_header1 = Adcirc::FileIO::Generic::sanitizeString(templine);
-  std::getline(fid, templine);
-  this->m_header2 = Adcirc::FileIO::Generic::sanitizeString(templine);
-  std::getline(fid, templine);
-  this->m_header3 = Adcirc::FileIO::Generic::sanitizeString(templine);
+  std::string *headers[3] = {&this->m_header1, &this->m_header2,
+                             &this->m_header3};
+  for (size_t i = 0; i < 3; ++i) {
+    *(headers[i]) =
+        i < nLines ? Adcirc::FileIO::Generic::sanitizeString(
+                         std::string(lines[i], lines[i + 1]))
+                   : std::string();
+  }
 
-  //...Read Body
-  std::getline(fid, templine);
+  //...Classify and decode the body
+  enum LineType : char { Blank, Header, Data };
+  const size_t first = std::min<size_t>(3, nLines);
+  std::vector<long long> time(nLines);
+  std::vector<double> value(nLines);
+  std::vector<LineType> type(nLines, Blank);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = first; i < nLines; ++i) {
+    const char *p = lines[i];
+    const char *const e = lines[i + 1];
+    while (p < e && std::isspace(static_cast<unsigned char>(*p))) ++p;
+    if (p == e) {
+      type[i] = Blank;
+    } else if (parseImedsLine(p, e, time[i], value[i])) {
+      type[i] = Data;
+    } else {
+      type[i] = Header;
+    }
+  }
 
-  while (!fid.eof()) {
-    HmdfStation station(1);
+  //...Each station begins at a line that is not a data line. The first line
+  // of the body is always a station
+  std::vector<size_t> blocks;
+  for (size_t i = first; i < nLines; ++i) {
+    if (type[i] == Header || (type[i] == Data && blocks.empty())) {
+      blocks.push_back(i);
+    }
+  }
+  blocks.push_back(nLines);
 
-    templine = Adcirc::FileIO::Generic::sanitizeString(templine);
+  const size_t nStations = blocks.size() - 1;
+  const size_t offset = this->m_station.size();
+  this->m_station.resize(offset + nStations, HmdfStation(1));
+  bool error = false;
 
-    std::vector<std::string> templist;
-    Adcirc::FileIO::Generic::splitString(templine, templist);
+#pragma omp parallel for schedule(dynamic)
+  for (size_t b = 0; b < nStations; ++b) {
+    HmdfStation &station = this->m_station[offset + b];
 
+    std::string headerLine = Adcirc::FileIO::Generic::sanitizeString(
+        std::string(lines[blocks[b]], lines[blocks[b] + 1]));
+    std::vector<std::string> templist;
+    Adcirc::FileIO::Generic::splitString(headerLine, templist);
+    bool ok = templist.size() >= 3;
+    double latitude = 0.0, longitude = 0.0;
+    if (ok) {
+      latitude = Adcirc::StringConversion::stringToDouble(templist[1], ok);
+    }
+    if (ok) {
+      longitude = Adcirc::StringConversion::stringToDouble(templist[2], ok);
+    }
+    if (!ok) {
+#pragma omp atomic write
+      error = true;
+      continue;
+    }
     station.setName(templist[0]);
-    station.setLongitude(stod(templist[2]));
-    station.setLatitude(stod(templist[1]));
-
-    while (!fid.eof()) {
-      std::getline(fid, templine);
-
-      int year, month, day, hour, minute, second;
-      double value;
-
-      bool status = Adcirc::FileIO::HMDFIO::splitStringHmdfFormat(
-          templine, year, month, day, hour, minute, second, value);
-
-      if (status) {
-        Adcirc::CDate d(year, month, day, hour, minute, second);
-
-        //...Append to the station data
-        station.setNext(d, value);
-      } else {
-        break;
+    station.setLatitude(latitude);
+    station.setLongitude(longitude);
+
+    std::vector<long long> t;
+    std::vector<double> v;
+    t.reserve(blocks[b + 1] - blocks[b]);
+    v.reserve(blocks[b + 1] - blocks[b]);
+    for (size_t i = blocks[b] + 1; i < blocks[b + 1]; ++i) {
+      if (type[i] == Data) {
+        t.push_back(time[i]);
+        v.push_back(value[i]);
       }
     }
+    station.setTimeseries(std::move(t), std::move(v));
+  }
 
-    //...Add the station
-    this->addStation(station);
+  if (error) {
+    this->m_station.resize(offset);
+    adcircmodules_throw_exception("Error reading imeds station header");
   }
 
   this->setNull(false);
@@ -228,12 +550,9 @@ int Hmdf::readImeds(const std::string &filename) {
 }
 
 int Hmdf::readNetcdf(const std::string &filename, bool stationsOnly) {
-  if (this->m_dimension > 1) {
-    adcircmodules_throw_exception(
-        "generic netcdf format files cannot contain vector data.");
-  }
   NetcdfTimeseries ncts;
   ncts.setFilename(filename);
+  ncts.setDimension(this->m_dimension);
   int ierr = ncts.read(stationsOnly);
   if (ierr != 0) {
     return 1;
@@ -262,67 +581,111 @@ void Hmdf::copyStationList(Adcirc::Output::Hmdf &templateStations) {
 }
 
 int Hmdf::writeCsv(const std::string &filename) {
-  std::string value;
-  std::ofstream out(filename);
-
-  for (size_t s = 0; s < this->nstations(); ++s) {
-    out << boost::str(boost::format("Station %4.4i\n") % (s + 1));
-    out << boost::str(boost::format("Datum: %s\n") % this->datum());
-    out << boost::str(boost::format("Units: %s\n") % this->units());
-
-    for (size_t i = 0; i < this->station(s)->numSnaps(); i++) {
-      if (this->m_dimension == 2) {
-        double value1 = this->station(s)->data(i, 0);
-        double value2 = this->station(s)->data(i, 1);
-        out << boost::str(boost::format("%s,%10.4e,%10.4e\n") %
-                          this->station(s)->date(i).toString() % value1 %
-                          value2);
+  std::ofstream out(filename, std::ios::binary);
+
+  const std::string datum = this->datum();
+  const std::string units = this->units();
+  const bool isVector = this->m_dimension == 2;
+
+  auto format = [&](size_t s, size_t begin, size_t end, std::string &text) {
+    const HmdfStation &st = this->m_station[s];
+    if (begin == 0) {
+      text += boost::str(boost::format("Station %4.4i\n") % (s + 1));
+      text += "Datum: " + datum + "\n";
+      text += "Units: " + units + "\n";
+    }
+    text.reserve(text.size() + (end - begin) * (isVector ? 56 : 40) + 3);
+
+    const long long *t = st.epochMillisecondsView()->data();
+    const double *u = st.dataView(0)->data();
+    const double *v = isVector ? st.dataView(1)->data() : nullptr;
+    char line[128];
+    for (size_t i = begin; i < end; ++i) {
+      const CivilTime d(t[i]);
+      char *c = writeInteger(line, d.year, 4);
+      *c++ = '-';
+      c = writeInteger(c, d.month, 2);
+      *c++ = '-';
+      c = writeInteger(c, d.day, 2);
+      *c++ = ' ';
+      c = writeInteger(c, d.hour, 2);
+      *c++ = ':';
+      c = writeInteger(c, d.minute, 2);
+      *c++ = ':';
+      c = writeInteger(c, d.second, 2);
+      *c++ = '.';
+      c = writeInteger(c, d.millisecond, 4);
+      if (isVector) {
+        c += std::snprintf(c, 80, ",%10.4e,%10.4e\n", u[i], v[i]);
       } else {
-        double value = this->station(s)->data(i);
-        out << boost::str(boost::format("%s,%10.4e\n") %
-                          this->station(s)->date(i).toString() % value);
+        c += std::snprintf(c, 80, ",%10.4e\n", u[i]);
       }
+      text.append(line, c);
     }
-    out << "\n\n\n";
-  }
+
+    if (end == st.numSnaps()) text += "\n\n\n";
+  };
+
+  writeStationText(out, this->m_station, format);
   out.close();
   return 0;
 }
 
 int Hmdf::writeImeds(const std::string &filename) {
-  std::string value;
-  std::ofstream out(filename);
+  std::ofstream out(filename, std::ios::binary);
 
   out << "% IMEDS generic format\n";
   out << "% year month day hour min sec value\n";
   out << "% ADCIRCModules UTC " << this->datum() << " " << this->units()
       << "\n";
 
-  for (size_t s = 0; s < this->nstations(); ++s) {
-    std::string stationname = this->station(s)->name();
-    boost::algorithm::replace_all(stationname, " ", "_");
-    boost::algorithm::replace_all(stationname, ",", "_");
-    boost::algorithm::replace_all(stationname, "__", "_");
-
-    out << boost::str(boost::format("%s   %16.10f   %16.10f\n") % stationname %
-                      this->station(s)->latitude() %
-                      this->station(s)->longitude());
-
-    for (size_t i = 0; i < this->station(s)->numSnaps(); ++i) {
-      double value = this->station(s)->data(i);
-      out << boost::str(
-          boost::format("%04.4i %02.2i %02.2i %02.2i %02.2i %02.2i %10.6e\n") %
-          this->station(s)->date(i).year() % this->station(s)->date(i).month() %
-          this->station(s)->date(i).day() % this->station(s)->date(i).hour() %
-          this->station(s)->date(i).minute() %
-          this->station(s)->date(i).second() % value);
+  auto format = [&](size_t s, size_t begin, size_t end, std::string &text) {
+    const HmdfStation &st = this->m_station[s];
+    if (begin == 0) {
+      std::string stationname = st.name();
+      boost::algorithm::replace_all(stationname, " ", "_");
+      boost::algorithm::replace_all(stationname, ",", "_");
+      boost::algorithm::replace_all(stationname, "__", "_");
+      text += boost::str(boost::format("%s   %16.10f   %16.10f\n") %
+                         stationname % st.latitude() % st.longitude());
     }
-  }
+    text.reserve(text.size() + (end - begin) * 36);
+
+    const long long *t = st.epochMillisecondsView()->data();
+    const double *u = st.dataView(0)->data();
+    char line[96];
+    for (size_t i = begin; i < end; ++i) {
+      const CivilTime d(t[i]);
+      char *c = writeInteger(line, d.year, 4);
+      *c++ = ' ';
+      c = writeInteger(c, d.month, 2);
+      *c++ = ' ';
+      c = writeInteger(c, d.day, 2);
+      *c++ = ' ';
+      c = writeInteger(c, d.hour, 2);
+      *c++ = ' ';
+      c = writeInteger(c, d.minute, 2);
+      *c++ = ' ';
+      c = writeInteger(c, d.second, 2);
+      c += std::snprintf(c, 64, " %10.6e\n", u[i]);
+      text.append(line, c);
+    }
+  };
+
+  writeStationText(out, this->m_station, format);
   out.close();
   return 0;
 }
 
 int Hmdf::writeNetcdf(const std::string &filename) {
+  if (this->m_netcdfLayout == HmdfNetcdfDsg) {
+    return this->writeNetcdfDsg(filename);
+  } else {
+    return this->writeNetcdfLegacy(filename);
+  }
+}
+
+int Hmdf::writeNetcdfLegacy(const std::string &filename) {
   int ncid;
   int dimid_nstations, dimid_stationNameLength;
   int varid_stationName, varid_stationx, varid_stationy;
@@ -425,6 +788,286 @@ int Hmdf::writeNetcdf(const std::string &filename) {
   }
 
   //...Metadata
+  NCCHECK(this->putNetcdfGlobalAttributes(ncid, "20180123"))
+  NCCHECK(nc_enddef(ncid))
+
+  for (size_t i = 0; i < this->nstations(); i++) {
+    size_t index[] = {i, 0};
+    size_t stindex[] = {i};
+    size_t count[] = {1, this->station(i)->name().size()};
+    double lat[] = {this->station(i)->latitude()};
+    double lon[] = {this->station(i)->longitude()};
+
+    const std::vector<long long> &epochMs =
+        *this->station(i)->epochMillisecondsView();
+    std::vector<long long> time(epochMs.size());
+    for (size_t j = 0; j < epochMs.size(); j++) {
+      time[j] = epochMs[j] / 1000;
+    }
+
+    NCCHECK(nc_put_var1_double(ncid, varid_stationx, stindex, lon))
+    NCCHECK(nc_put_var1_double(ncid, varid_stationy, stindex, lat))
+    NCCHECK(nc_put_var_longlong(ncid, varid_stationDate[i], time.data()))
+    NCCHECK(nc_put_var_double(ncid, varid_stationData[i],
+                              this->station(i)->dataView()->data()))
+    NCCHECK(nc_put_vara_text(ncid, varid_stationName, index, count,
+                             &this->station(i)->name()[0]))
+    NCCHECK(nc_put_vara_text(ncid, varid_stationId, index, count,
+                             &this->station(i)->id()[0]))
+  }
+
+  nc_close(ncid);
+
+  return 0;
+}
+
+/**
+ * @brief Checks if every station has the same sample times
+ * @return true if all stations share the times of the first station
+ */
+bool Hmdf::hasCommonTimes() const {
+  if (this->m_station.empty()) return true;
+  const std::vector<long long> &t0 =
+      *this->m_station[0].epochMillisecondsView();
+  for (size_t i = 1; i < this->m_station.size(); ++i) {
+    if (*this->m_station[i].epochMillisecondsView() != t0) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Writes the stations using the CF discrete sampling geometry
+ * conventions for time series
+ * @param filename name of the output file
+ * @return 0 on success, otherwise the netCDF error code
+ *
+ * When every station has the same sample times, the data is written as an
+ * orthogonal [station, time] array. Otherwise the stations are written as a
+ * contiguous ragged array and row_size holds the number of samples for each
+ * station. Vector data is written as data_u and data_v. Each variable is
+ * written with a single call. Orthogonal data is chunked one station at a
+ * time. netCDF chunks have a fixed size, so ragged arrays are chunked at the
+ * length of the longest station, up to 262144 samples, and a station that
+ * fits in one chunk is read from at most two.
+ */
+int Hmdf::writeNetcdfDsg(const std::string &filename) {
+  constexpr size_t c_nameLength = 200;
+  constexpr size_t c_chunkSize = 262144;
+  constexpr double c_fillValue = -99999.0;
+
+  const size_t ns = this->nstations();
+  const bool orthogonal = this->hasCommonTimes();
+
+  size_t nsample = 0;
+  size_t longestStation = 0;
+  if (orthogonal) {
+    nsample = ns > 0 ? this->m_station[0].numSnaps() : 0;
+    longestStation = nsample;
+  } else {
+    for (const auto &st : this->m_station) {
+      nsample += st.numSnaps();
+      longestStation = std::max(longestStation, st.numSnaps());
+    }
+  }
+
+  int ncid;
+  int dimid_station, dimid_nameLength, dimid_sample;
+  int varid_stationName, varid_stationId, varid_stationx, varid_stationy;
+  int varid_time, varid_rowSize = -1;
+  std::vector<int> varid_data(this->m_dimension);
+
+  //...Open file
+  NCCHECK(nc_create(filename.c_str(), NC_NETCDF4, &ncid))
+
+  //...Dimensions
+  NCCHECK(nc_def_dim(ncid, "numStations", ns, &dimid_station))
+  NCCHECK(nc_def_dim(ncid, "stationNameLen", c_nameLength, &dimid_nameLength))
+  NCCHECK(nc_def_dim(ncid, orthogonal ? "time" : "obs", nsample, &dimid_sample))
+
+  //...Station variables
+  const int nameDims[2] = {dimid_station, dimid_nameLength};
+  const int stationDims[1] = {dimid_station};
+  const int sampleDims[1] = {dimid_sample};
+  const int dataDims[2] = {dimid_station, dimid_sample};
+  const int wgs84[1] = {4326};
+  const std::string timeseriesId = "timeseries_id";
+  const std::string longitude = "longitude";
+  const std::string latitude = "latitude";
+  const std::string degreesEast = "degrees_east";
+  const std::string degreesNorth = "degrees_north";
+
+  NCCHECK(nc_def_var(ncid, "stationName", NC_CHAR, 2, nameDims,
+                     &varid_stationName))
+  NCCHECK(nc_put_att_text(ncid, varid_stationName, "cf_role",
+                          timeseriesId.length(), timeseriesId.c_str()))
+  NCCHECK(
+      nc_def_var(ncid, "stationId", NC_CHAR, 2, nameDims, &varid_stationId))
+  NCCHECK(nc_def_var(ncid, "stationXCoordinate", NC_DOUBLE, 1, stationDims,
+                     &varid_stationx))
+  NCCHECK(nc_def_var(ncid, "stationYCoordinate", NC_DOUBLE, 1, stationDims,
+                     &varid_stationy))
+  NCCHECK(nc_put_att_text(ncid, varid_stationx, "standard_name",
+                          longitude.length(), longitude.c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_stationy, "standard_name",
+                          latitude.length(), latitude.c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_stationx, "units", degreesEast.length(),
+                          degreesEast.c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_stationy, "units",
+                          degreesNorth.length(), degreesNorth.c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_stationx, "HorizontalProjectionName", 5,
+                          "WGS84"))
+  NCCHECK(nc_put_att_text(ncid, varid_stationy, "HorizontalProjectionName", 5,
+                          "WGS84"))
+  NCCHECK(nc_put_att_int(ncid, varid_stationx, "HorizontalProjectionEPSG",
+                         NC_INT, 1, wgs84))
+  NCCHECK(nc_put_att_int(ncid, varid_stationy, "HorizontalProjectionEPSG",
+                         NC_INT, 1, wgs84))
+
+  //...Sample variables
+  const std::string timeName = "time";
+  const std::string timeUnits = "milliseconds since 1970-01-01 00:00:00";
+  const std::string calendar = "standard";
+  const size_t sampleChunk[1] = {std::max<size_t>(
+      1, std::min(longestStation, c_chunkSize))};
+
+  NCCHECK(nc_def_var(ncid, "time", NC_INT64, 1, sampleDims, &varid_time))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "standard_name", timeName.length(),
+                          timeName.c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "units", timeUnits.length(),
+                          timeUnits.c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "calendar", calendar.length(),
+                          calendar.c_str()))
+  NCCHECK(nc_put_att_text(ncid, varid_time, "timezone", 3, "utc"))
+  if (nsample > 0) {
+    NCCHECK(nc_def_var_chunking(ncid, varid_time, NC_CHUNKED, sampleChunk))
+  }
+  NCCHECK(nc_def_var_deflate(ncid, varid_time, 1, 1, 2))
+
+  if (!orthogonal) {
+    const std::string rowSizeName = "number of observations for this station";
+    const std::string sampleDimension = "obs";
+    NCCHECK(nc_def_var(ncid, "row_size", NC_INT64, 1, stationDims,
+                       &varid_rowSize))
+    NCCHECK(nc_put_att_text(ncid, varid_rowSize, "long_name",
+                            rowSizeName.length(), rowSizeName.c_str()))
+    NCCHECK(nc_put_att_text(ncid, varid_rowSize, "sample_dimension",
+                            sampleDimension.length(), sampleDimension.c_str()))
+  }
+
+  const std::string coordinates =
+      "time stationYCoordinate stationXCoordinate stationName";
+  const size_t dataChunk[2] = {1, sampleChunk[0]};
+  for (size_t d = 0; d < this->m_dimension; ++d) {
+    std::string name = "data";
+    if (this->m_dimension == 2) name = d == 0 ? "data_u" : "data_v";
+    int &v = varid_data[d];
+    if (orthogonal) {
+      NCCHECK(nc_def_var(ncid, name.c_str(), NC_DOUBLE, 2, dataDims, &v))
+      if (nsample > 0 && ns > 0) {
+        NCCHECK(nc_def_var_chunking(ncid, v, NC_CHUNKED, dataChunk))
+      }
+    } else {
+      NCCHECK(nc_def_var(ncid, name.c_str(), NC_DOUBLE, 1, sampleDims, &v))
+      if (nsample > 0) {
+        NCCHECK(nc_def_var_chunking(ncid, v, NC_CHUNKED, sampleChunk))
+      }
+    }
+    NCCHECK(nc_def_var_fill(ncid, v, 0, &c_fillValue))
+    NCCHECK(nc_put_att_text(ncid, v, "coordinates", coordinates.length(),
+                            coordinates.c_str()))
+    NCCHECK(nc_put_att_text(ncid, v, "units", this->units().length(),
+                            this->units().c_str()))
+    NCCHECK(nc_put_att_text(ncid, v, "datum", this->datum().length(),
+                            this->datum().c_str()))
+    NCCHECK(nc_def_var_deflate(ncid, v, 1, 1, 2))
+  }
+
+  //...Metadata
+  const std::string featureType = "timeSeries";
+  const std::string conventions = "CF-1.8";
+  NCCHECK(nc_put_att_text(ncid, NC_GLOBAL, "featureType", featureType.length(),
+                          featureType.c_str()))
+  NCCHECK(nc_put_att_text(ncid, NC_GLOBAL, "Conventions", conventions.length(),
+                          conventions.c_str()))
+  NCCHECK(this->putNetcdfGlobalAttributes(ncid, "20261019"))
+  NCCHECK(nc_enddef(ncid))
+
+  //...Station data
+  std::string names(ns * c_nameLength, '\0');
+  std::string ids(ns * c_nameLength, '\0');
+  std::vector<double> x(ns), y(ns);
+  for (size_t i = 0; i < ns; ++i) {
+    const HmdfStation &st = this->m_station[i];
+    const std::string name = st.name().substr(0, c_nameLength);
+    const std::string id = st.id().substr(0, c_nameLength);
+    std::copy(name.begin(), name.end(), names.begin() + i * c_nameLength);
+    std::copy(id.begin(), id.end(), ids.begin() + i * c_nameLength);
+    x[i] = st.longitude();
+    y[i] = st.latitude();
+  }
+  NCCHECK(nc_put_var_text(ncid, varid_stationName, &names[0]))
+  NCCHECK(nc_put_var_text(ncid, varid_stationId, &ids[0]))
+  NCCHECK(nc_put_var_double(ncid, varid_stationx, x.data()))
+  NCCHECK(nc_put_var_double(ncid, varid_stationy, y.data()))
+
+  //...Time and row sizes
+  if (orthogonal) {
+    if (ns > 0 && nsample > 0) {
+      NCCHECK(nc_put_var_longlong(
+          ncid, varid_time, this->m_station[0].epochMillisecondsView()->data()))
+    }
+  } else {
+    std::vector<long long> time;
+    std::vector<long long> rowSize(ns);
+    time.reserve(nsample);
+    for (size_t i = 0; i < ns; ++i) {
+      const std::vector<long long> &t =
+          *this->m_station[i].epochMillisecondsView();
+      time.insert(time.end(), t.begin(), t.end());
+      rowSize[i] = static_cast<long long>(t.size());
+    }
+    if (nsample > 0) {
+      NCCHECK(nc_put_var_longlong(ncid, varid_time, time.data()))
+    }
+    NCCHECK(nc_put_var_longlong(ncid, varid_rowSize, rowSize.data()))
+  }
+
+  //...Data. Null values are written as the fill value. Both layouts store
+  // the stations one after another, so the buffer is built the same way
+  std::vector<double> buffer(orthogonal ? ns * nsample : nsample);
+  for (size_t d = 0; d < this->m_dimension; ++d) {
+    size_t offset = 0;
+    for (size_t i = 0; i < ns; ++i) {
+      const HmdfStation &st = this->m_station[i];
+      const std::vector<double> &v = *st.dataView(d);
+      const double nullValue = st.nullValue();
+      for (size_t j = 0; j < v.size(); ++j) {
+        const double value = v[j];
+        buffer[offset + j] = value == nullValue ||
+                                     value == HmdfStation::nullDataValue()
+                                 ? c_fillValue
+                                 : value;
+      }
+      offset += v.size();
+    }
+    if (!buffer.empty()) {
+      NCCHECK(nc_put_var_double(ncid, varid_data[d], buffer.data()))
+    }
+  }
+
+  NCCHECK(nc_close(ncid))
+
+  return 0;
+}
+
+/**
+ * @brief Writes the global attributes describing where and when the file was
+ * created
+ * @param ncid netCDF file id
+ * @param format file format version string
+ * @return 0 on success, otherwise the netCDF error code
+ */
+int Hmdf::putNetcdfGlobalAttributes(int ncid, const std::string &format) const {
 #if defined(__unix__) || defined(__APPLE__)
   char hostname[256];
   gethostname(hostname, 256);
@@ -449,48 +1092,31 @@ int Hmdf::writeNetcdf(const std::string &filename) {
   std::string createTime = Adcirc::CDate::now().toString();
   std::string source = "ADCIRCModules";
   std::string ncVersion = std::string(nc_inq_libvers());
-  std::string format = "20180123";
-
-  NCCHECK(nc_put_att(ncid, NC_GLOBAL, "source", NC_CHAR, source.length(),
-                     source.c_str()))
-  NCCHECK(nc_put_att(ncid, NC_GLOBAL, "creation_date", NC_CHAR,
-                     createTime.length(), createTime.c_str()))
-  NCCHECK(nc_put_att(ncid, NC_GLOBAL, "created_by", NC_CHAR, name.length(),
-                     name.c_str()))
-  NCCHECK(
-      nc_put_att(ncid, NC_GLOBAL, "host", NC_CHAR, host.length(), host.c_str()))
-  NCCHECK(nc_put_att(ncid, NC_GLOBAL, "netCDF_version", NC_CHAR,
-                     ncVersion.length(), ncVersion.c_str()))
-  NCCHECK(nc_put_att(ncid, NC_GLOBAL, "fileformat", NC_CHAR, format.length(),
-                     format.c_str()))
-  NCCHECK(nc_enddef(ncid))
-
-  for (size_t i = 0; i < this->nstations(); i++) {
-    size_t index[] = {i, 0};
-    size_t stindex[] = {i};
-    size_t count[] = {1, this->station(i)->name().size()};
-    double lat[] = {this->station(i)->latitude()};
-    double lon[] = {this->station(i)->longitude()};
-
-    std::vector<long long> time(this->station(i)->numSnaps());
-    for (size_t j = 0; j < this->station(i)->numSnaps(); j++) {
-      time[j] = this->station(i)->date(j).toSeconds();
-    }
 
-    NCCHECK(nc_put_var1_double(ncid, varid_stationx, stindex, lon))
-    NCCHECK(nc_put_var1_double(ncid, varid_stationy, stindex, lat))
-    NCCHECK(nc_put_var_longlong(ncid, varid_stationDate[i], time.data()))
-    NCCHECK(nc_put_var_double(ncid, varid_stationData[i],
-                              this->station(i)->allData().data()))
-    NCCHECK(nc_put_vara_text(ncid, varid_stationName, index, count,
-                             &this->station(i)->name()[0]))
-    NCCHECK(nc_put_vara_text(ncid, varid_stationId, index, count,
-                             &this->station(i)->id()[0]))
+  int ierr;
+  if ((ierr = nc_put_att(ncid, NC_GLOBAL, "source", NC_CHAR, source.length(),
+                         source.c_str())) != NC_NOERR) {
+    return ierr;
   }
-
-  nc_close(ncid);
-
-  return 0;
+  if ((ierr = nc_put_att(ncid, NC_GLOBAL, "creation_date", NC_CHAR,
+                         createTime.length(), createTime.c_str())) !=
+      NC_NOERR) {
+    return ierr;
+  }
+  if ((ierr = nc_put_att(ncid, NC_GLOBAL, "created_by", NC_CHAR,
+                         name.length(), name.c_str())) != NC_NOERR) {
+    return ierr;
+  }
+  if ((ierr = nc_put_att(ncid, NC_GLOBAL, "host", NC_CHAR, host.length(),
+                         host.c_str())) != NC_NOERR) {
+    return ierr;
+  }
+  if ((ierr = nc_put_att(ncid, NC_GLOBAL, "netCDF_version", NC_CHAR,
+                         ncVersion.length(), ncVersion.c_str())) != NC_NOERR) {
+    return ierr;
+  }
+  return nc_put_att(ncid, NC_GLOBAL, "fileformat", NC_CHAR, format.length(),
+                    format.c_str());
 }
 
 int Hmdf::writeAdcirc(const std::string &filename) {
@@ -597,8 +1223,8 @@ int Hmdf::write(const std::string &filename) {
 
 void Hmdf::dataBounds(CDate &dateMin, CDate &dateMax, double &minValue,
                       double &maxValue) {
-  dateMax = CDate::maxDate();
-  dateMin = CDate::minDate();
+  dateMin = CDate::maxDate();
+  dateMax = CDate::minDate();
   maxValue = -std::numeric_limits<double>::max();
   minValue = std::numeric_limits<double>::max();
 
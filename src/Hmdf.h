@@ -41,6 +41,8 @@ class Hmdf {
 
   enum HmdfFileType { HmdfImeds, HmdfCsv, HmdfNetCdf, HmdfAdcirc };
 
+  enum HmdfNetcdfLayout { HmdfNetcdfLegacy, HmdfNetcdfDsg };
+
   int ADCIRCMODULES_EXPORT write(const std::string &filename,
                                  HmdfFileType fileType);
   int ADCIRCMODULES_EXPORT write(const std::string &filename);
@@ -102,12 +104,23 @@ class Hmdf {
 
   void ADCIRCMODULES_EXPORT reproject(int epsg);
 
+  Adcirc::Output::Hmdf::HmdfNetcdfLayout ADCIRCMODULES_EXPORT
+  netcdfLayout() const;
+  void ADCIRCMODULES_EXPORT
+  setNetcdfLayout(Adcirc::Output::Hmdf::HmdfNetcdfLayout layout);
+
  private:
+  int writeNetcdfLegacy(const std::string &filename);
+  int writeNetcdfDsg(const std::string &filename);
+  int putNetcdfGlobalAttributes(int ncid, const std::string &format) const;
+  bool hasCommonTimes() const;
+
   //...Variables
   bool m_success, m_null;
 
   int m_epsg;
   const size_t m_dimension;
+  HmdfNetcdfLayout m_netcdfLayout;
 
   std::string m_header1;
   std::string m_header2;
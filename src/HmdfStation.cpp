@@ -18,26 +18,13 @@
 //------------------------------------------------------------------------*/
 #include "HmdfStation.h"
 
+#include <chrono>
+#include <utility>
+
 #include "FPCompare.h"
 
 using namespace Adcirc::Output;
 
-struct m_DataPair {
-  Adcirc::CDate m_date;
-  double m_data_u = Adcirc::Output::HmdfStation::nullDataValue();
-  double m_data_v = Adcirc::Output::HmdfStation::nullDataValue();
-};
-
-bool operator<(const m_DataPair& a, const m_DataPair& b) {
-  return a.m_date < b.m_date;
-}
-
-bool operator==(const m_DataPair& a, const m_DataPair& b) {
-  return a.m_date == b.m_date &&
-         Adcirc::FpCompare::equalTo(a.m_data_u, b.m_data_u) &&
-         Adcirc::FpCompare::equalTo(a.m_data_v, b.m_data_v);
-}
-
 Adcirc::Output::HmdfStation::HmdfStation(size_t dimension)
     : m_coordinate(Coordinate()),
       m_name("noname"),
@@ -46,7 +33,13 @@ Adcirc::Output::HmdfStation::HmdfStation(size_t dimension)
       m_stationIndex(0),
       m_nullValue(nullDataValue()),
       m_positiveDirection(0),
-      m_dimension(dimension) {}
+      m_dimension(dimension),
+      m_data(dimension),
+      m_boundsValid(false),
+      m_minTime(0),
+      m_maxTime(0),
+      m_minValue(0.0),
+      m_maxValue(0.0) {}
 
 void Adcirc::Output::HmdfStation::clear() {
   m_coordinate = Coordinate();
@@ -55,7 +48,13 @@ void Adcirc::Output::HmdfStation::clear() {
   m_isNull = true;
   m_stationIndex = 0;
   m_positiveDirection = 0;
-  m_data.clear();
+  m_time.clear();
+  for (auto& d : m_data) {
+    d.clear();
+  }
+  m_adcircTime.clear();
+  m_adcircIteration.clear();
+  m_boundsValid = false;
 }
 
 Adcirc::Output::Coordinate* Adcirc::Output::HmdfStation::coordinate() {
@@ -92,7 +91,7 @@ std::string Adcirc::Output::HmdfStation::id() const { return m_id; }
 
 void Adcirc::Output::HmdfStation::setId(const std::string& id) { m_id = id; }
 
-size_t Adcirc::Output::HmdfStation::numSnaps() const { return m_data.size(); }
+size_t Adcirc::Output::HmdfStation::numSnaps() const { return m_time.size(); }
 
 size_t Adcirc::Output::HmdfStation::stationIndex() const {
   return m_stationIndex;
@@ -102,47 +101,172 @@ void Adcirc::Output::HmdfStation::setStationIndex(size_t stationIndex) {
   m_stationIndex = stationIndex;
 }
 
+Adcirc::CDate Adcirc::Output::HmdfStation::toDate(long long epochMilliseconds) {
+  return Adcirc::CDate(std::chrono::system_clock::time_point(
+      std::chrono::milliseconds(epochMilliseconds)));
+}
+
+long long Adcirc::Output::HmdfStation::toEpochMilliseconds(
+    const Adcirc::CDate& date) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             date.time_point().time_since_epoch())
+      .count();
+}
+
 Adcirc::CDate Adcirc::Output::HmdfStation::date(size_t index) const {
-  assert(index < m_data.size());
-  return m_data[index].datetime();
+  assert(index < m_time.size());
+  return toDate(m_time[index]);
+}
+
+/**
+ * @brief Returns the time of a sample without constructing a date
+ * @param index sample index
+ * @return milliseconds since 1970-01-01 00:00:00
+ */
+long long Adcirc::Output::HmdfStation::epochMilliseconds(size_t index) const {
+  assert(index < m_time.size());
+  return m_time[index];
 }
 
 void Adcirc::Output::HmdfStation::setDate(const Adcirc::CDate& date,
                                           size_t index) {
-  assert(index < m_data.size());
-  m_data[index].setDatetime(date);
+  assert(index < m_time.size());
+  m_time[index] = toEpochMilliseconds(date);
+  m_boundsValid = false;
 }
 
 void Adcirc::Output::HmdfStation::setDate(
     const std::vector<Adcirc::CDate>& date) {
-  assert(date.size() == m_data.size());
-  for (auto i = 0; i < m_data.size(); ++i) {
-    m_data[i].setDatetime(date[i]);
+  assert(date.size() == m_time.size());
+  for (size_t i = 0; i < m_time.size(); ++i) {
+    m_time[i] = toEpochMilliseconds(date[i]);
   }
+  m_boundsValid = false;
 }
 
 void Adcirc::Output::HmdfStation::setNext(const Adcirc::CDate& date,
                                           const std::vector<double>& data) {
-  m_data.template emplace_back(date, data);
+  assert(data.size() == m_dimension);
+  m_time.push_back(toEpochMilliseconds(date));
+  for (size_t i = 0; i < m_dimension; ++i) {
+    m_data[i].push_back(i < data.size() ? data[i] : nullDataValue());
+  }
+  m_adcircTime.push_back(defaultAdcircTime());
+  m_adcircIteration.push_back(defaultAdcircIteration());
+  m_boundsValid = false;
 }
 
 void Adcirc::Output::HmdfStation::setNext(const Adcirc::CDate& date,
                                           const double& data) {
-  m_data.emplace_back(date, data);
+  m_time.push_back(toEpochMilliseconds(date));
+  m_data[0].push_back(data);
+  for (size_t i = 1; i < m_dimension; ++i) {
+    m_data[i].push_back(nullDataValue());
+  }
+  m_adcircTime.push_back(defaultAdcircTime());
+  m_adcircIteration.push_back(defaultAdcircIteration());
+  m_boundsValid = false;
 }
 
 void Adcirc::Output::HmdfStation::setNext(const Adcirc::CDate& date,
                                           const double& data_u,
                                           const double& data_v) {
-  m_data.emplace_back(date, data_u, data_v);
+  assert(m_dimension == 2);
+  m_time.push_back(toEpochMilliseconds(date));
+  m_data[0].push_back(data_u);
+  m_data[1].push_back(data_v);
+  m_adcircTime.push_back(defaultAdcircTime());
+  m_adcircIteration.push_back(defaultAdcircIteration());
+  m_boundsValid = false;
 }
 
 void Adcirc::Output::HmdfStation::setNext(
     const Adcirc::CDate& date, const std::tuple<double, double>& data) {
-  assert(m_dimension == 2);
-  auto d1 = std::get<0>(data);
-  auto d2 = std::get<1>(data);
-  m_data.emplace_back(date, d1, d2);
+  this->setNext(date, std::get<0>(data), std::get<1>(data));
+}
+
+/**
+ * @brief Replaces the time series of a scalar station
+ * @param epochMilliseconds time of each sample in milliseconds since
+ * 1970-01-01 00:00:00
+ * @param data value of each sample
+ */
+void Adcirc::Output::HmdfStation::setTimeseries(
+    const std::vector<long long>& epochMilliseconds,
+    const std::vector<double>& data) {
+  this->setTimeseries(std::vector<long long>(epochMilliseconds),
+                      std::vector<double>(data));
+}
+
+/**
+ * @brief Replaces the time series of a scalar station without copying the
+ * arrays
+ * @param epochMilliseconds time of each sample in milliseconds since
+ * 1970-01-01 00:00:00
+ * @param data value of each sample
+ */
+void Adcirc::Output::HmdfStation::setTimeseries(
+    std::vector<long long>&& epochMilliseconds, std::vector<double>&& data) {
+  if (m_dimension != 1) {
+    adcircmodules_throw_exception("HmdfStation: Station is not scalar");
+  }
+  if (epochMilliseconds.size() != data.size()) {
+    adcircmodules_throw_exception("HmdfStation: Array size mismatch");
+  }
+  m_time = std::move(epochMilliseconds);
+  m_data[0] = std::move(data);
+  m_adcircTime.assign(m_time.size(), defaultAdcircTime());
+  m_adcircIteration.assign(m_time.size(), defaultAdcircIteration());
+  m_boundsValid = false;
+}
+
+/**
+ * @brief Replaces the time series of a vector station
+ * @param epochMilliseconds time of each sample in milliseconds since
+ * 1970-01-01 00:00:00
+ * @param data_u u-component of each sample
+ * @param data_v v-component of each sample
+ */
+void Adcirc::Output::HmdfStation::setTimeseries(
+    const std::vector<long long>& epochMilliseconds,
+    const std::vector<double>& data_u, const std::vector<double>& data_v) {
+  if (m_dimension != 2) {
+    adcircmodules_throw_exception("HmdfStation: Station is not a vector");
+  }
+  if (epochMilliseconds.size() != data_u.size() ||
+      epochMilliseconds.size() != data_v.size()) {
+    adcircmodules_throw_exception("HmdfStation: Array size mismatch");
+  }
+  m_time = epochMilliseconds;
+  m_data[0] = data_u;
+  m_data[1] = data_v;
+  m_adcircTime.assign(m_time.size(), defaultAdcircTime());
+  m_adcircIteration.assign(m_time.size(), defaultAdcircIteration());
+  m_boundsValid = false;
+}
+
+/**
+ * @brief Returns the sample times without copying them. The array is owned by
+ * the station and is only valid until the station is modified
+ * @return milliseconds since 1970-01-01 00:00:00 for each sample
+ */
+const std::vector<long long>*
+Adcirc::Output::HmdfStation::epochMillisecondsView() const {
+  return &m_time;
+}
+
+/**
+ * @brief Returns the sample values without copying them. The array is owned
+ * by the station and is only valid until the station is modified
+ * @param dim data dimension
+ * @return value of each sample
+ */
+const std::vector<double>* Adcirc::Output::HmdfStation::dataView(
+    size_t dim) const {
+  if (dim >= m_dimension) {
+    adcircmodules_throw_exception("HmdfStation: Dimension out of range");
+  }
+  return &m_data[dim];
 }
 
 bool Adcirc::Output::HmdfStation::isNull() const { return m_isNull; }
@@ -151,59 +275,100 @@ void Adcirc::Output::HmdfStation::setIsNull(bool isNull) { m_isNull = isNull; }
 
 void Adcirc::Output::HmdfStation::setData(const double& data, size_t index,
                                           size_t dim) {
-  assert(index < m_data.size());
+  assert(index < m_time.size());
   assert(dim < m_dimension);
-  m_data[index].setData(data, dim);
+  m_data[dim][index] = data;
+  m_boundsValid = false;
 }
 
 std::vector<Adcirc::CDate> Adcirc::Output::HmdfStation::allDate() const {
   std::vector<Adcirc::CDate> dates;
-  dates.reserve(m_data.size());
-  for (const auto& i : m_data) {
-    dates.push_back(i.datetime());
+  dates.reserve(m_time.size());
+  for (const auto& t : m_time) {
+    dates.push_back(toDate(t));
   }
   return dates;
 }
 
 std::vector<double> Adcirc::Output::HmdfStation::allData(size_t dim) const {
   assert(dim < m_dimension);
-  std::vector<double> data;
-  data.reserve(m_data.size());
-  for (const auto& i : m_data) {
-    data.push_back(i.data(dim));
+  return m_data[dim];
+}
+
+bool Adcirc::Output::HmdfStation::isValid(double value) const {
+  return value != nullDataValue() && value != m_nullValue && value == value;
+}
+
+void Adcirc::Output::HmdfStation::computeBounds() const {
+  m_minTime = std::numeric_limits<long long>::max();
+  m_maxTime = std::numeric_limits<long long>::min();
+  for (const auto& t : m_time) {
+    m_minTime = std::min(m_minTime, t);
+    m_maxTime = std::max(m_maxTime, t);
   }
-  return data;
+
+  m_minValue = std::numeric_limits<double>::max();
+  m_maxValue = -std::numeric_limits<double>::max();
+  for (const auto& d : m_data) {
+    for (const auto& v : d) {
+      if (this->isValid(v)) {
+        m_minValue = std::min(m_minValue, v);
+        m_maxValue = std::max(m_maxValue, v);
+      }
+    }
+  }
+  m_boundsValid = true;
 }
 
+/**
+ * @brief Returns the range of dates and values in the time series. Null
+ * values are ignored. The bounds are cached until the station is modified
+ * @param minDate earliest date
+ * @param maxDate latest date
+ * @param minValue smallest value in any dimension
+ * @param maxValue largest value in any dimension
+ */
 void Adcirc::Output::HmdfStation::dataBounds(Adcirc::CDate& minDate,
                                              Adcirc::CDate& maxDate,
                                              double& minValue,
-                                             double& maxValue) {
-  auto data_u = this->allData(0);
-  auto date = this->allDate();
-  minDate = *std::min_element(date.begin(), date.end());
-  maxDate = *std::max_element(date.begin(), date.end());
-  if (this->m_dimension == 2) {
-    auto data_v = this->allData(1);
-    double umin, umax, vmin, vmax;
-    std::tie(umin, umax) = this->getVectorBounds(data_u);
-    std::tie(vmin, vmax) = this->getVectorBounds(data_v);
-    minValue = std::min(umin, vmin);
-    maxValue = std::min(umax, vmax);
+                                             double& maxValue) const {
+  if (!m_boundsValid) this->computeBounds();
+  if (m_time.empty()) {
+    minDate = Adcirc::CDate::maxDate();
+    maxDate = Adcirc::CDate::minDate();
   } else {
-    std::tie(minValue, maxValue) = this->getVectorBounds(data_u);
+    minDate = toDate(m_minTime);
+    maxDate = toDate(m_maxTime);
   }
+  minValue = m_minValue;
+  maxValue = m_maxValue;
 }
 
 double Adcirc::Output::HmdfStation::nullValue() const { return m_nullValue; }
 
 void Adcirc::Output::HmdfStation::setNullValue(double nullValue) {
   m_nullValue = nullValue;
+  m_boundsValid = false;
 }
 
-void Adcirc::Output::HmdfStation::reserve(size_t size) { m_data.reserve(size); }
+void Adcirc::Output::HmdfStation::reserve(size_t size) {
+  m_time.reserve(size);
+  for (auto& d : m_data) {
+    d.reserve(size);
+  }
+  m_adcircTime.reserve(size);
+  m_adcircIteration.reserve(size);
+}
 
-void Adcirc::Output::HmdfStation::resize(size_t size) { m_data.resize(size); }
+void Adcirc::Output::HmdfStation::resize(size_t size) {
+  m_time.resize(size, 0);
+  for (auto& d : m_data) {
+    d.resize(size, nullDataValue());
+  }
+  m_adcircTime.resize(size, defaultAdcircTime());
+  m_adcircIteration.resize(size, defaultAdcircIteration());
+  m_boundsValid = false;
+}
 
 size_t Adcirc::Output::HmdfStation::dimension() const { return m_dimension; }
 
@@ -225,68 +390,54 @@ void Adcirc::Output::HmdfStation::setPositiveDirection(
 
 void Adcirc::Output::HmdfStation::sanitize(const double minValid,
                                            const double maxValid) {
-  std::vector<m_DataPair> d(m_data.size());
-  for (auto i = 0; i < d.size(); ++i) {
-    d[i].m_date = m_data[i].datetime();
-    d[i].m_data_u = this->m_data[i].data(0);
-    if (m_dimension == 2) {
-      d[i].m_data_v = this->m_data[i].data(1);
+  std::vector<size_t> order(m_time.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return m_time[a] < m_time[b];
+  });
+
+  auto permute = [&](auto& v) {
+    typename std::decay<decltype(v)>::type sorted(v.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+      sorted[i] = v[order[i]];
     }
-  }
-  std::sort(d.begin(), d.end());
-  for (size_t i = 0; i < d.size(); ++i) {
-    this->m_data[i].setDatetime(d[i].m_date);
-    this->m_data[i].setData(d[i].m_data_u < minValid
-                                ? Adcirc::Output::HmdfStation::nullDataValue()
-                            : d[i].m_data_u > maxValid
-                                ? Adcirc::Output::HmdfStation::nullDataValue()
-                                : d[i].m_data_u);
-    if (m_dimension == 2) {
-      this->m_data[i].setData(d[i].m_data_v < minValid
-                                  ? Adcirc::Output::HmdfStation::nullDataValue()
-                              : d[i].m_data_v > maxValid
-                                  ? Adcirc::Output::HmdfStation::nullDataValue()
-                                  : d[i].m_data_v,
-                              1);
+    v = std::move(sorted);
+  };
+
+  permute(m_time);
+  permute(m_adcircTime);
+  permute(m_adcircIteration);
+  for (auto& d : m_data) {
+    permute(d);
+    for (auto& v : d) {
+      v = v < minValid || v > maxValid ? nullDataValue() : v;
     }
   }
-}
-
-std::tuple<double, double> Adcirc::Output::HmdfStation::getVectorBounds(
-    const std::vector<double>& v) {
-  std::vector<double> sortedData = v;
-  std::sort(sortedData.begin(), sortedData.end());
-  double minValue;
-  if (FpCompare::equalTo(sortedData.front(), sortedData.back())) {
-    minValue = *std::upper_bound(sortedData.begin(), sortedData.end(),
-                                 this->nullDataValue());
-  } else {
-    minValue = sortedData.front();
-  }
-  return std::make_tuple(minValue, sortedData.back());
+  m_boundsValid = false;
 }
 
 size_t Adcirc::Output::HmdfStation::adcircIteration(size_t index) {
-  assert(index < m_data.size());
-  return m_data[index].adcircIteration();
+  assert(index < m_adcircIteration.size());
+  return m_adcircIteration[index];
 }
 
 void Adcirc::Output::HmdfStation::setAdcircIteration(size_t index, size_t it) {
-  assert(index < m_data.size());
-  m_data[index].setAdcircIteration(it);
+  assert(index < m_adcircIteration.size());
+  m_adcircIteration[index] = it;
 }
 
 double Adcirc::Output::HmdfStation::adcircTime(size_t index) {
-  assert(index < m_data.size());
-  return m_data[index].adcircTime();
+  assert(index < m_adcircTime.size());
+  return m_adcircTime[index];
 }
 
 void Adcirc::Output::HmdfStation::setAdcircTime(size_t index, double time) {
-  assert(index < m_data.size());
-  m_data[index].setAdcircTime(time);
+  assert(index < m_adcircTime.size());
+  m_adcircTime[index] = time;
 }
+
 double Adcirc::Output::HmdfStation::data(size_t index, size_t dim) const {
-  assert(index < m_data.size());
+  assert(index < m_time.size());
   assert(dim < m_dimension);
-  return m_data[index].data(dim);
-}
\ No newline at end of file
+  return m_data[dim][index];
+}
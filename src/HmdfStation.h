@@ -35,6 +35,19 @@ namespace Adcirc {
 
 namespace Output {
 
+/**
+ * @class HmdfStation
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Time series at a single station
+ *
+ * The time series is stored by column. Times are held as milliseconds since
+ * 1970-01-01 00:00:00 in a single integer array and each data dimension is
+ * held in its own contiguous array. CDate objects are only created when a
+ * single date is requested. The data bounds are cached and recomputed after
+ * the series is modified.
+ */
 class HmdfStation {
  public:
   ADCIRCMODULES_EXPORT explicit HmdfStation(size_t dimension = 1);
@@ -103,6 +116,28 @@ class HmdfStation {
   void ADCIRCMODULES_EXPORT setNext(const Adcirc::CDate &date,
                                     const std::tuple<double, double> &data);
 
+  long long ADCIRCMODULES_EXPORT epochMilliseconds(size_t index) const;
+
+  void ADCIRCMODULES_EXPORT setTimeseries(
+      const std::vector<long long> &epochMilliseconds,
+      const std::vector<double> &data);
+
+  void ADCIRCMODULES_EXPORT setTimeseries(
+      const std::vector<long long> &epochMilliseconds,
+      const std::vector<double> &data_u, const std::vector<double> &data_v);
+
+#ifndef SWIG
+  void ADCIRCMODULES_EXPORT
+  setTimeseries(std::vector<long long> &&epochMilliseconds,
+                std::vector<double> &&data);
+#endif
+
+  const std::vector<long long> ADCIRCMODULES_EXPORT *epochMillisecondsView()
+      const;
+
+  const std::vector<double> ADCIRCMODULES_EXPORT *dataView(
+      size_t dim = 0) const;
+
   bool ADCIRCMODULES_EXPORT isNull() const;
   void ADCIRCMODULES_EXPORT setIsNull(bool isNull);
 
@@ -112,10 +147,10 @@ class HmdfStation {
   template <typename T>
   void ADCIRCMODULES_EXPORT setData(const std::vector<T> &data,
                                     size_t dim = 0) {
-    assert(data.size() == m_data.size());
-    for (auto i = 0; i < m_data.size(); ++i) {
-      m_data[i].setData(dim, data[i]);
-    }
+    assert(data.size() == m_time.size());
+    assert(dim < m_dimension);
+    std::copy(data.begin(), data.end(), m_data[dim].begin());
+    m_boundsValid = false;
   }
 
   size_t ADCIRCMODULES_EXPORT adcircIteration(size_t index);
@@ -132,7 +167,7 @@ class HmdfStation {
 
   void ADCIRCMODULES_EXPORT dataBounds(Adcirc::CDate &minDate,
                                        Adcirc::CDate &maxDate, double &minValue,
-                                       double &maxValue);
+                                       double &maxValue) const;
 
   double ADCIRCMODULES_EXPORT nullValue() const;
 
@@ -151,7 +186,11 @@ class HmdfStation {
   void ADCIRCMODULES_EXPORT sanitize(double minValid, double maxValid);
 
  private:
-  std::tuple<double, double> getVectorBounds(const std::vector<double> &v);
+  void computeBounds() const;
+  bool isValid(double value) const;
+
+  static Adcirc::CDate toDate(long long epochMilliseconds);
+  static long long toEpochMilliseconds(const Adcirc::CDate &date);
 
   Adcirc::Output::Coordinate m_coordinate;
   std::string m_name;
@@ -161,7 +200,17 @@ class HmdfStation {
   double m_positiveDirection;
   size_t m_dimension;
   bool m_isNull;
-  std::vector<HmdfDataContainer> m_data;
+
+  std::vector<long long> m_time;
+  std::vector<std::vector<double>> m_data;
+  std::vector<double> m_adcircTime;
+  std::vector<size_t> m_adcircIteration;
+
+  mutable bool m_boundsValid;
+  mutable long long m_minTime;
+  mutable long long m_maxTime;
+  mutable double m_minValue;
+  mutable double m_maxValue;
 };
 
 #ifndef SWIG
@@ -0,0 +1,92 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "IdIndex.h"
+
+#include <string>
+
+#include "Logging.h"
+
+using namespace Adcirc::Private;
+
+IdIndex::IdIndex() : m_size(0), m_minId(0) {}
+
+/**
+ * @brief Releases the index
+ */
+void IdIndex::clear() {
+  this->m_size = 0;
+  this->m_minId = 0;
+  this->m_dense.clear();
+  this->m_dense.shrink_to_fit();
+  this->m_sorted.clear();
+  this->m_sorted.shrink_to_fit();
+}
+
+/**
+ * @brief Returns true if the index has not been built
+ * @return true if empty
+ */
+bool IdIndex::empty() const { return this->m_size == 0; }
+
+/**
+ * @brief Returns true if the index uses the direct address layout
+ * @return true if dense
+ */
+bool IdIndex::isDense() const { return !this->m_dense.empty(); }
+
+/**
+ * @brief Number of entities in the index
+ * @return number of entities
+ */
+size_t IdIndex::size() const { return this->m_size; }
+
+/**
+ * @brief Finds the position of an id
+ * @param id id to search for
+ * @return array position, or npos() if the id is not in the index
+ */
+size_t IdIndex::find(size_t id) const {
+  if (!this->m_dense.empty()) {
+    if (id < this->m_minId || id - this->m_minId >= this->m_dense.size()) {
+      return IdIndex::npos();
+    }
+    return this->m_dense[id - this->m_minId];
+  }
+
+  auto it = std::upper_bound(
+      this->m_sorted.begin(), this->m_sorted.end(), id,
+      [](size_t v, const std::pair<size_t, size_t> &p) { return v < p.first; });
+  if (it == this->m_sorted.begin() || (--it)->first != id) {
+    return IdIndex::npos();
+  }
+  return it->second;
+}
+
+/**
+ * @brief Finds the position of an id and throws if it is not found
+ * @param id id to search for
+ * @return array position
+ */
+size_t IdIndex::at(size_t id) const {
+  const size_t p = this->find(id);
+  if (p == IdIndex::npos()) {
+    adcircmodules_throw_exception("Id " + std::to_string(id) + " not found");
+  }
+  return p;
+}
@@ -0,0 +1,129 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_IDINDEX_H
+#define ADCMOD_IDINDEX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "DefaultValues.h"
+
+namespace Adcirc {
+namespace Private {
+
+/**
+ * @class IdIndex
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Maps entity ids to array positions when ids are not numbered in order
+ *
+ * When the range of ids is within a small factor of the number of entities,
+ * the positions are stored in a direct address array indexed by id. Otherwise
+ * (id, position) pairs are sorted and searched with a binary search. Either
+ * layout is held in one contiguous array and filled in parallel.
+ *
+ * Ids are expected to be unique. For the sorted layout, the last position
+ * with a repeated id is returned.
+ */
+class IdIndex {
+ public:
+  IdIndex();
+
+  template <typename IdFunction>
+  void build(size_t n, IdFunction id);
+
+  void clear();
+
+  bool empty() const;
+  bool isDense() const;
+  size_t size() const;
+
+  size_t find(size_t id) const;
+  size_t at(size_t id) const;
+
+  static constexpr size_t npos() {
+    return adcircmodules_default_value<size_t>();
+  }
+
+  /// Largest ratio of id range to number of entities that uses the dense layout
+  static constexpr size_t denseFactor() { return 4; }
+
+ private:
+  size_t m_size;
+  size_t m_minId;
+  std::vector<size_t> m_dense;
+  std::vector<std::pair<size_t, size_t>> m_sorted;
+};
+
+/**
+ * @brief Builds the index
+ * @param n number of entities
+ * @param id function returning the id of the entity at a position
+ */
+template <typename IdFunction>
+void IdIndex::build(size_t n, IdFunction id) {
+  this->clear();
+  this->m_size = n;
+  if (n == 0) return;
+
+  size_t lo = id(0);
+  size_t hi = lo;
+#pragma omp parallel
+  {
+    size_t tlo = lo;
+    size_t thi = hi;
+#pragma omp for schedule(static) nowait
+    for (size_t i = 0; i < n; ++i) {
+      const size_t v = id(i);
+      tlo = std::min(tlo, v);
+      thi = std::max(thi, v);
+    }
+#pragma omp critical
+    {
+      lo = std::min(lo, tlo);
+      hi = std::max(hi, thi);
+    }
+  }
+
+  this->m_minId = lo;
+  const size_t range = hi - lo;
+
+  if (range < IdIndex::denseFactor() * n) {
+    this->m_dense.assign(range + 1, IdIndex::npos());
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; ++i) {
+      this->m_dense[id(i) - lo] = i;
+    }
+  } else {
+    this->m_sorted.resize(n);
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < n; ++i) {
+      this->m_sorted[i] = std::make_pair(id(i), i);
+    }
+    std::sort(this->m_sorted.begin(), this->m_sorted.end());
+  }
+}
+
+}  // namespace Private
+}  // namespace Adcirc
+
+#endif  // ADCMOD_IDINDEX_H
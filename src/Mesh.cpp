@@ -250,6 +250,8 @@ void Mesh::defineProjection(int epsg, bool isLatLon) {
 /**
  * @brief Reprojects a mesh into the specified projection
  * @param[in] epsg EPSG coordinate system to convert the mesh into
+ *
+ * Any search trees built before the mesh is reprojected are discarded
  */
 void Mesh::reproject(int epsg) { this->m_impl->reproject(epsg); }
 
@@ -328,6 +330,18 @@ void Mesh::toWeirPolygonShapefile(const std::string &outputFile) {
   this->m_impl->toWeirPolygonShapefile(outputFile);
 }
 
+/**
+ * @brief Writes a mesh feature layer to a vector file. The format is chosen
+ * from the file extension. Shapefiles are written directly and other formats
+ * (.gpkg, .fgb) are written through OGR
+ * @param[in] outputFile name of the output file
+ * @param[in] feature mesh feature to write
+ */
+void Mesh::toVectorFile(const std::string &outputFile,
+                        Adcirc::Geometry::MeshFeature feature) {
+  this->m_impl->toVectorFile(outputFile, feature);
+}
+
 /**
  * @brief Builds a kd-tree object with the mesh nodes as the search locations
  */
@@ -628,12 +642,33 @@ Adcirc::Kdtree *Mesh::elementalSearchTree() const {
 
 /**
  * @brief Computes average size of the element edges connected to each node
+ * @param[in] epsg coordinate system to measure the edges in. The mesh is not
+ * modified. If 0, the current mesh coordinates are used
  * @return vector containing size at each node
  */
 std::vector<double> Mesh::computeMeshSize(int epsg) {
   return this->m_impl->computeMeshSize(epsg);
 }
 
+/**
+ * @brief Reorders the nodes and elements of the mesh so that entities that
+ * are close together in the mesh are also close together in memory
+ * @param[in] strategy ordering strategy. Reverse Cuthill-McKee uses the node
+ * connectivity while the Hilbert and Morton strategies use node positions
+ * @param[in] renumber if true, node and element ids are reset to their new
+ * positions
+ * @return gather list of the node order, where entry i is the previous
+ * position of the node now at position i. This can be passed to
+ * NodalAttributes::permute and OutputRecord::permute
+ *
+ * Element, boundary, and id lookups are updated. Search trees and topology
+ * tables are discarded and rebuilt on the next use.
+ */
+std::vector<size_t> Mesh::reorder(Adcirc::Geometry::ReorderStrategy strategy,
+                                  bool renumber) {
+  return this->m_impl->reorder(strategy, renumber);
+}
+
 /**
  * @brief Return a vector containing all nodes on the mesh boundary
  *
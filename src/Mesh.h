@@ -30,6 +30,7 @@
 #include "Element.h"
 #include "FileTypes.h"
 #include "KDTree.h"
+#include "MeshReorder.h"
 #include "Node.h"
 #include "Topology.h"
 
@@ -151,6 +152,9 @@ class Mesh {
   void ADCIRCMODULES_EXPORT
   toWeirPolygonShapefile(const std::string &outputFile);
 
+  void ADCIRCMODULES_EXPORT toVectorFile(
+      const std::string &outputFile, Adcirc::Geometry::MeshFeature feature);
+
   void ADCIRCMODULES_EXPORT buildNodalSearchTree();
   void ADCIRCMODULES_EXPORT buildElementalSearchTree();
 
@@ -210,6 +214,11 @@ class Mesh {
 
   std::vector<double> ADCIRCMODULES_EXPORT computeMeshSize(int epsg = 0);
 
+  std::vector<size_t> ADCIRCMODULES_EXPORT
+  reorder(Adcirc::Geometry::ReorderStrategy strategy =
+              Adcirc::Geometry::ReorderReverseCuthillMcKee,
+          bool renumber = false);
+
   std::vector<Adcirc::Geometry::Node *> ADCIRCMODULES_EXPORT boundaryNodes();
 
   std::string ADCIRCMODULES_EXPORT hash(bool force = false);
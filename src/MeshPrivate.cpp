@@ -19,7 +19,7 @@
 #include "MeshPrivate.h"
 
 #include <algorithm>
-#include <set>
+#include <array>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -33,10 +33,13 @@
 #include "KDTree.h"
 #include "Logging.h"
 #include "Mesh.h"
+#include "MeshReorder.h"
+#include "OgrWriter.h"
+#include "RasterFile.h"
 #include "Projection.h"
+#include "ShapefileWriter.h"
 #include "StringConversion.h"
 #include "boost/format.hpp"
-#include "boost/functional/hash.hpp"
 #include "netcdf.h"
 #include "shapefil.h"
 
@@ -53,6 +56,9 @@
 
 using namespace Adcirc::Private;
 using namespace Adcirc::Geometry;
+using Adcirc::FileIO::FeatureTable;
+using Adcirc::FileIO::OgrWriter;
+using Adcirc::FileIO::ShapefileWriter;
 
 Adcirc::Geometry::Mesh::~Mesh() = default;
 
@@ -126,6 +132,15 @@ void MeshPrivate::_init() {
   this->m_hash.reset(nullptr);
   this->m_elementalSearchTree = std::make_unique<Kdtree>();
   this->m_nodalSearchTree = std::make_unique<Kdtree>();
+  this->invalidateEdgeTable();
+}
+
+/**
+ * @brief Marks the edge table as out of date after the nodes or elements
+ * have been changed
+ */
+void MeshPrivate::invalidateEdgeTable() {
+  if (this->m_topology) this->m_topology->invalidateEdgeTable();
 }
 
 /**
@@ -175,6 +190,7 @@ size_t MeshPrivate::numNodes() const { return this->m_nodes.size(); }
  */
 void MeshPrivate::setNumNodes(size_t numNodes) {
   this->m_nodes.resize(numNodes);
+  this->invalidateEdgeTable();
 }
 
 /**
@@ -189,6 +205,7 @@ size_t MeshPrivate::numElements() const { return this->m_elements.size(); }
  */
 void MeshPrivate::setNumElements(size_t numElements) {
   this->m_elements.resize(numElements);
+  this->invalidateEdgeTable();
 }
 
 /**
@@ -520,10 +537,18 @@ void MeshPrivate::read2dmData(std::vector<std::string> &nodes,
  * order
  */
 void MeshPrivate::buildNodeLookupTable() {
-  this->m_nodeLookup.reserve(this->numNodes());
-  for (size_t i = 0; i < this->numNodes(); ++i) {
-    this->m_nodeLookup[this->m_nodes[i].id()] = i;
-  }
+  this->m_nodeLookup.build(this->m_nodes.size(),
+                           [&](size_t i) { return this->m_nodes[i].id(); });
+}
+
+/**
+ * @brief Builds a lookup table in the case that the elements are not numbered
+ * in order
+ */
+void MeshPrivate::buildElementLookupTable() {
+  this->m_elementLookup.build(
+      this->m_elements.size(),
+      [&](size_t i) { return this->m_elements[i].id(); });
 }
 
 /**
@@ -565,9 +590,9 @@ void MeshPrivate::read2dmElements(std::vector<std::string> &elements) {
                                         &this->m_nodes[n[2] - 1]);
         } else {
           this->m_elements.emplace_back(
-              id, &this->m_nodes[this->m_nodeLookup[n[0]]],
-              &this->m_nodes[this->m_nodeLookup[n[1]]],
-              &this->m_nodes[this->m_nodeLookup[n[2]]]);
+              id, &this->m_nodes[this->m_nodeLookup.at(n[0])],
+              &this->m_nodes[this->m_nodeLookup.at(n[1])],
+              &this->m_nodes[this->m_nodeLookup.at(n[2])]);
         }
       } else if (n.size() == 4) {
         if (this->m_nodeOrderingLogical) {
@@ -576,10 +601,10 @@ void MeshPrivate::read2dmElements(std::vector<std::string> &elements) {
               &this->m_nodes[n[2] - 1], &this->m_nodes[n[3] - 1]);
         } else {
           this->m_elements.emplace_back(
-              id, &this->m_nodes[this->m_nodeLookup[n[0]]],
-              &this->m_nodes[this->m_nodeLookup[n[1]]],
-              &this->m_nodes[this->m_nodeLookup[n[2]]],
-              &this->m_nodes[this->m_nodeLookup[n[3]]]);
+              id, &this->m_nodes[this->m_nodeLookup.at(n[0])],
+              &this->m_nodes[this->m_nodeLookup.at(n[1])],
+              &this->m_nodes[this->m_nodeLookup.at(n[2])],
+              &this->m_nodes[this->m_nodeLookup.at(n[3])]);
         }
       } else {
         adcircmodules_throw_exception("Too many nodes (" +
@@ -721,24 +746,21 @@ void MeshPrivate::readAdcircElements(std::ifstream &fid) {
         this->m_elementOrderingLogical = false;
       }
       if (n.size() == 3) {
-        e.setElement(id, &this->m_nodes[this->m_nodeLookup[n[0]]],
-                     &this->m_nodes[this->m_nodeLookup[n[1]]],
-                     &this->m_nodes[this->m_nodeLookup[n[2]]]);
+        e.setElement(id, &this->m_nodes[this->m_nodeLookup.at(n[0])],
+                     &this->m_nodes[this->m_nodeLookup.at(n[1])],
+                     &this->m_nodes[this->m_nodeLookup.at(n[2])]);
       } else if (n.size() == 4) {
-        e.setElement(id, &this->m_nodes[this->m_nodeLookup[n[0]]],
-                     &this->m_nodes[this->m_nodeLookup[n[1]]],
-                     &this->m_nodes[this->m_nodeLookup[n[2]]],
-                     &this->m_nodes[this->m_nodeLookup[n[3]]]);
+        e.setElement(id, &this->m_nodes[this->m_nodeLookup.at(n[0])],
+                     &this->m_nodes[this->m_nodeLookup.at(n[1])],
+                     &this->m_nodes[this->m_nodeLookup.at(n[2])],
+                     &this->m_nodes[this->m_nodeLookup.at(n[3])]);
       }
       i++;
     }
   }
 
   if (!this->m_elementOrderingLogical) {
-    this->m_elementLookup.reserve(this->numElements());
-    for (size_t i = 0; i < this->numElements(); ++i) {
-      this->m_elementLookup[this->m_elements[i].id()] = i;
-    }
+    this->buildElementLookupTable();
   }
 }
 
@@ -787,7 +809,7 @@ void MeshPrivate::readAdcircOpenBoundaries(std::ifstream &fid) {
       if (this->m_nodeOrderingLogical) {
         b.setNode1(j, &this->m_nodes[nid - 1]);
       } else {
-        b.setNode1(j, &this->m_nodes[this->m_nodeLookup[nid]]);
+        b.setNode1(j, &this->m_nodes[this->m_nodeLookup.at(nid)]);
       }
     }
   }
@@ -847,7 +869,7 @@ void MeshPrivate::readAdcircLandBoundaries(std::ifstream &fid) {
         if (this->m_nodeOrderingLogical) {
           b.setNode1(j, &this->m_nodes[n1 - 1]);
         } else {
-          b.setNode1(j, &this->m_nodes[this->m_nodeLookup[n1]]);
+          b.setNode1(j, &this->m_nodes[this->m_nodeLookup.at(n1)]);
         }
 
         b.setCrestElevation(j, crest);
@@ -864,8 +886,8 @@ void MeshPrivate::readAdcircLandBoundaries(std::ifstream &fid) {
           b.setNode1(j, &this->m_nodes[n1 - 1]);
           b.setNode2(j, &this->m_nodes[n2 - 1]);
         } else {
-          b.setNode1(j, &this->m_nodes[this->m_nodeLookup[n1]]);
-          b.setNode2(j, &this->m_nodes[this->m_nodeLookup[n2]]);
+          b.setNode1(j, &this->m_nodes[this->m_nodeLookup.at(n1)]);
+          b.setNode2(j, &this->m_nodes[this->m_nodeLookup.at(n2)]);
         }
 
         b.setCrestElevation(j, crest);
@@ -884,8 +906,8 @@ void MeshPrivate::readAdcircLandBoundaries(std::ifstream &fid) {
           b.setNode1(j, &this->m_nodes[n1 - 1]);
           b.setNode2(j, &this->m_nodes[n2 - 1]);
         } else {
-          b.setNode1(j, &this->m_nodes[this->m_nodeLookup[n1]]);
-          b.setNode2(j, &this->m_nodes[this->m_nodeLookup[n2]]);
+          b.setNode1(j, &this->m_nodes[this->m_nodeLookup.at(n1)]);
+          b.setNode2(j, &this->m_nodes[this->m_nodeLookup.at(n2)]);
         }
 
         b.setCrestElevation(j, crest);
@@ -902,7 +924,7 @@ void MeshPrivate::readAdcircLandBoundaries(std::ifstream &fid) {
         if (this->m_nodeOrderingLogical) {
           b.setNode1(j, &this->m_nodes[n1 - 1]);
         } else {
-          b.setNode1(j, &this->m_nodes[this->m_nodeLookup[n1]]);
+          b.setNode1(j, &this->m_nodes[this->m_nodeLookup.at(n1)]);
         }
       }
     }
@@ -1035,7 +1057,7 @@ Node *MeshPrivate::nodeById(size_t id) {
       return nullptr;
     }
   } else {
-    return &this->m_nodes[this->m_nodeLookup[id]];
+    return &this->m_nodes[this->m_nodeLookup.at(id)];
   }
 }
 
@@ -1053,7 +1075,7 @@ Element *MeshPrivate::elementById(size_t id) {
       return nullptr;
     }
   } else {
-    return &this->m_elements[this->m_elementLookup[id]];
+    return &this->m_elements[this->m_elementLookup.at(id)];
   }
 }
 
@@ -1140,66 +1162,313 @@ bool MeshPrivate::isLatLon() const { return this->m_isLatLon; }
 /**
  * @brief Reprojects a mesh into the specified projection
  * @param epsg EPSG coordinate system to convert the mesh into
+ *
+ * The nodes are transformed in blocks spread across the available threads.
+ * Each thread uses its own proj context and only holds one block of
+ * coordinates at a time. Search trees built in the previous coordinate system
+ * are discarded.
  */
 void MeshPrivate::reproject(int epsg) {
-  std::vector<double> xin, xout, yin, yout;
-  xin.reserve(this->numNodes());
-  yin.reserve(this->numNodes());
-
-  for (const auto &n : this->m_nodes) {
-    xin.push_back(n.x());
-    yin.push_back(n.y());
-  }
+  constexpr size_t blockSize = 16384;
+  const int epsgInput = this->projection();
+  const size_t nBlocks = (this->numNodes() + blockSize - 1) / blockSize;
 
   bool isLatLon = false;
-  int ierr = Adcirc::Projection::transform(this->projection(), epsg, xin, yin,
-                                           xout, yout, isLatLon);
+  int ierr = this->numNodes() == 0 ? 2 : 0;
+
+#pragma omp parallel
+  {
+    std::vector<double> x, y;
+    x.reserve(blockSize);
+    y.reserve(blockSize);
+
+#pragma omp for schedule(static)
+    for (size_t b = 0; b < nBlocks; ++b) {
+      const size_t i0 = b * blockSize;
+      const size_t i1 = std::min(i0 + blockSize, this->numNodes());
+      x.clear();
+      y.clear();
+      for (size_t i = i0; i < i1; ++i) {
+        x.push_back(this->m_nodes[i].x());
+        y.push_back(this->m_nodes[i].y());
+      }
 
-  if (ierr != 0) {
-    adcircmodules_throw_exception("Mesh: Proj library error");
+      bool blockIsLatLon = false;
+      int blockErr = Adcirc::Projection::transformInPlace(
+          epsgInput, epsg, x, y, blockIsLatLon);
+      if (blockErr != 0) {
+#pragma omp atomic write
+        ierr = blockErr;
+        continue;
+      }
+      if (b == 0) isLatLon = blockIsLatLon;
+
+      for (size_t i = i0; i < i1; ++i) {
+        this->m_nodes[i].setX(x[i - i0]);
+        this->m_nodes[i].setY(y[i - i0]);
+      }
+    }
   }
 
-  for (size_t i = 0; i < this->numNodes(); ++i) {
-    this->node(i)->setX(xout[i]);
-    this->node(i)->setY(yout[i]);
+  if (ierr != 0) {
+    adcircmodules_throw_exception("Mesh: Proj library error");
   }
 
   this->defineProjection(epsg, isLatLon);
+  this->deleteNodalSearchTree();
+  this->deleteElementalSearchTree();
 }
 
 /**
- * @brief Writes the mesh nodes into ESRI shapefile format
- * @param outputFile output file with .shp extension
+ * @brief Builds a table of the mesh nodes for vector output
+ * @return feature table with one point per node
  */
-void MeshPrivate::toNodeShapefile(const std::string &outputFile) {
-  SHPHandle shpid = SHPCreate(outputFile.c_str(), SHPT_POINT);
-  DBFHandle dbfid = DBFCreate(outputFile.c_str());
+FeatureTable MeshPrivate::nodeFeatures() const {
+  FeatureTable t(FeatureTable::FeaturePoint, false);
+  const size_t fid = t.addField("nodeid", FeatureTable::FieldInteger, 16);
+  const size_t fx = t.addField("longitude", FeatureTable::FieldDouble, 16, 8);
+  const size_t fy = t.addField("latitude", FeatureTable::FieldDouble, 16, 8);
+  const size_t fz = t.addField("elevation", FeatureTable::FieldDouble, 16, 4);
+  t.allocate(this->m_nodes.size(), 1);
 
-  DBFAddField(dbfid, "nodeid", FTInteger, 16, 0);
-  DBFAddField(dbfid, "longitude", FTDouble, 16, 8);
-  DBFAddField(dbfid, "latitude", FTDouble, 16, 8);
-  DBFAddField(dbfid, "elevation", FTDouble, 16, 4);
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < this->m_nodes.size(); ++i) {
+    const Node &n = this->m_nodes[i];
+    t.setVertex(i, n.x(), n.y());
+    t.setInteger(fid, i, static_cast<int64_t>(n.id()));
+    t.setDouble(fx, i, n.x());
+    t.setDouble(fy, i, n.y());
+    t.setDouble(fz, i, n.z());
+  }
+  return t;
+}
 
-  for (auto &n : this->m_nodes) {
-    int nodeid = static_cast<int>(n.id());
-    double longitude = n.x();
-    double latitude = n.y();
-    double elevation = n.z();
+/**
+ * @brief Builds a table of the mesh elements for vector output
+ * @return feature table with one clockwise polygon per element
+ */
+FeatureTable MeshPrivate::elementFeatures() const {
+  FeatureTable t(FeatureTable::FeaturePolygon, false);
+  const size_t fid = t.addField("elementid", FeatureTable::FieldInteger, 16);
+  size_t fn[4], fz[4];
+  for (size_t j = 0; j < 4; ++j) {
+    fn[j] = t.addField("node" + std::to_string(j + 1),
+                       FeatureTable::FieldInteger, 16);
+  }
+  for (size_t j = 0; j < 4; ++j) {
+    fz[j] = t.addField("znode" + std::to_string(j + 1),
+                       FeatureTable::FieldDouble, 16, 4);
+  }
+  const size_t fmean = t.addField("zmean", FeatureTable::FieldDouble, 16, 4);
 
-    SHPObject *shpobj =
-        SHPCreateSimpleObject(SHPT_POINT, 1, &longitude, &latitude, &elevation);
-    int shp_index = SHPWriteObject(shpid, -1, shpobj);
-    SHPDestroyObject(shpobj);
+  std::vector<size_t> nv(this->m_elements.size());
+  for (size_t i = 0; i < this->m_elements.size(); ++i) {
+    nv[i] = this->m_elements[i].n() + 1;
+  }
+  t.allocate(nv);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < this->m_elements.size(); ++i) {
+    const Element &e = this->m_elements[i];
+    const size_t n = e.n();
+    const size_t o = t.vertexOffset(i);
+
+    //...Shapefile polygon rings are clockwise
+    double a2 = 0.0;
+    for (size_t k = 0; k < n; ++k) {
+      const Node *n1 = e.node(k);
+      const Node *n2 = e.node((k + 1) % n);
+      a2 += n1->x() * n2->y() - n2->x() * n1->y();
+    }
+    const bool reverse = a2 > 0.0;
+    for (size_t k = 0; k <= n; ++k) {
+      const Node *v = e.node(reverse ? (n - k) % n : k % n);
+      t.setVertex(o + k, v->x(), v->y());
+    }
+
+    double zmean = 0.0;
+    for (size_t j = 0; j < 4; ++j) {
+      if (j < n) {
+        t.setInteger(fn[j], i, static_cast<int64_t>(e.node(j)->id()));
+        t.setDouble(fz[j], i, e.node(j)->z());
+        zmean += e.node(j)->z();
+      } else {
+        t.setInteger(fn[j], i, -1);
+        t.setDouble(fz[j], i, adcircmodules_default_value<double>());
+      }
+    }
+    t.setInteger(fid, i, static_cast<int64_t>(e.id()));
+    t.setDouble(fmean, i, zmean / n);
+  }
+  return t;
+}
+
+/**
+ * @brief Builds a table of the unique element edges for vector output
+ * @return feature table with one line per edge
+ */
+FeatureTable MeshPrivate::connectivityFeatures() {
+  const EdgeTable *edges = this->topology()->edgeTable();
+
+  FeatureTable t(FeatureTable::FeatureLineString, false);
+  const size_t fn1 = t.addField("node1", FeatureTable::FieldInteger, 16);
+  const size_t fn2 = t.addField("node2", FeatureTable::FieldInteger, 16);
+  const size_t fz1 = t.addField("znode1", FeatureTable::FieldDouble, 16, 4);
+  const size_t fz2 = t.addField("znode2", FeatureTable::FieldDouble, 16, 4);
+  t.allocate(edges->numEdges(), 2);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < edges->numEdges(); ++i) {
+    const auto l = edges->nodes(i);
+    t.setVertex(2 * i, l.first->x(), l.first->y());
+    t.setVertex(2 * i + 1, l.second->x(), l.second->y());
+    t.setInteger(fn1, i, static_cast<int64_t>(l.first->id()));
+    t.setInteger(fn2, i, static_cast<int64_t>(l.second->id()));
+    t.setDouble(fz1, i, l.first->z());
+    t.setDouble(fz2, i, l.second->z());
+  }
+  return t;
+}
+
+/**
+ * @brief Builds a table of the boundary condition nodes for vector output
+ * @return feature table with one point per boundary node. Internal weirs are
+ * placed between the paired nodes
+ */
+FeatureTable MeshPrivate::boundaryFeatures() const {
+  FeatureTable t(FeatureTable::FeaturePoint, true);
+  const size_t fid = t.addField("bndId", FeatureTable::FieldInteger, 16);
+  const size_t fidx = t.addField("bndIdx", FeatureTable::FieldInteger, 16);
+  const size_t fcode = t.addField("bndCode", FeatureTable::FieldInteger, 16);
+  const size_t fn1 = t.addField("node1", FeatureTable::FieldInteger, 16);
+  const size_t fn2 = t.addField("node2", FeatureTable::FieldInteger, 16);
+  const size_t fbathy = t.addField("bathy", FeatureTable::FieldDouble, 16, 4);
+  const size_t felev = t.addField("bc_elev", FeatureTable::FieldDouble, 16, 4);
+  const size_t fsup =
+      t.addField("supercritical", FeatureTable::FieldDouble, 16, 4);
+  const size_t fsub =
+      t.addField("subcritical", FeatureTable::FieldDouble, 16, 4);
+  const size_t fdiam =
+      t.addField("pipediam", FeatureTable::FieldDouble, 16, 4);
+  const size_t fht =
+      t.addField("pipeheight", FeatureTable::FieldDouble, 16, 4);
+  const size_t fcoef =
+      t.addField("pipecoef", FeatureTable::FieldDouble, 16, 4);
+
+  size_t n = 0;
+  for (const auto &b : this->m_openBoundaries) n += b.length();
+  for (const auto &b : this->m_landBoundaries) n += b.length();
+  t.allocate(n, 1);
+
+  size_t idx = 0;
+  int64_t bcid = 0;
+  auto add = [&](const Boundary &b) {
+    for (size_t i = 0; i < b.length(); ++i) {
+      int64_t node2 = -9999;
+      double lon = b.node1(i)->x();
+      double lat = b.node1(i)->y();
+      double bathy = -b.node1(i)->z();
+      double elev = -9999.0;
+      double sub = -9999.0;
+      double sup = -9999.0;
+      double pipeht = -9999.0;
+      double pipecoef = -9999.0;
+      double pipediam = -9999.0;
+      if (b.isInternalWeir()) {
+        lon = (lon + b.node2(i)->x()) / 2.0;
+        lat = (lat + b.node2(i)->y()) / 2.0;
+        bathy = (bathy + b.node2(i)->z()) / 2.0;
+        node2 = static_cast<int64_t>(b.node2(i)->id());
+        elev = b.crestElevation(i);
+        sup = b.supercriticalWeirCoefficient(i);
+        sub = b.subcriticalWeirCoefficient(i);
+      } else if (b.isExternalWeir()) {
+        elev = b.crestElevation(i);
+        sup = b.supercriticalWeirCoefficient(i);
+      }
+      if (b.isInternalWeirWithPipes()) {
+        pipeht = b.pipeHeight(i);
+        pipediam = b.pipeDiameter(i);
+        pipecoef = b.pipeCoefficient(i);
+      }
 
-    DBFWriteIntegerAttribute(dbfid, shp_index, 0, nodeid);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 1, longitude);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 2, latitude);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 3, elevation);
+      t.setVertex(idx, lon, lat, bathy);
+      t.setInteger(fid, idx, bcid);
+      t.setInteger(fidx, idx, static_cast<int64_t>(idx));
+      t.setInteger(fcode, idx, b.boundaryCode());
+      t.setInteger(fn1, idx, static_cast<int64_t>(b.node1(i)->id()));
+      t.setInteger(fn2, idx, node2);
+      t.setDouble(fbathy, idx, bathy);
+      t.setDouble(felev, idx, elev);
+      t.setDouble(fsup, idx, sup);
+      t.setDouble(fsub, idx, sub);
+      t.setDouble(fdiam, idx, pipediam);
+      t.setDouble(fht, idx, pipeht);
+      t.setDouble(fcoef, idx, pipecoef);
+      idx++;
+    }
+    bcid++;
+  };
+
+  for (const auto &b : this->m_openBoundaries) add(b);
+  for (const auto &b : this->m_landBoundaries) add(b);
+  return t;
+}
+
+/**
+ * @brief Writes a feature table to a vector file
+ * @param outputFile output file. GeoPackage (.gpkg) and FlatGeobuf (.fgb)
+ * files are written with GDAL. All other files are written as shapefiles
+ * @param table features to write
+ * @param layerName layer name used by formats that support layers
+ */
+void MeshPrivate::writeFeatures(const std::string &outputFile,
+                                const FeatureTable &table,
+                                const std::string &layerName) const {
+  const std::string driver = OgrWriter::driverName(outputFile);
+  if (driver.empty() || driver == "ESRI Shapefile") {
+    ShapefileWriter(outputFile).write(table);
+    if (this->m_epsg != 0) {
+      this->writePrjFile(outputFile);
+    }
+  } else {
+    OgrWriter(outputFile, this->m_epsg).write(table, layerName);
   }
+}
 
-  DBFClose(dbfid);
-  SHPClose(shpid);
+/**
+ * @brief Writes a set of mesh features to a vector file
+ * @param outputFile output file. The format is selected by extension: .gpkg
+ * for GeoPackage, .fgb for FlatGeobuf, otherwise ESRI shapefile
+ * @param feature mesh features to write
+ */
+void MeshPrivate::toVectorFile(const std::string &outputFile,
+                               Adcirc::Geometry::MeshFeature feature) {
+  switch (feature) {
+    case Adcirc::Geometry::FeatureNodes:
+      this->writeFeatures(outputFile, this->nodeFeatures(), "nodes");
+      break;
+    case Adcirc::Geometry::FeatureElements:
+      this->writeFeatures(outputFile, this->elementFeatures(), "elements");
+      break;
+    case Adcirc::Geometry::FeatureConnectivity:
+      this->writeFeatures(outputFile, this->connectivityFeatures(),
+                          "connectivity");
+      break;
+    case Adcirc::Geometry::FeatureBoundaries:
+      this->writeFeatures(outputFile, this->boundaryFeatures(), "boundaries");
+      break;
+    default:
+      adcircmodules_throw_exception("Mesh: Invalid mesh feature type");
+  }
+}
 
+/**
+ * @brief Writes the mesh nodes into ESRI shapefile format
+ * @param outputFile output file with .shp extension
+ */
+void MeshPrivate::toNodeShapefile(const std::string &outputFile) {
+  ShapefileWriter(outputFile).write(this->nodeFeatures());
   if (this->m_epsg != 0) {
     this->writePrjFile(outputFile);
   }
@@ -1243,26 +1512,12 @@ void MeshPrivate::writePrjFile(const std::string &outputFile) const {
  * @return vector of unique node pairs
  */
 std::vector<std::pair<Node *, Node *>> MeshPrivate::generateLinkTable() {
+  const EdgeTable *edges = this->topology()->edgeTable();
   std::vector<std::pair<Node *, Node *>> legs;
-  legs.reserve(this->numElements() * 4);
-  for (auto &e : this->m_elements) {
-    Element e_s = e;
-    e_s.sortVerticesAboutCenter();
-    for (size_t j = 0; j < e_s.n(); ++j) {
-      std::pair<Node *, Node *> p1 = e_s.elementLeg(j);
-      std::pair<Node *, Node *> p2;
-      if (p1.first->id() > p1.second->id()) {
-        p2 = std::pair<Node *, Node *>(p1.second, p1.first);
-      } else {
-        p2 = std::move(p1);
-      }
-      legs.push_back(p2);
-    }
+  legs.reserve(edges->numEdges());
+  for (size_t i = 0; i < edges->numEdges(); ++i) {
+    legs.push_back(edges->nodes(i));
   }
-  std::set<std::pair<Node *, Node *>> s(legs.begin(), legs.end());
-  legs.clear();
-  legs.assign(s.begin(), s.end());
-  s.clear();
   return legs;
 }
 
@@ -1271,43 +1526,7 @@ std::vector<std::pair<Node *, Node *>> MeshPrivate::generateLinkTable() {
  * @param outputFile output file with .shp extension
  */
 void MeshPrivate::toConnectivityShapefile(const std::string &outputFile) {
-  SHPHandle shpid = SHPCreate(outputFile.c_str(), SHPT_ARC);
-  DBFHandle dbfid = DBFCreate(outputFile.c_str());
-
-  DBFAddField(dbfid, "node1", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node2", FTInteger, 16, 0);
-  DBFAddField(dbfid, "znode1", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode2", FTDouble, 16, 4);
-
-  std::vector<std::pair<Node *, Node *>> legs = this->generateLinkTable();
-
-  for (auto &l : legs) {
-    double latitude[2], longitude[2], elevation[2];
-    int nodeid[2];
-
-    nodeid[0] = l.first->id();
-    nodeid[1] = l.second->id();
-    longitude[0] = l.first->x();
-    longitude[1] = l.second->x();
-    latitude[0] = l.first->y();
-    latitude[1] = l.second->y();
-    elevation[0] = l.first->z();
-    elevation[1] = l.second->z();
-
-    SHPObject *shpobj =
-        SHPCreateSimpleObject(SHPT_ARC, 2, longitude, latitude, elevation);
-    int shp_index = SHPWriteObject(shpid, -1, shpobj);
-    SHPDestroyObject(shpobj);
-
-    DBFWriteIntegerAttribute(dbfid, shp_index, 0, nodeid[0]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 1, nodeid[1]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 2, elevation[0]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 3, elevation[1]);
-  }
-
-  DBFClose(dbfid);
-  SHPClose(shpid);
-
+  ShapefileWriter(outputFile).write(this->connectivityFeatures());
   if (this->m_epsg != 0) {
     this->writePrjFile(outputFile);
   }
@@ -1318,175 +1537,14 @@ void MeshPrivate::toConnectivityShapefile(const std::string &outputFile) {
  * @param outputFile output file with .shp extension
  */
 void MeshPrivate::toElementShapefile(const std::string &outputFile) {
-  SHPHandle shpid = SHPCreate(outputFile.c_str(), SHPT_POLYGON);
-  DBFHandle dbfid = DBFCreate(outputFile.c_str());
-  DBFAddField(dbfid, "elementid", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node1", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node2", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node3", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node4", FTInteger, 16, 0);
-  DBFAddField(dbfid, "znode1", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode2", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode3", FTDouble, 16, 4);
-  DBFAddField(dbfid, "znode4", FTDouble, 16, 4);
-  DBFAddField(dbfid, "zmean", FTDouble, 16, 4);
-
-  for (auto &e : this->m_elements) {
-    double zmean;
-    double longitude[4], latitude[4];
-    double nodeid[4], nodez[4];
-    int id = static_cast<int>(e.id());
-
-    zmean = 0.0;
-    for (size_t i = 0; i < e.n(); ++i) {
-      longitude[i] = e.node(i)->x();
-      latitude[i] = e.node(i)->y();
-      nodez[i] = e.node(i)->z();
-      nodeid[i] = e.node(i)->id();
-      zmean += nodez[i];
-    }
-    zmean = zmean / e.n();
-
-    if (e.n() == 3) {
-      nodez[3] = adcircmodules_default_value<double>();
-      nodeid[3] = -1;
-    }
-
-    SHPObject *shpobj =
-        SHPCreateSimpleObject(SHPT_POLYGON, e.n(), longitude, latitude, nodez);
-    int shp_index = SHPWriteObject(shpid, -1, shpobj);
-    SHPDestroyObject(shpobj);
-
-    DBFWriteIntegerAttribute(dbfid, shp_index, 0, id);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 1, nodeid[0]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 2, nodeid[1]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 3, nodeid[2]);
-    DBFWriteIntegerAttribute(dbfid, shp_index, 4, nodeid[3]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 5, nodez[0]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 6, nodez[1]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 7, nodez[2]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 8, nodez[3]);
-    DBFWriteDoubleAttribute(dbfid, shp_index, 9, zmean);
-  }
-
-  DBFClose(dbfid);
-  SHPClose(shpid);
-
+  ShapefileWriter(outputFile).write(this->elementFeatures());
   if (this->m_epsg != 0) {
     this->writePrjFile(outputFile);
   }
 }
 
 void MeshPrivate::toBoundaryShapefile(const std::string &outputFile) {
-  SHPHandle shpid = SHPCreate(outputFile.c_str(), SHPT_POINTZ);
-  DBFHandle dbfid = DBFCreate(outputFile.c_str());
-  DBFAddField(dbfid, "bndId", FTInteger, 16, 0);
-  DBFAddField(dbfid, "bndIdx", FTInteger, 16, 0);
-  DBFAddField(dbfid, "bndCode", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node1", FTInteger, 16, 0);
-  DBFAddField(dbfid, "node2", FTInteger, 16, 0);
-  DBFAddField(dbfid, "bathy", FTDouble, 16, 4);
-  DBFAddField(dbfid, "bc_elev", FTDouble, 16, 4);
-  DBFAddField(dbfid, "supercritical", FTDouble, 16, 4);
-  DBFAddField(dbfid, "subcritical", FTDouble, 16, 4);
-  DBFAddField(dbfid, "pipediam", FTDouble, 16, 4);
-  DBFAddField(dbfid, "pipeheight", FTDouble, 16, 4);
-  DBFAddField(dbfid, "pipecoef", FTDouble, 16, 4);
-
-  int idx = 0;
-  int bcid = 0;
-  for (auto &b : this->m_openBoundaries) {
-    int code = b.boundaryCode();
-    for (size_t i = 0; i < b.length(); ++i) {
-      int node1 = static_cast<int>(b.node1(i)->id());
-      int node2 = -9999;
-      double lon = b.node1(i)->x();
-      double lat = b.node1(i)->y();
-      double bathy = -b.node1(i)->z();
-      double elev = -9999.0;
-      double sub = -9999.0;
-      double sup = -9999.0;
-      double pipeht = -9999.0;
-      double pipecoef = -9999.0;
-      double pipediam = -9999.0;
-      SHPObject *shpobj =
-          SHPCreateSimpleObject(SHPT_POINTZ, 1, &lon, &lat, &bathy);
-      int shp_index = SHPWriteObject(shpid, -1, shpobj);
-      SHPDestroyObject(shpobj);
-
-      DBFWriteIntegerAttribute(dbfid, shp_index, 0, bcid);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 1, idx);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 2, code);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 3, node1);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 4, node2);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 5, bathy);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 6, elev);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 7, sup);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 8, sub);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 9, pipediam);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 10, pipeht);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 11, pipecoef);
-      idx++;
-    }
-    bcid++;
-  }
-
-  for (auto &b : this->m_landBoundaries) {
-    int code = b.boundaryCode();
-    for (size_t i = 0; i < b.length(); ++i) {
-      int node1 = static_cast<int>(b.node1(i)->id());
-      int node2 = -9999;
-      double lon = b.node1(i)->x();
-      double lat = b.node1(i)->y();
-      double bathy = -b.node1(i)->z();
-      double elev = -9999.0;
-      double sub = -9999.0;
-      double sup = -9999.0;
-      double pipeht = -9999.0;
-      double pipecoef = -9999.0;
-      double pipediam = -9999.0;
-      if (b.isInternalWeir()) {
-        lon = (lon + b.node2(i)->x()) / 2.0;
-        lat = (lat + b.node2(i)->y()) / 2.0;
-        bathy = (bathy + b.node2(i)->z()) / 2.0;
-        node2 = static_cast<int>(b.node2(i)->id());
-        elev = b.crestElevation(i);
-        sup = b.supercriticalWeirCoefficient(i);
-        sub = b.subcriticalWeirCoefficient(i);
-      } else if (b.isExternalWeir()) {
-        elev = b.crestElevation(i);
-        sup = b.supercriticalWeirCoefficient(i);
-      }
-      if (b.isInternalWeirWithPipes()) {
-        pipeht = b.pipeHeight(i);
-        pipediam = b.pipeDiameter(i);
-        pipecoef = b.pipeCoefficient(i);
-      }
-      SHPObject *shpobj =
-          SHPCreateSimpleObject(SHPT_POINTZ, 1, &lon, &lat, &bathy);
-      int shp_index = SHPWriteObject(shpid, -1, shpobj);
-      SHPDestroyObject(shpobj);
-
-      DBFWriteIntegerAttribute(dbfid, shp_index, 0, bcid);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 1, idx);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 2, code);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 3, node1);
-      DBFWriteIntegerAttribute(dbfid, shp_index, 4, node2);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 5, bathy);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 6, elev);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 7, sup);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 8, sub);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 9, pipediam);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 10, pipeht);
-      DBFWriteDoubleAttribute(dbfid, shp_index, 11, pipecoef);
-      idx++;
-    }
-    bcid++;
-  }
-
-  DBFClose(dbfid);
-  SHPClose(shpid);
-
+  ShapefileWriter(outputFile).write(this->boundaryFeatures());
   if (this->m_epsg != 0) {
     this->writePrjFile(outputFile);
   }
@@ -1653,10 +1711,8 @@ void MeshPrivate::buildNodalSearchTree() {
     y.push_back(n.y());
   }
 
-  if (this->m_nodalSearchTree != nullptr) {
-    if (this->m_nodalSearchTree->initialized()) {
-      this->m_nodalSearchTree.reset(nullptr);
-    }
+  if (this->m_nodalSearchTree->initialized()) {
+    this->m_nodalSearchTree = std::make_unique<Kdtree>();
   }
 
   ierr = this->m_nodalSearchTree->build(x, y);
@@ -1683,10 +1739,8 @@ void MeshPrivate::buildElementalSearchTree() {
     y.push_back(tempY);
   }
 
-  if (this->m_elementalSearchTree != nullptr) {
-    if (this->m_elementalSearchTree->initialized()) {
-      this->m_elementalSearchTree.reset(nullptr);
-    }
+  if (this->m_elementalSearchTree->initialized()) {
+    this->m_elementalSearchTree = std::make_unique<Kdtree>();
   }
 
   int ierr = this->m_elementalSearchTree->build(x, y);
@@ -1700,7 +1754,7 @@ void MeshPrivate::buildElementalSearchTree() {
  */
 void MeshPrivate::deleteNodalSearchTree() {
   if (this->nodalSearchTreeInitialized()) {
-    this->m_nodalSearchTree.reset();
+    this->m_nodalSearchTree = std::make_unique<Kdtree>();
   }
 }
 
@@ -1709,7 +1763,7 @@ void MeshPrivate::deleteNodalSearchTree() {
  */
 void MeshPrivate::deleteElementalSearchTree() {
   if (this->elementalSearchTreeInitialized()) {
-    this->m_elementalSearchTree.reset();
+    this->m_elementalSearchTree = std::make_unique<Kdtree>();
   }
 }
 
@@ -1771,6 +1825,7 @@ void MeshPrivate::addNode(size_t index, const Node &node) {
   } else {
     adcircmodules_throw_exception("Mesh: Node index > number of nodes");
   }
+  this->invalidateEdgeTable();
 }
 void MeshPrivate::addNode(size_t index, const Node *node) {
   if (index < this->numNodes()) {
@@ -1808,6 +1863,7 @@ void MeshPrivate::addElement(size_t index, const Element &element) {
   } else {
     adcircmodules_throw_exception("Mesh: Element index > number of elements");
   }
+  this->invalidateEdgeTable();
 }
 
 /**
@@ -1988,8 +2044,8 @@ size_t MeshPrivate::getMaxNodesPerElement() {
  * @param filename name of the output file (*_net.nc)
  */
 void MeshPrivate::writeDflowMesh(const std::string &filename) {
-  std::vector<std::pair<Node *, Node *>> links = this->generateLinkTable();
-  size_t nlinks = links.size();
+  const EdgeTable *edges = this->topology()->edgeTable();
+  size_t nlinks = edges->numEdges();
   size_t maxelemnode = this->getMaxNodesPerElement();
 
   std::vector<double> xarray(this->numNodes());
@@ -2007,9 +2063,10 @@ void MeshPrivate::writeDflowMesh(const std::string &filename) {
 
   size_t idx = 0;
   for (size_t i = 0; i < nlinks; ++i) {
-    linkArray[idx] = links[i].first->id();
+    const auto &edge = edges->edge(i);
+    linkArray[idx] = this->m_nodes[edge.node1].id();
     idx++;
-    linkArray[idx] = links[i].second->id();
+    linkArray[idx] = this->m_nodes[edge.node2].id();
     idx++;
     linkTypeArray[i] = 2;
   }
@@ -2197,7 +2254,7 @@ size_t MeshPrivate::nodeIndexById(size_t id) {
   if (this->m_nodeOrderingLogical) {
     return id - 1;
   } else {
-    return this->m_nodeLookup[id];
+    return this->m_nodeLookup.at(id);
   }
 }
 
@@ -2210,10 +2267,42 @@ size_t MeshPrivate::elementIndexById(size_t id) {
   if (this->m_elementOrderingLogical) {
     return id - 1;
   } else {
-    return this->m_elementLookup[id];
+    return this->m_elementLookup.at(id);
   }
 }
 
+/**
+ * @brief Returns the position in the array of a node
+ * @param node pointer to a node
+ * @return array position
+ *
+ * Pointers into this mesh are resolved without a lookup. Pointers to nodes
+ * stored elsewhere fall back to the search by id
+ */
+size_t MeshPrivate::nodeIndex(const Node *node) {
+  const Node *base = this->m_nodes.data();
+  if (node >= base && node < base + this->m_nodes.size()) {
+    return static_cast<size_t>(node - base);
+  }
+  return this->nodeIndexById(node->id());
+}
+
+/**
+ * @brief Returns the position in the array of an element
+ * @param element pointer to an element
+ * @return array position
+ *
+ * Pointers into this mesh are resolved without a lookup. Pointers to elements
+ * stored elsewhere fall back to the search by id
+ */
+size_t MeshPrivate::elementIndex(const Element *element) {
+  const Element *base = this->m_elements.data();
+  if (element >= base && element < base + this->m_elements.size()) {
+    return static_cast<size_t>(element - base);
+  }
+  return this->elementIndexById(element->id());
+}
+
 /**
  * @brief Returns a vector of the x-coordinates
  * @return vector of x coordinates
@@ -2382,22 +2471,11 @@ size_t MeshPrivate::findElement(double x, double y) {
  */
 size_t MeshPrivate::findElement(double x, double y,
                                 std::vector<double> &weights) {
-  constexpr int searchDepth = 20;
-
   if (!this->elementalSearchTreeInitialized()) {
     this->buildElementalSearchTree();
   }
 
-  std::vector<size_t> indicies =
-      this->elementalSearchTree()->findXNearest(x, y, searchDepth);
-  auto en = adcircmodules_default_value<size_t>();
-
-  for (auto i : indicies) {
-    if (this->element(i)->isInside(x, y)) {
-      en = i;
-      break;
-    }
-  }
+  const size_t en = this->searchElement(x, y);
 
   if (en == adcircmodules_default_value<size_t>()) {
     std::fill(weights.begin(), weights.end(), 0.0);
@@ -2408,6 +2486,25 @@ size_t MeshPrivate::findElement(double x, double y,
   return en;
 }
 
+/**
+ * @brief Searches the nearest elements in the elemental search tree for the
+ * one containing a location
+ * @param x location to search
+ * @param y location to search
+ * @return index of the element, large integer if not found
+ *
+ * The elemental search tree must already be built
+ */
+size_t MeshPrivate::searchElement(double x, double y) const {
+  constexpr size_t searchDepth = 20;
+  const std::vector<size_t> candidates =
+      this->m_elementalSearchTree->findXNearest(x, y, searchDepth);
+  for (auto i : candidates) {
+    if (this->m_elements[i].isInside(x, y)) return i;
+  }
+  return adcircmodules_default_value<size_t>();
+}
+
 /**
  * @brief Finds the mesh element that a given location lies within
  * @param location location to search
@@ -2419,79 +2516,168 @@ size_t MeshPrivate::findElement(Point &location) {
 
 /**
  * @brief Computes average size of the element edges connected to each node
+ * @param epsg coordinate system to measure the edges in. The mesh itself is
+ * not modified. If 0, the current mesh coordinates are used
  * @return vector containing size at each node
  */
 std::vector<double> MeshPrivate::computeMeshSize(int epsg) {
-  if (!this->topology()->elementTable()->initialized()) {
-    this->topology()->elementTable()->build();
+  std::vector<double> x, y;
+  x.reserve(this->numNodes());
+  y.reserve(this->numNodes());
+  for (const auto &n : this->m_nodes) {
+    x.push_back(n.x());
+    y.push_back(n.y());
   }
 
-  int epsg_original = this->projection();
-  if (epsg != 0 && epsg_original != epsg) {
-    this->reproject(epsg);
+  if (epsg != 0 && this->projection() != epsg && !x.empty()) {
+    bool isLatLon = false;
+    int ierr = Adcirc::Projection::transformInPlace(this->projection(), epsg, x,
+                                                    y, isLatLon);
+    if (ierr != 0) {
+      adcircmodules_throw_exception("Mesh: Proj library error");
+    }
   }
 
-  std::vector<double> meshsize(this->numNodes());
+  const Node *base = this->m_nodes.data();
+  std::vector<double> elementSize(this->numElements());
 
-  for (size_t i = 0; i < this->numNodes(); ++i) {
-    std::vector<Element *> l =
-        this->topology()->elementTable()->elementList(this->node(i));
-    double a = 0.0;
-
-    for (auto &j : l) {
-      a += j->elementSize(false);
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < this->numElements(); ++i) {
+    const Element &e = this->m_elements[i];
+    double size = 0.0;
+    for (size_t j = 0; j < e.n(); ++j) {
+      auto leg = e.elementLeg(j);
+      const size_t n1 = static_cast<size_t>(leg.first - base);
+      const size_t n2 = static_cast<size_t>(leg.second - base);
+      size += Constants::distance(x[n1], y[n1], x[n2], y[n2], false);
     }
+    elementSize[i] = size / e.n();
+  }
 
-    if (!l.empty())
-      meshsize[i] = a / l.size();
-    else
-      meshsize[i] = 0.0;
+  std::vector<double> meshsize(this->numNodes(), 0.0);
+  std::vector<size_t> count(this->numNodes(), 0);
+  for (size_t i = 0; i < this->numElements(); ++i) {
+    const Element &e = this->m_elements[i];
+    for (size_t j = 0; j < e.n(); ++j) {
+      const size_t n = static_cast<size_t>(e.node(j) - base);
+      meshsize[n] += elementSize[i];
+      count[n]++;
+    }
+  }
 
+  for (size_t i = 0; i < this->numNodes(); ++i) {
+    if (count[i] > 0) meshsize[i] /= count[i];
     if (meshsize[i] < 0.0) {
       adcircmodules_throw_exception("Error computing mesh size table.");
     }
   }
 
-  if (epsg != 0 && epsg_original != epsg) {
-    this->reproject(epsg_original);
-  }
-
   return meshsize;
 }
 
 /**
- * @brief comparison function for sorting the tuples of element edges
- * @param a first
- * @param b second
- * @return  true of a < b
+ * @brief Reorders the nodes and elements of the mesh to improve memory
+ * locality
+ * @param strategy ordering strategy
+ * @param renumber if true, the node and element ids are reset to their new
+ * positions. Otherwise ids are kept as labels and the lookup tables are
+ * rebuilt
+ * @return gather list of the node order, where entry i is the previous
+ * position of the node now at position i
  */
-bool sortEdgeTuple(const std::tuple<Node *, Node *, Element *> &a,
-                   const std::tuple<Node *, Node *, Element *> &b) {
-  Node *n11, *n12;
-  Node *n21, *n22;
-  Element *e1, *e2;
-  std::tie(n11, n12, e1) = a;
-  std::tie(n21, n22, e2) = b;
-  if (n11->id() < n21->id()) return true;
-  if (n12->id() < n22->id()) return true;
-  return false;
-}
+std::vector<size_t> MeshPrivate::reorder(
+    Adcirc::Geometry::ReorderStrategy strategy, bool renumber) {
+  using Adcirc::Geometry::MeshReorder;
 
-/**
- * @brief Determines if two tuples of element edges refer to the same edge
- * @param a first
- * @param b second
- * @return true of a == b
- */
-bool edgeTupleEqual(const std::tuple<Node *, Node *, Element *> &a,
-                    const std::tuple<Node *, Node *, Element *> &b) {
-  Node *n11, *n12;
-  Node *n21, *n22;
-  Element *e1, *e2;
-  std::tie(n11, n12, e1) = a;
-  std::tie(n21, n22, e2) = b;
-  if (n11->id() == n21->id() && n12->id() == n22->id()) return true;
-  return false;
+  std::vector<size_t> nodeOrder;
+  if (strategy == Adcirc::Geometry::ReorderReverseCuthillMcKee) {
+    if (!this->topology()->nodeTable()->initialized()) {
+      this->topology()->nodeTable()->build();
+    }
+    nodeOrder = MeshReorder::reverseCuthillMcKee(
+        this->topology()->nodeTable()->adjacency());
+  } else {
+    nodeOrder = MeshReorder::spaceFillingCurve(this->x(), this->y(), strategy);
+  }
+  const std::vector<size_t> nodeRank = MeshReorder::inverse(nodeOrder);
+
+  //...Elements follow the first of their nodes in the new ordering
+  std::vector<size_t> elementKey(this->numElements());
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < this->m_elements.size(); ++i) {
+    const Element &e = this->m_elements[i];
+    size_t k = this->numNodes();
+    for (size_t j = 0; j < e.n(); ++j) {
+      k = std::min(k, nodeRank[this->nodeIndex(e.node(j))]);
+    }
+    elementKey[i] = k;
+  }
+  const std::vector<size_t> elementOrder =
+      MeshReorder::elementOrder(elementKey, this->numNodes() + 1);
+
+  std::vector<Node> nodes(this->numNodes());
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    nodes[i] = this->m_nodes[nodeOrder[i]];
+    if (renumber) nodes[i].setId(i + 1);
+  }
+
+  auto remap = [&](const Node *n) {
+    return &nodes[nodeRank[this->nodeIndex(n)]];
+  };
+
+  std::vector<Element> elements(this->numElements());
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < elements.size(); ++i) {
+    elements[i] = this->m_elements[elementOrder[i]];
+    for (size_t j = 0; j < elements[i].n(); ++j) {
+      elements[i].setNode(j, remap(elements[i].node(j)));
+    }
+    if (renumber) elements[i].setId(i + 1);
+  }
+
+  for (auto &b : this->m_openBoundaries) {
+    for (size_t j = 0; j < b.length(); ++j) {
+      b.setNode1(j, remap(b.node1(j)));
+    }
+  }
+
+  for (auto &b : this->m_landBoundaries) {
+    for (size_t j = 0; j < b.length(); ++j) {
+      b.setNode1(j, remap(b.node1(j)));
+      if (b.isInternalWeir()) b.setNode2(j, remap(b.node2(j)));
+    }
+  }
+
+  this->m_nodes.swap(nodes);
+  this->m_elements.swap(elements);
+
+  this->m_nodeLookup.clear();
+  this->m_nodeOrderingLogical = true;
+  for (size_t i = 0; i < this->m_nodes.size(); ++i) {
+    if (this->m_nodes[i].id() != i + 1) {
+      this->m_nodeOrderingLogical = false;
+      this->buildNodeLookupTable();
+      break;
+    }
+  }
+
+  this->m_elementLookup.clear();
+  this->m_elementOrderingLogical = true;
+  for (size_t i = 0; i < this->m_elements.size(); ++i) {
+    if (this->m_elements[i].id() != i + 1) {
+      this->m_elementOrderingLogical = false;
+      this->buildElementLookupTable();
+      break;
+    }
+  }
+
+  this->deleteNodalSearchTree();
+  this->deleteElementalSearchTree();
+  this->m_topology = std::make_unique<Adcirc::Geometry::Topology>(this);
+  this->m_hash.reset(nullptr);
+
+  return nodeOrder;
 }
 
 /**
@@ -2505,101 +2691,53 @@ bool edgeTupleEqual(const std::tuple<Node *, Node *, Element *> &a,
  * calculations
  */
 std::vector<std::vector<double>> MeshPrivate::orthogonality() {
-  std::vector<std::vector<double>> o;
-  o.reserve(this->numElements() * 2);
-
-  //...Build the node pairs with duplicates
-  std::vector<std::tuple<Node *, Node *, Element *>> edg;
-  edg.reserve(this->numElements() * 4);
-  for (auto &e : this->m_elements) {
-    e.sortVerticesAboutCenter();
-    for (size_t i = 0; i < e.n(); i++) {
-      std::pair<Node *, Node *> p = e.elementLeg(i);
-      Node *a = p.first;
-      Node *b = p.second;
-      if (a->id() < b->id()) {
-        edg.emplace_back(a, b, &e);
-      } else {
-        edg.emplace_back(b, a, &e);
-      }
-    }
-  }
+  const EdgeTable *edges = this->topology()->edgeTable();
 
-  //...Sort the node pairs so we can iterate
-  std::sort(edg.begin(), edg.end(), sortEdgeTuple);
-
-  //...Iterate over the edges which now are back to back
-  //   and calculate the orthogonality
-  for (size_t i = 0; i < edg.size() - 1; ++i) {
-    if (edgeTupleEqual(edg[i], edg[i + 1])) {
-      Node *n11, *n12;
-      Node *n21, *n22;
-      Element *e1, *e2;
-      std::tie(n11, n12, e1) = edg[i];
-      std::tie(n21, n22, e2) = edg[i + 1];
-      double xc1, xc2, yc1, yc2;
-      e1->getElementCenter(xc1, yc1);
-      e2->getElementCenter(xc2, yc2);
-      double outx = (n11->x() + n12->x()) / 2.0;
-      double outy = (n11->y() + n12->y()) / 2.0;
-      double dx1 = n12->x() - n11->x();
-      double dy1 = n12->y() - n11->y();
-      double dx2 = xc2 - xc1;
-      double dy2 = yc2 - yc1;
-      double r1 = dx1 * dx1 + dy1 * dy1;
-      double r2 = dx2 * dx2 + dy2 * dy2;
-      double ortho = (dx1 * dx2 + dy1 * dy2) / std::sqrt(r1 * r2);
-      std::vector<double> v = {outx, outy,
-                               std::abs(std::max(std::min(ortho, 1.0), -1.0))};
-      o.push_back(v);
-    }
+  std::vector<std::vector<double>> o;
+  o.reserve(edges->numEdges());
+
+  for (const auto &edge : edges->edges()) {
+    if (edge.numElements < 2) continue;
+    const Node &n1 = this->m_nodes[edge.node1];
+    const Node &n2 = this->m_nodes[edge.node2];
+    double xc1, xc2, yc1, yc2;
+    this->m_elements[edge.element1].getElementCenter(xc1, yc1);
+    this->m_elements[edge.element2].getElementCenter(xc2, yc2);
+    double outx = (n1.x() + n2.x()) / 2.0;
+    double outy = (n1.y() + n2.y()) / 2.0;
+    double dx1 = n2.x() - n1.x();
+    double dy1 = n2.y() - n1.y();
+    double dx2 = xc2 - xc1;
+    double dy2 = yc2 - yc1;
+    double r1 = dx1 * dx1 + dy1 * dy1;
+    double r2 = dx2 * dx2 + dy2 * dy2;
+    double ortho = (dx1 * dx2 + dy1 * dy2) / std::sqrt(r1 * r2);
+    o.push_back(
+        {outx, outy, std::abs(std::max(std::min(ortho, 1.0), -1.0))});
   }
 
   return o;
 }
 
+/**
+ * @brief Returns the nodes that lie on an edge belonging to only one element
+ * @return vector of boundary nodes, in mesh order
+ */
 std::vector<Adcirc::Geometry::Node *> MeshPrivate::boundaryNodes() {
-  std::vector<std::pair<Node *, Node *>> links = this->generateLinkTable();
-  std::vector<size_t> count(links.size());
-  std::fill(count.begin(), count.end(), 0);
-
-  std::unordered_map<std::pair<Node *, Node *>, size_t,
-                     boost::hash<std::pair<Node *, Node *>>>
-      lookup;
+  const EdgeTable *edges = this->topology()->edgeTable();
 
-  lookup.reserve(links.size());
-  for (size_t i = 0; i < links.size(); ++i) {
-    lookup[links[i]] = i;
-  }
-
-  for (auto &e : this->m_elements) {
-    for (size_t j = 0; j < e.n(); ++j) {
-      std::pair<Node *, Node *> p1 = e.elementLeg(j);
-      std::pair<Node *, Node *> p2;
-      if (p1.first->id() > p1.second->id()) {
-        p2 = std::pair<Node *, Node *>(p1.second, p1.first);
-      } else {
-        p2 = std::move(p1);
-      }
-
-      count[lookup[p2]] += static_cast<size_t>(1);
+  std::vector<char> onBoundary(this->numNodes(), 0);
+  for (const auto &edge : edges->edges()) {
+    if (edge.numElements == 1) {
+      onBoundary[edge.node1] = 1;
+      onBoundary[edge.node2] = 1;
     }
   }
 
   std::vector<Adcirc::Geometry::Node *> bdyVec;
-  bdyVec.reserve(count.size() * 2);
-  for (size_t i = 0; i < links.size(); ++i) {
-    if (count[i] == 1) {
-      bdyVec.push_back(links[i].first);
-      bdyVec.push_back(links[i].second);
-    }
+  for (size_t i = 0; i < this->numNodes(); ++i) {
+    if (onBoundary[i]) bdyVec.push_back(&this->m_nodes[i]);
   }
-
-  std::set<Node *> bnd(bdyVec.begin(), bdyVec.end());
-  bdyVec.clear();
-  bdyVec.assign(bnd.begin(), bnd.end());
-  bnd.clear();
-
   return bdyVec;
 }
 
@@ -2730,30 +2868,6 @@ void MeshPrivate::toRaster(const std::string &filename,
   adcircmodules_throw_exception("GDAL is not enabled.");
 #else
 
-  auto getfmt = [&](const std::string &ext) -> std::string {
-    if (ext == ".tif") return "GTiff";
-    if (ext == ".img") return "HFA";
-    return std::string();
-  };
-
-  std::string fmt = getfmt(Adcirc::FileIO::Generic::getFileExtension(filename));
-
-  if (fmt.empty()) {
-    adcircmodules_throw_exception("Could not determine the raster format");
-  }
-
-  GDALAllRegister();
-  GDALDriver *driver = GetGDALDriverManager()->GetDriverByName(fmt.c_str());
-
-  char **options = nullptr;
-  if (fmt == "GTiff") {
-    options = CSLSetNameValue(options, "BIGTIFF", "IF_SAFER");
-    options = CSLSetNameValue(options, "TILED", "YES");
-    options = CSLSetNameValue(options, "COMPRESS", "LZW");
-  } else {
-    options = CSLSetNameValue(options, "COMPRESS", "YES");
-  }
-
   double xmax = std::max(extent[0], extent[2]);
   double xmin = std::min(extent[0], extent[2]);
   double ymax = std::max(extent[3], extent[1]);
@@ -2761,122 +2875,137 @@ void MeshPrivate::toRaster(const std::string &filename,
   int nx = std::floor(std::abs(xmax - xmin) / resolution) + 1;
   int ny = std::floor(std::abs(ymax - ymin) / resolution) + 1;
 
-  //...Make sure to fix the extents vector
-  std::vector<double> extent_ordered = {xmin, ymin, xmax, ymax};
-
   if (nx < 3 || ny < 3) {
     adcircmodules_throw_exception("Invalid resolution specified.");
   }
 
-  GDALDataset *raster =
-      driver->Create(filename.c_str(), nx, ny, 1, GDT_Float32, options);
-
-  double transform[6] = {xmin, resolution, 0, ymax, 0, -resolution};
-  raster->SetGeoTransform(transform);
-
-  char *cwkt = nullptr;
-  OGRSpatialReference sref;
-  std::string srefstr = boost::str(boost::format("EPSG:%i") % this->m_epsg);
-  sref.SetWellKnownGeogCS(srefstr.c_str());
-  sref.exportToWkt(&cwkt);
-  raster->SetProjection(cwkt);
-  CPLFree(cwkt);
-
+  GDALDataset *raster = Adcirc::FileIO::createRaster(
+      filename, static_cast<size_t>(nx), static_cast<size_t>(ny), xmin, ymax,
+      resolution, this->m_epsg, nullvalue, description, units);
   GDALRasterBand *band = raster->GetRasterBand(1);
-  band->SetDescription(description.c_str());
-  band->SetUnitType(units.c_str());
-  band->SetNoDataValue(nullvalue);
-  band->Fill(nullvalue);
-
-  std::vector<std::vector<double>> weight;
-  std::vector<size_t> elements;
-  std::tie(weight, elements) =
-      this->computeRasterInterpolationWeights(extent_ordered, nx, ny, resolution);
-  std::vector<float> zr =
-      this->getRasterValues(z, nullvalue, elements, weight, partialWetting);
-
-  CPLErr cr = band->RasterIO(GF_Write, 0, 0, nx, ny, zr.data(), nx, ny,
-                             GDT_Float32, 0, 0);
-  if (cr != CE_None) {
-    GDALClose(static_cast<GDALDatasetH>(raster));
-    CSLDestroy(options);
-    adcircmodules_throw_exception("Error during Raster I/O in GDAL library");
-  }
 
-  double bmin, bmax, bmean, bsigma;
-  band->ComputeStatistics(true, &bmin, &bmax, &bmean, &bsigma, nullptr,
-                          nullptr);
-  band->SetStatistics(bmin, bmax, bmean, bsigma);
+  int blockx, blocky;
+  band->GetBlockSize(&blockx, &blocky);
+  const size_t bx = static_cast<size_t>(blockx);
+  const size_t by = static_cast<size_t>(blocky);
+  const size_t nbx = (static_cast<size_t>(nx) + bx - 1) / bx;
+  const size_t nby = (static_cast<size_t>(ny) + by - 1) / by;
+  const size_t nblocks = nbx * nby;
 
-  GDALClose(static_cast<GDALDatasetH>(raster));
-  CSLDestroy(options);
+  if (!this->elementalSearchTreeInitialized()) {
+    this->buildElementalSearchTree();
+  }
 
+#ifdef _OPENMP
+  Adcirc::Logging::log(boost::str(
+      boost::format("Using %i threads to rasterize %i blocks.") %
+      omp_get_max_threads() % nblocks));
 #endif
-}
 
-std::vector<float> MeshPrivate::getRasterValues(
-    const std::vector<double> &z, const double nullvalue,
-    const std::vector<size_t> &elements,
-    const std::vector<std::vector<double>> &weights,
-    const bool partialWetting) {
-  size_t sz = elements.size();
-  auto zv = std::vector<float>(sz);
-  for (size_t i = 0; i < sz; ++i) {
-    size_t e = elements[i];
-    if (e == adcircmodules_default_value<size_t>()) {
-      zv[i] = nullvalue;
-    } else {
-      size_t n1 = this->element(e)->node(0)->id() - 1;
-      size_t n2 = this->element(e)->node(1)->id() - 1;
-      size_t n3 = this->element(e)->node(2)->id() - 1;
-      double v1 = z[n1];
-      double v2 = z[n2];
-      double v3 = z[n3];
-      zv[i] = partialWetting ? MeshPrivate::calculateValueWithPartialWetting(
-                                   v1, v2, v3, nullvalue, weights[i])
-                             : MeshPrivate::calculateValueWithoutPartialWetting(
-                                   v1, v2, v3, nullvalue, weights[i]);
+  //...Each block is located and interpolated independently. Only the write
+  // into the dataset is serialized since GDAL datasets are not thread safe
+  bool ioError = false;
+  RasterStatistics stats;
+
+#pragma omp parallel
+  {
+    std::vector<float> buffer(bx * by);
+    RasterStatistics localStats;
+
+#pragma omp for schedule(dynamic)
+    for (size_t b = 0; b < nblocks; ++b) {
+      const size_t i0 = (b % nbx) * bx;
+      const size_t j0 = (b / nbx) * by;
+      const size_t ni = std::min(bx, static_cast<size_t>(nx) - i0);
+      const size_t nj = std::min(by, static_cast<size_t>(ny) - j0);
+
+      this->rasterizeBlock(z, nullvalue, partialWetting, xmin, ymax,
+                           resolution, i0, j0, ni, nj, buffer.data(),
+                           localStats);
+
+#pragma omp critical(toRasterWrite)
+      {
+        if (!ioError) {
+          CPLErr cr = band->RasterIO(
+              GF_Write, static_cast<int>(i0), static_cast<int>(j0),
+              static_cast<int>(ni), static_cast<int>(nj), buffer.data(),
+              static_cast<int>(ni), static_cast<int>(nj), GDT_Float32, 0, 0);
+          ioError = cr != CE_None;
+        }
+      }
     }
+
+#pragma omp critical(toRasterStatistics)
+    stats.merge(localStats);
   }
-  return zv;
-}
 
-std::pair<std::vector<std::vector<double>>, std::vector<size_t>>
-MeshPrivate::computeRasterInterpolationWeights(
-    const std::vector<double> &extent, const size_t nx, const size_t ny,
-    const double resolution) {
-  double xmin = extent[0];
-  double ymax = extent[3];
+  if (ioError) {
+    GDALClose(static_cast<GDALDatasetH>(raster));
+    adcircmodules_throw_exception("Error during Raster I/O in GDAL library");
+  }
 
-  std::vector<size_t> elements;
-  std::vector<std::vector<double>> weight;
-  elements.resize(nx * ny);
-  weight.resize(nx * ny);
+  if (stats.count > 0) {
+    const double mean = stats.sum / stats.count;
+    const double sigma =
+        std::sqrt(std::max(0.0, stats.sumSquared / stats.count - mean * mean));
+    band->SetStatistics(stats.minimum, stats.maximum, mean, sigma);
+  }
 
-#ifdef _OPENMP
-  std::string parmessage = boost::str(
-      boost::format("Using %i threads to compute interpolation weights.") %
-      omp_get_num_procs());
-  Adcirc::Logging::log(parmessage);
-#endif
+  GDALClose(static_cast<GDALDatasetH>(raster));
 
-  if (!this->elementalSearchTreeInitialized()) {
-    this->buildElementalSearchTree();
-  }
+#endif
+}
 
-#pragma omp parallel for shared(weight, elements, xmin, ymax) \
-    schedule(dynamic) collapse(2)
-  for (size_t j = 0; j < ny; ++j) {
-    for (size_t i = 0; i < nx; ++i) {
-      size_t k = j * nx + i;
+/**
+ * @brief Interpolates the mesh values onto one block of raster pixels
+ * @param[in] z nodal values
+ * @param[in] nullvalue value used for pixels outside the mesh or dry
+ * @param[in] partialWetting compute values for partially wet elements
+ * @param[in] xmin left edge of the raster
+ * @param[in] ymax top edge of the raster
+ * @param[in] resolution pixel size
+ * @param[in] i0 first column of the block
+ * @param[in] j0 first row of the block
+ * @param[in] ni number of columns in the block
+ * @param[in] nj number of rows in the block
+ * @param[out] buffer row-major output of size ni * nj
+ * @param[inout] stats statistics of the valid pixels written
+ */
+void MeshPrivate::rasterizeBlock(const std::vector<double> &z,
+                                 const double nullvalue,
+                                 const bool partialWetting, const double xmin,
+                                 const double ymax, const double resolution,
+                                 const size_t i0, const size_t j0,
+                                 const size_t ni, const size_t nj,
+                                 float *buffer, RasterStatistics &stats) {
+  const Node *base = this->m_nodes.data();
+  const float fnull = static_cast<float>(nullvalue);
+  std::array<double, 4> w;
+
+  for (size_t jj = 0; jj < nj; ++jj) {
+    for (size_t ii = 0; ii < ni; ++ii) {
       double x, y;
-      std::tie(x, y) =
-          MeshPrivate::pixelToCoordinate(i, j, resolution, xmin, ymax);
-      std::vector<double> w;
-      elements[k] = this->findElement(x, y, weight[k]);
+      std::tie(x, y) = MeshPrivate::pixelToCoordinate(i0 + ii, j0 + jj,
+                                                      resolution, xmin, ymax);
+      float &v = buffer[jj * ni + ii];
+      v = fnull;
+
+      const size_t e = this->searchElement(x, y);
+      if (e != adcircmodules_default_value<size_t>()) {
+        const Element *el = &this->m_elements[e];
+        el->interpolationWeights(x, y, w);
+        const double v1 = z[el->node(0) - base];
+        const double v2 = z[el->node(1) - base];
+        const double v3 = z[el->node(2) - base];
+        v = partialWetting ? MeshPrivate::calculateValueWithPartialWetting(
+                                 v1, v2, v3, nullvalue, w.data())
+                           : MeshPrivate::calculateValueWithoutPartialWetting(
+                                 v1, v2, v3, nullvalue, w.data());
+      }
+
+      if (v != fnull) stats.add(v);
     }
   }
-  return {weight, elements};
 }
 
 std::pair<double, double> MeshPrivate::pixelToCoordinate(
@@ -2888,7 +3017,7 @@ std::pair<double, double> MeshPrivate::pixelToCoordinate(
 
 float MeshPrivate::calculateValueWithoutPartialWetting(
     const double v1, const double v2, const double v3, const double nullvalue,
-    const std::vector<double> &weight) {
+    const double *weight) {
   return FpCompare::equalTo(v1, nullvalue) ||
                  FpCompare::equalTo(v2, nullvalue) ||
                  FpCompare::equalTo(v3, nullvalue)
@@ -2899,7 +3028,7 @@ float MeshPrivate::calculateValueWithoutPartialWetting(
 
 float MeshPrivate::calculateValueWithPartialWetting(
     const double v1, const double v2, const double v3, const double nullvalue,
-    const std::vector<double> &weight) {
+    const double *weight) {
   bool b1 = FpCompare::equalTo(v1, nullvalue) ||
             FpCompare::equalTo(v1, adcircmodules_default_value<double>());
   bool b2 = FpCompare::equalTo(v2, nullvalue) ||
@@ -2916,17 +3045,21 @@ float MeshPrivate::calculateValueWithPartialWetting(
     return static_cast<float>(v2);
   } else if (b2 && b3 && !b1) {
     return static_cast<float>(v1);
-  } else if (b1 && b2 && !b3) {
-    double f = 1.0 / (weight[0] + weight[1]);
+  }
+
+  //...One dry node. The weights of the wet nodes are renormalized unless the
+  // location sits on the dry node itself
+  const double w = (b1 ? 0.0 : weight[0]) + (b2 ? 0.0 : weight[1]) +
+                   (b3 ? 0.0 : weight[2]);
+  if (w == 0.0) return static_cast<float>(nullvalue);
+  const double f = 1.0 / w;
+  if (b3) {
     return static_cast<float>(weight[0] * f * v1 + weight[1] * f * v2);
-  } else if (b1 && b3 && !b2) {
-    double f = 1.0 / (weight[0] + weight[2]);
+  } else if (b2) {
     return static_cast<float>(weight[0] * f * v1 + weight[2] * f * v3);
-  } else if (b2 && b3 && !b1) {
-    double f = 1.0 / (weight[1] + weight[2]);
+  } else {
     return static_cast<float>(weight[1] * f * v2 + weight[2] * f * v3);
   }
-  return std::numeric_limits<float>::max();
 }
 
 Adcirc::Geometry::Topology *MeshPrivate::topology() { return m_topology.get(); }
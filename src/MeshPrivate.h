@@ -19,10 +19,11 @@
 #ifndef ADCMOD_MESHPRIVATE_H
 #define ADCMOD_MESHPRIVATE_H
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -30,8 +31,11 @@
 #include "Boundary.h"
 #include "Element.h"
 #include "FaceTable.h"
+#include "FeatureTable.h"
 #include "FileTypes.h"
+#include "IdIndex.h"
 #include "KDTree.h"
+#include "MeshReorder.h"
 #include "Node.h"
 #include "Point.h"
 #include "Topology.h"
@@ -109,6 +113,9 @@ class MeshPrivate {
                                bool bothSides = false);
   void toWeirPolygonShapefile(const std::string &outputFile);
 
+  void toVectorFile(const std::string &outputFile,
+                    Adcirc::Geometry::MeshFeature feature);
+
   void buildNodalSearchTree();
   void buildElementalSearchTree();
 
@@ -147,6 +154,9 @@ class MeshPrivate {
   size_t nodeIndexById(size_t id);
   size_t elementIndexById(size_t id);
 
+  size_t nodeIndex(const Adcirc::Geometry::Node *node);
+  size_t elementIndex(const Adcirc::Geometry::Element *element);
+
   void resizeMesh(size_t numNodes, size_t numElements, size_t numOpenBoundaries,
                   size_t numLandBoundaries);
 
@@ -168,6 +178,9 @@ class MeshPrivate {
 
   std::vector<double> computeMeshSize(int epsg = 0);
 
+  std::vector<size_t> reorder(Adcirc::Geometry::ReorderStrategy strategy,
+                              bool renumber = false);
+
   std::string hash(bool force = false);
 
   Adcirc::Cryptography::HashType hashType() const;
@@ -214,6 +227,8 @@ class MeshPrivate {
 
   void _init();
 
+  void invalidateEdgeTable();
+
   void writeAdcircMesh(const std::string &filename);
   void write2dmMesh(const std::string &filename);
   void writeDflowMesh(const std::string &filename);
@@ -223,13 +238,22 @@ class MeshPrivate {
 
   size_t getMaxNodesPerElement();
   void buildNodeLookupTable();
+  void buildElementLookupTable();
 
   void generateHash(bool force = false);
 
   void writePrjFile(const std::string &outputFile) const;
 
-  std::unordered_map<size_t, size_t> m_nodeLookup;
-  std::unordered_map<size_t, size_t> m_elementLookup;
+  Adcirc::FileIO::FeatureTable nodeFeatures() const;
+  Adcirc::FileIO::FeatureTable elementFeatures() const;
+  Adcirc::FileIO::FeatureTable connectivityFeatures();
+  Adcirc::FileIO::FeatureTable boundaryFeatures() const;
+  void writeFeatures(const std::string &outputFile,
+                     const Adcirc::FileIO::FeatureTable &table,
+                     const std::string &layerName) const;
+
+  Adcirc::Private::IdIndex m_nodeLookup;
+  Adcirc::Private::IdIndex m_elementLookup;
 
   Adcirc::Cryptography::HashType m_hashType;
 
@@ -250,27 +274,49 @@ class MeshPrivate {
   std::unique_ptr<Kdtree> m_nodalSearchTree;
   std::unique_ptr<Kdtree> m_elementalSearchTree;
 
-  std::vector<float> getRasterValues(
-      const std::vector<double> &z, double nullvalue,
-      const std::vector<size_t> &elements,
-      const std::vector<std::vector<double>> &weights,
-      bool partialWetting = false);
-
-  std::pair<std::vector<std::vector<double>>, std::vector<size_t>>
-  computeRasterInterpolationWeights(const std::vector<double> &extent,
-                                    size_t nx, size_t ny, double resolution);
+  /**
+   * @brief Running statistics of the valid pixels written to a raster
+   */
+  struct RasterStatistics {
+    size_t count = 0;
+    double sum = 0.0;
+    double sumSquared = 0.0;
+    double minimum = std::numeric_limits<double>::max();
+    double maximum = -std::numeric_limits<double>::max();
+
+    void add(double v) {
+      count++;
+      sum += v;
+      sumSquared += v * v;
+      minimum = std::min(minimum, v);
+      maximum = std::max(maximum, v);
+    }
+
+    void merge(const RasterStatistics &s) {
+      count += s.count;
+      sum += s.sum;
+      sumSquared += s.sumSquared;
+      minimum = std::min(minimum, s.minimum);
+      maximum = std::max(maximum, s.maximum);
+    }
+  };
+
+  size_t searchElement(double x, double y) const;
+
+  void rasterizeBlock(const std::vector<double> &z, double nullvalue,
+                      bool partialWetting, double xmin, double ymax,
+                      double resolution, size_t i0, size_t j0, size_t ni,
+                      size_t nj, float *buffer, RasterStatistics &stats);
 
   static std::pair<double, double> pixelToCoordinate(size_t i, size_t j,
                                                      double resolution,
                                                      double xmin, double ymax);
 
   static float calculateValueWithoutPartialWetting(
-      double v1, double v2, double v3, double nullvalue,
-      const std::vector<double> &weight);
+      double v1, double v2, double v3, double nullvalue, const double *weight);
 
   static float calculateValueWithPartialWetting(
-      double v1, const double v2, double v3, double nullvalue,
-      const std::vector<double> &weight);
+      double v1, double v2, double v3, double nullvalue, const double *weight);
 };
 }  // namespace Private
 }  // namespace Adcirc
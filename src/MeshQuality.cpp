@@ -0,0 +1,278 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "MeshQuality.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Constants.h"
+#include "Logging.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Adcirc::Utility;
+using namespace Adcirc::Geometry;
+
+namespace {
+
+/**
+ * @brief Number of threads to use for a pass
+ * @param requested requested number of threads. Values less than one use the
+ * current OpenMP setting
+ * @return number of threads
+ */
+int threadCount(int requested) {
+  if (requested > 0) return requested;
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor
+ * @param[in] mesh mesh to evaluate
+ */
+MeshQuality::MeshQuality(Mesh *mesh) : m_mesh(mesh), m_computed(false) {}
+
+/**
+ * @brief Computes all quality metrics
+ * @param[in] numThreads number of threads to use. If 0, the current OpenMP
+ * setting is used
+ */
+void MeshQuality::compute(int numThreads) {
+  if (m_mesh == nullptr) {
+    adcircmodules_throw_exception("MeshQuality: No mesh defined");
+  }
+
+  Topology *t = m_mesh->topology();
+  if (!t->nodeTable()->initialized()) t->nodeTable()->build();
+  if (!t->elementTable()->initialized()) t->elementTable()->build();
+  if (!t->faceTable()->initialized()) t->faceTable()->build();
+
+  const int nt = threadCount(numThreads);
+  this->computeElementMetrics(nt);
+  this->computeOrthogonality(nt);
+  this->computeNodeMetrics(nt);
+
+  //...Element centers are only needed for the orthogonality
+  m_xc.clear();
+  m_xc.shrink_to_fit();
+  m_yc.clear();
+  m_yc.shrink_to_fit();
+
+  m_computed = true;
+}
+
+/**
+ * @brief Returns true if the metrics have been computed
+ * @return true if computed
+ */
+bool MeshQuality::computed() const { return m_computed; }
+
+void MeshQuality::computeElementMetrics(int numThreads) {
+  const size_t ne = m_mesh->numElements();
+  m_area.resize(ne);
+  m_minAngle.resize(ne);
+  m_maxAngle.resize(ne);
+  m_aspectRatio.resize(ne);
+  m_skewness.resize(ne);
+  m_elementSize.resize(ne);
+  m_xc.resize(ne);
+  m_yc.resize(ne);
+
+#pragma omp parallel for num_threads(numThreads) schedule(static)
+  for (size_t i = 0; i < ne; ++i) {
+    const Element *e = m_mesh->element(i);
+    const size_t n = e->n();
+
+    double x[4], y[4], len[4];
+    for (size_t k = 0; k < n; ++k) {
+      x[k] = e->node(k)->x();
+      y[k] = e->node(k)->y();
+    }
+
+    double a2 = 0.0, cx = 0.0, cy = 0.0, xm = 0.0, ym = 0.0;
+    double lmin = std::numeric_limits<double>::max(), lmax = 0.0, lsum = 0.0;
+    for (size_t k = 0; k < n; ++k) {
+      const size_t k1 = (k + 1) % n;
+      const double cross = x[k] * y[k1] - x[k1] * y[k];
+      a2 += cross;
+      cx += (x[k] + x[k1]) * cross;
+      cy += (y[k] + y[k1]) * cross;
+      xm += x[k];
+      ym += y[k];
+      len[k] = std::hypot(x[k1] - x[k], y[k1] - y[k]);
+      lmin = std::min(lmin, len[k]);
+      lmax = std::max(lmax, len[k]);
+      lsum += len[k];
+    }
+
+    double amin = 180.0, amax = 0.0;
+    for (size_t k = 0; k < n; ++k) {
+      const size_t kp = (k + n - 1) % n;
+      const size_t kn = (k + 1) % n;
+      const double denom = len[kp] * len[k];
+      double angle = 0.0;
+      if (denom > 0.0) {
+        const double dot = (x[kp] - x[k]) * (x[kn] - x[k]) +
+                           (y[kp] - y[k]) * (y[kn] - y[k]);
+        angle = Constants::toDegrees(
+            std::acos(std::max(-1.0, std::min(1.0, dot / denom))));
+      }
+      amin = std::min(amin, angle);
+      amax = std::max(amax, angle);
+    }
+
+    const double ideal = 180.0 * static_cast<double>(n - 2) / n;
+
+    m_area[i] = 0.5 * std::abs(a2);
+    m_minAngle[i] = amin;
+    m_maxAngle[i] = amax;
+    m_aspectRatio[i] =
+        lmin > 0.0 ? lmax / lmin : std::numeric_limits<double>::infinity();
+    m_skewness[i] =
+        std::max((amax - ideal) / (180.0 - ideal), (ideal - amin) / ideal);
+    m_elementSize[i] = lsum / n;
+
+    if (a2 != 0.0) {
+      m_xc[i] = cx / (3.0 * a2);
+      m_yc[i] = cy / (3.0 * a2);
+    } else {
+      m_xc[i] = xm / n;
+      m_yc[i] = ym / n;
+    }
+  }
+}
+
+void MeshQuality::computeOrthogonality(int numThreads) {
+  const size_t ne = m_mesh->numElements();
+  const FaceTable *faces = m_mesh->topology()->faceTable();
+  m_orthogonality.resize(ne);
+
+#pragma omp parallel for num_threads(numThreads) schedule(static)
+  for (size_t i = 0; i < ne; ++i) {
+    const auto neighbors = faces->neighborIndices(i);
+    double o = 0.0;
+    for (size_t k = 0; k < neighbors.size(); ++k) {
+      const auto f = faces->sharedFace(i, k);
+      const size_t j = neighbors[k];
+      const double dx1 = f.second->x() - f.first->x();
+      const double dy1 = f.second->y() - f.first->y();
+      const double dx2 = m_xc[j] - m_xc[i];
+      const double dy2 = m_yc[j] - m_yc[i];
+      const double r = std::sqrt((dx1 * dx1 + dy1 * dy1) *
+                                 (dx2 * dx2 + dy2 * dy2));
+      if (r > 0.0) {
+        o = std::max(o, std::min(1.0, std::abs(dx1 * dx2 + dy1 * dy2) / r));
+      }
+    }
+    m_orthogonality[i] = o;
+  }
+}
+
+void MeshQuality::computeNodeMetrics(int numThreads) {
+  const size_t nn = m_mesh->numNodes();
+  const ElementTable *elements = m_mesh->topology()->elementTable();
+  const NodeTable *nodes = m_mesh->topology()->nodeTable();
+  m_meshSize.resize(nn);
+  m_valence.resize(nn);
+
+#pragma omp parallel for num_threads(numThreads) schedule(static)
+  for (size_t i = 0; i < nn; ++i) {
+    const auto list = elements->elementIndices(i);
+    double s = 0.0;
+    for (const auto e : list) {
+      s += m_elementSize[e];
+    }
+    m_meshSize[i] = list.empty() ? 0.0 : s / list.size();
+    m_valence[i] = static_cast<uint32_t>(nodes->nodeIndices(i).size());
+  }
+}
+
+/**
+ * @brief Element areas
+ * @return vector of areas, indexed by element
+ */
+const std::vector<double> &MeshQuality::area() const { return m_area; }
+
+/**
+ * @brief Smallest interior angle of each element, in degrees
+ * @return vector of angles, indexed by element
+ */
+const std::vector<double> &MeshQuality::minAngle() const { return m_minAngle; }
+
+/**
+ * @brief Largest interior angle of each element, in degrees
+ * @return vector of angles, indexed by element
+ */
+const std::vector<double> &MeshQuality::maxAngle() const { return m_maxAngle; }
+
+/**
+ * @brief Ratio of the longest to the shortest edge of each element
+ * @return vector of aspect ratios, indexed by element
+ */
+const std::vector<double> &MeshQuality::aspectRatio() const {
+  return m_aspectRatio;
+}
+
+/**
+ * @brief Equiangle skewness of each element. 0 is an equilateral triangle or
+ * a square and 1 is a degenerate element
+ * @return vector of skewness values, indexed by element
+ */
+const std::vector<double> &MeshQuality::skewness() const { return m_skewness; }
+
+/**
+ * @brief Worst face orthogonality of each element, measured as the cosine of
+ * the angle between a shared face and the line joining the element centers.
+ * 0 is perfectly orthogonal
+ * @return vector of orthogonality values, indexed by element
+ */
+const std::vector<double> &MeshQuality::orthogonality() const {
+  return m_orthogonality;
+}
+
+/**
+ * @brief Average edge length of each element
+ * @return vector of element sizes, indexed by element
+ */
+const std::vector<double> &MeshQuality::elementSize() const {
+  return m_elementSize;
+}
+
+/**
+ * @brief Average size of the elements around each node
+ * @return vector of mesh sizes, indexed by node
+ */
+const std::vector<double> &MeshQuality::meshSize() const { return m_meshSize; }
+
+/**
+ * @brief Number of nodes connected to each node by an element edge
+ * @return vector of valences, indexed by node
+ */
+const std::vector<uint32_t> &MeshQuality::valence() const {
+  return m_valence;
+}
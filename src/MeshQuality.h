@@ -0,0 +1,93 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MESHQUALITY_H
+#define ADCMOD_MESHQUALITY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "Mesh.h"
+
+namespace Adcirc {
+namespace Utility {
+
+/**
+ * @class MeshQuality
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Computes element and node quality metrics for a mesh
+ *
+ * The element metrics (area, minimum and maximum interior angle, aspect
+ * ratio, equiangle skewness, and mean edge length) are computed together in
+ * one parallel pass over the elements. The face orthogonality of each element
+ * is then gathered from its neighbors in the face table, and the node metrics
+ * (mesh size and valence) are gathered from the element and node tables.
+ * Every pass reads from the compressed topology tables, so no thread writes
+ * to another thread's output and the total work is linear in the mesh size.
+ *
+ * Metrics are computed in the mesh coordinate system. Results are stored as
+ * one array per metric, indexed by element or node position in the mesh.
+ */
+class MeshQuality {
+ public:
+  ADCIRCMODULES_EXPORT explicit MeshQuality(Adcirc::Geometry::Mesh *mesh);
+
+  void ADCIRCMODULES_EXPORT compute(int numThreads = 0);
+
+  bool ADCIRCMODULES_EXPORT computed() const;
+
+  const std::vector<double> ADCIRCMODULES_EXPORT &area() const;
+  const std::vector<double> ADCIRCMODULES_EXPORT &minAngle() const;
+  const std::vector<double> ADCIRCMODULES_EXPORT &maxAngle() const;
+  const std::vector<double> ADCIRCMODULES_EXPORT &aspectRatio() const;
+  const std::vector<double> ADCIRCMODULES_EXPORT &skewness() const;
+  const std::vector<double> ADCIRCMODULES_EXPORT &orthogonality() const;
+  const std::vector<double> ADCIRCMODULES_EXPORT &elementSize() const;
+
+  const std::vector<double> ADCIRCMODULES_EXPORT &meshSize() const;
+  const std::vector<uint32_t> ADCIRCMODULES_EXPORT &valence() const;
+
+ private:
+  void computeElementMetrics(int numThreads);
+  void computeOrthogonality(int numThreads);
+  void computeNodeMetrics(int numThreads);
+
+  Adcirc::Geometry::Mesh *m_mesh;
+  bool m_computed;
+
+  std::vector<double> m_area;
+  std::vector<double> m_minAngle;
+  std::vector<double> m_maxAngle;
+  std::vector<double> m_aspectRatio;
+  std::vector<double> m_skewness;
+  std::vector<double> m_orthogonality;
+  std::vector<double> m_elementSize;
+  std::vector<double> m_xc;
+  std::vector<double> m_yc;
+
+  std::vector<double> m_meshSize;
+  std::vector<uint32_t> m_valence;
+};
+
+}  // namespace Utility
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MESHQUALITY_H
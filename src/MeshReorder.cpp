@@ -0,0 +1,269 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "MeshReorder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <utility>
+
+#include "Logging.h"
+
+using namespace Adcirc::Geometry;
+
+namespace {
+
+/**
+ * @brief Spreads the bits of a 32-bit value into the even bits of a 64-bit
+ * value
+ * @param v value to spread
+ * @return spread value
+ */
+uint64_t spreadBits(uint32_t v) {
+  uint64_t x = v;
+  x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+  x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+  x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  x = (x | (x << 2)) & 0x3333333333333333ULL;
+  x = (x | (x << 1)) & 0x5555555555555555ULL;
+  return x;
+}
+
+}  // namespace
+
+/**
+ * @brief Computes the reverse Cuthill-McKee ordering of a graph
+ * @param[in] adjacency node to node adjacency
+ * @return gather list of the new node order
+ *
+ * Each connected component is started from a pseudo-peripheral node found
+ * with the George-Liu search. Neighbors are visited in order of increasing
+ * degree, with ties broken by position so that the result is deterministic.
+ */
+std::vector<size_t> MeshReorder::reverseCuthillMcKee(
+    const CsrAdjacency &adjacency) {
+  const size_t n = adjacency.numRows();
+
+  auto byDegree = [&](size_t a, size_t b) {
+    const size_t sa = adjacency.size(a);
+    const size_t sb = adjacency.size(b);
+    return sa != sb ? sa < sb : a < b;
+  };
+
+  std::vector<size_t> seeds(n);
+  std::iota(seeds.begin(), seeds.end(), 0);
+  std::sort(seeds.begin(), seeds.end(), byDegree);
+
+  std::vector<size_t> order;
+  order.reserve(n);
+  std::vector<char> visited(n, 0);
+  std::vector<int64_t> level(n, -1);
+  std::vector<size_t> queue;
+
+  for (const auto s : seeds) {
+    if (visited[s]) continue;
+    const size_t root = MeshReorder::peripheralNode(adjacency, s, level, queue);
+    visited[root] = 1;
+    order.push_back(root);
+    for (size_t head = order.size() - 1; head < order.size(); ++head) {
+      const size_t start = order.size();
+      for (const auto u : adjacency.row(order[head])) {
+        if (!visited[u]) {
+          visited[u] = 1;
+          order.push_back(u);
+        }
+      }
+      std::sort(order.begin() + start, order.end(), byDegree);
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+/**
+ * @brief Finds a pseudo-peripheral node in the component containing root
+ * @param[in] adjacency node to node adjacency
+ * @param[in] root starting node
+ * @param[in] level scratch array sized to the number of nodes and filled with
+ * -1. It is returned in the same state
+ * @param[in] queue scratch array used for the breadth first search
+ * @return node index
+ */
+size_t MeshReorder::peripheralNode(const CsrAdjacency &adjacency, size_t root,
+                                   std::vector<int64_t> &level,
+                                   std::vector<size_t> &queue) {
+  size_t current = root;
+  int64_t eccentricity = -1;
+  for (;;) {
+    queue.clear();
+    queue.push_back(current);
+    level[current] = 0;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      const size_t v = queue[head];
+      for (const auto u : adjacency.row(v)) {
+        if (level[u] < 0) {
+          level[u] = level[v] + 1;
+          queue.push_back(u);
+        }
+      }
+    }
+
+    const int64_t depth = level[queue.back()];
+    size_t candidate = queue.back();
+    for (auto it = queue.rbegin(); it != queue.rend() && level[*it] == depth;
+         ++it) {
+      if (adjacency.size(*it) < adjacency.size(candidate)) candidate = *it;
+    }
+
+    for (const auto v : queue) {
+      level[v] = -1;
+    }
+
+    if (depth <= eccentricity) break;
+    eccentricity = depth;
+    current = candidate;
+  }
+  return current;
+}
+
+/**
+ * @brief Orders a set of points along a space filling curve
+ * @param[in] x x-coordinates
+ * @param[in] y y-coordinates
+ * @param[in] strategy ReorderHilbert or ReorderMorton
+ * @return gather list of the new point order
+ */
+std::vector<size_t> MeshReorder::spaceFillingCurve(
+    const std::vector<double> &x, const std::vector<double> &y,
+    ReorderStrategy strategy) {
+  if (x.size() != y.size()) {
+    adcircmodules_throw_exception("MeshReorder: Coordinate size mismatch");
+  }
+  if (strategy != ReorderHilbert && strategy != ReorderMorton) {
+    adcircmodules_throw_exception(
+        "MeshReorder: Invalid space filling curve strategy");
+  }
+
+  const size_t n = x.size();
+  if (n == 0) return std::vector<size_t>();
+
+  const auto xr = std::minmax_element(x.begin(), x.end());
+  const auto yr = std::minmax_element(y.begin(), y.end());
+  const double xmin = *xr.first;
+  const double ymin = *yr.first;
+
+  //...Use the same scale in both directions so the curve cells are square
+  constexpr double gridMax = 4294967295.0;
+  const double range = std::max(*xr.second - xmin, *yr.second - ymin);
+  const double scale = range > 0.0 ? gridMax / range : 0.0;
+
+  std::vector<std::pair<uint64_t, size_t>> keys(n);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; ++i) {
+    const auto ix =
+        static_cast<uint32_t>(std::min(gridMax, (x[i] - xmin) * scale));
+    const auto iy =
+        static_cast<uint32_t>(std::min(gridMax, (y[i] - ymin) * scale));
+    keys[i].first = strategy == ReorderHilbert ? MeshReorder::hilbertKey(ix, iy)
+                                               : MeshReorder::mortonKey(ix, iy);
+    keys[i].second = i;
+  }
+
+  std::sort(keys.begin(), keys.end());
+
+  std::vector<size_t> order(n);
+  for (size_t i = 0; i < n; ++i) {
+    order[i] = keys[i].second;
+  }
+  return order;
+}
+
+/**
+ * @brief Orders elements by an integer key using a stable counting sort
+ * @param[in] elementKey key for each element, typically the smallest new
+ * index of the element's nodes
+ * @param[in] numKeys upper bound of the keys
+ * @return gather list of the new element order
+ */
+std::vector<size_t> MeshReorder::elementOrder(
+    const std::vector<size_t> &elementKey, size_t numKeys) {
+  std::vector<size_t> offset(numKeys + 1, 0);
+  for (const auto k : elementKey) {
+    assert(k < numKeys);
+    offset[k + 1]++;
+  }
+  std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+  std::vector<size_t> order(elementKey.size());
+  for (size_t i = 0; i < elementKey.size(); ++i) {
+    order[offset[elementKey[i]]++] = i;
+  }
+  return order;
+}
+
+/**
+ * @brief Inverts a gather list
+ * @param[in] order gather list, where order[i] is the old position of item i
+ * @return scatter list, where the result at an old position is the new
+ * position
+ */
+std::vector<size_t> MeshReorder::inverse(const std::vector<size_t> &order) {
+  std::vector<size_t> inv(order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    inv[order[i]] = i;
+  }
+  return inv;
+}
+
+/**
+ * @brief Computes the distance along a Hilbert curve covering a 2^32 x 2^32
+ * grid
+ * @param[in] x grid column
+ * @param[in] y grid row
+ * @return distance along the curve
+ */
+uint64_t MeshReorder::hilbertKey(uint32_t x, uint32_t y) {
+  uint64_t d = 0;
+  for (uint32_t s = 1U << 31; s > 0; s >>= 1) {
+    const uint32_t rx = (x & s) ? 1 : 0;
+    const uint32_t ry = (y & s) ? 1 : 0;
+    d += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+    if (ry == 0) {
+      if (rx == 1) {
+        x = ~x;
+        y = ~y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+/**
+ * @brief Computes the position along a Morton (z-order) curve by
+ * interleaving the bits of the grid indices
+ * @param[in] x grid column
+ * @param[in] y grid row
+ * @return position along the curve
+ */
+uint64_t MeshReorder::mortonKey(uint32_t x, uint32_t y) {
+  return spreadBits(x) | (spreadBits(y) << 1);
+}
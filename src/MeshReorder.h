@@ -0,0 +1,80 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_MESHREORDER_H
+#define ADCMOD_MESHREORDER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "CsrAdjacency.h"
+
+namespace Adcirc {
+namespace Geometry {
+
+enum ReorderStrategy {
+  /// Reverse Cuthill-McKee ordering of the node graph
+  ReorderReverseCuthillMcKee = 0x301,
+  /// Order nodes along a Hilbert curve
+  ReorderHilbert = 0x302,
+  /// Order nodes along a Morton (z-order) curve
+  ReorderMorton = 0x303
+};
+
+/**
+ * @class MeshReorder
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Generates node and element orderings that improve memory locality
+ *
+ * All orderings are returned as a gather list, where entry i holds the
+ * previous position of the item that is moved to position i. The reverse
+ * Cuthill-McKee ordering reduces the bandwidth of the node graph, while the
+ * space filling curve orderings keep nodes that are close in space close in
+ * memory without needing the mesh topology.
+ */
+class MeshReorder {
+ public:
+  static std::vector<size_t> ADCIRCMODULES_EXPORT
+  reverseCuthillMcKee(const Adcirc::Geometry::CsrAdjacency &adjacency);
+
+  static std::vector<size_t> ADCIRCMODULES_EXPORT
+  spaceFillingCurve(const std::vector<double> &x, const std::vector<double> &y,
+                    Adcirc::Geometry::ReorderStrategy strategy);
+
+  static std::vector<size_t> ADCIRCMODULES_EXPORT
+  elementOrder(const std::vector<size_t> &elementKey, size_t numKeys);
+
+  static std::vector<size_t> ADCIRCMODULES_EXPORT
+  inverse(const std::vector<size_t> &order);
+
+  static uint64_t ADCIRCMODULES_EXPORT hilbertKey(uint32_t x, uint32_t y);
+  static uint64_t ADCIRCMODULES_EXPORT mortonKey(uint32_t x, uint32_t y);
+
+ private:
+  static size_t peripheralNode(const Adcirc::Geometry::CsrAdjacency &adjacency,
+                               size_t root, std::vector<int64_t> &level,
+                               std::vector<size_t> &queue);
+};
+
+}  // namespace Geometry
+}  // namespace Adcirc
+
+#endif  // ADCMOD_MESHREORDER_H
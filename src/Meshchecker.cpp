@@ -31,7 +31,67 @@ namespace Utility {
 
 using namespace Adcirc::Geometry;
 
-MeshChecker::MeshChecker(Mesh *mesh) : m_mesh(mesh) {}
+MeshChecker::MeshChecker(Mesh *mesh) : m_mesh(mesh), m_numThreads(0) {}
+
+/**
+ * @brief Sets the number of threads used when computing the mesh quality
+ * metrics
+ * @param[in] numThreads number of threads. If 0, the current OpenMP setting is
+ * used
+ */
+void MeshChecker::setNumThreads(int numThreads) {
+  if (numThreads != this->m_numThreads) this->m_quality.reset();
+  this->m_numThreads = numThreads;
+}
+
+/**
+ * @brief Returns the number of threads used when computing the mesh quality
+ * metrics
+ * @return number of threads
+ */
+int MeshChecker::numThreads() const { return this->m_numThreads; }
+
+/**
+ * @brief Returns the mesh quality metrics, computing them in a single pass
+ * the first time they are requested
+ * @return pointer to the mesh quality object
+ */
+const MeshQuality *MeshChecker::quality() {
+  if (!this->m_quality) {
+    this->m_quality = std::make_unique<MeshQuality>(this->m_mesh);
+    this->m_quality->compute(this->m_numThreads);
+  }
+  return this->m_quality.get();
+}
+
+/**
+ * @brief Checks that the interior angles of every element fall within a range
+ * @param[in] minimumAngle smallest allowable interior angle, in degrees
+ * @param[in] maximumAngle largest allowable interior angle, in degrees
+ * @return true if all elements pass
+ */
+bool MeshChecker::checkElementQuality(double minimumAngle,
+                                      double maximumAngle) {
+  const MeshQuality *q = this->quality();
+  bool passed = true;
+  for (size_t i = 0; i < this->m_mesh->numElements(); ++i) {
+    if (q->minAngle()[i] < minimumAngle) {
+      passed = false;
+      printf(
+          "[Mesh Error] MeshChecker::checkElementQuality --> Element %zd has "
+          "minimum angle %6.2f, which is less than %6.2f\n",
+          this->m_mesh->element(i)->id(), q->minAngle()[i], minimumAngle);
+    }
+    if (q->maxAngle()[i] > maximumAngle) {
+      passed = false;
+      printf(
+          "[Mesh Error] MeshChecker::checkElementQuality --> Element %zd has "
+          "maximum angle %6.2f, which is greater than %6.2f\n",
+          this->m_mesh->element(i)->id(), q->maxAngle()[i], maximumAngle);
+    }
+  }
+  return passed;
+}
 
 bool MeshChecker::checkMesh(bool ignoreNonfatal) {
   bool passed = true;
@@ -183,27 +243,29 @@ void MeshChecker::printFailedLeveeStatus(
 
 bool MeshChecker::checkOverlappingElements(Mesh *mesh) {
   std::vector<Element *> overlappingList;
-  mesh->topology()->elementTable()->build();
+  ElementTable *table = mesh->topology()->elementTable();
+  table->build();
 
   for (size_t i = 0; i < mesh->numElements(); ++i) {
     for (size_t j = 0; j < mesh->element(i)->n(); ++j) {
-      int count = 0;
-
       std::pair<Node *, Node *> p = mesh->element(i)->elementLeg(j);
-      Node *n1 = p.first;
-      Node *n2 = p.second;
-
-      auto list = mesh->topology()->elementTable()->elementList(n1);
-
-      for (size_t i1 = 0; i1 < list.size(); ++i1) {
-        Element *m1 = list.at(i1);
-        auto list2 = mesh->topology()->elementTable()->elementList(n2);
-        for (size_t i2 = 0; i2 < list2.size(); ++i2) {
-          Element *m2 = list2.at(i2);
-          if (m1->id() == m2->id()) {
-            count++;
-            break;
-          }
+
+      //...Both lists are sorted, so the shared elements are counted with a
+      // single merge pass
+      const auto list1 = table->elementIndices(p.first);
+      const auto list2 = table->elementIndices(p.second);
+      auto i1 = list1.begin();
+      auto i2 = list2.begin();
+      int count = 0;
+      while (i1 != list1.end() && i2 != list2.end()) {
+        if (*i1 < *i2) {
+          ++i1;
+        } else if (*i2 < *i1) {
+          ++i2;
+        } else {
+          count++;
+          ++i1;
+          ++i2;
         }
       }
       if (count > 2) overlappingList.push_back(mesh->element(i));
@@ -326,39 +388,34 @@ bool MeshChecker::checkMissingBoundaryConditions(Mesh *mesh,
   bool writeLog = false;
   std::ofstream log;
   std::vector<Adcirc::Geometry::Node *> boundaryNodes = mesh->boundaryNodes();
-  std::vector<bool> found(boundaryNodes.size());
-  std::fill(found.begin(), found.end(), false);
+
+  //...Flag the nodes with a boundary condition by mesh index so that each
+  // boundary node can be checked in constant time
+  std::vector<bool> hasBoundary(mesh->numNodes(), false);
+  auto flag = [&](const Adcirc::Geometry::Node *n) {
+    hasBoundary[mesh->nodeIndexById(n->id())] = true;
+  };
 
   for (size_t i = 0; i < mesh->numOpenBoundaries(); ++i) {
     for (size_t j = 0; j < mesh->openBoundary(i)->length(); ++j) {
-      auto it = std::find(boundaryNodes.begin(), boundaryNodes.end(),
-                          mesh->openBoundary(i)->node1(j));
-      if (it != boundaryNodes.end()) {
-        size_t d = std::distance(boundaryNodes.begin(), it);
-        found[d] = true;
-      }
+      flag(mesh->openBoundary(i)->node1(j));
     }
   }
 
   for (size_t i = 0; i < mesh->numLandBoundaries(); ++i) {
     for (size_t j = 0; j < mesh->landBoundary(i)->length(); ++j) {
-      auto it = std::find(boundaryNodes.begin(), boundaryNodes.end(),
-                          mesh->landBoundary(i)->node1(j));
-      if (it != boundaryNodes.end()) {
-        size_t d = std::distance(boundaryNodes.begin(), it);
-        found[d] = true;
-      }
+      flag(mesh->landBoundary(i)->node1(j));
       if (mesh->landBoundary(i)->isInternalWeir()) {
-        auto it2 = std::find(boundaryNodes.begin(), boundaryNodes.end(),
-                             mesh->landBoundary(i)->node2(j));
-        if (it2 != boundaryNodes.end()) {
-          size_t d = std::distance(boundaryNodes.begin(), it2);
-          found[d] = true;
-        }
+        flag(mesh->landBoundary(i)->node2(j));
       }
     }
   }
 
+  std::vector<bool> found(boundaryNodes.size());
+  for (size_t i = 0; i < boundaryNodes.size(); ++i) {
+    found[i] = hasBoundary[mesh->nodeIndexById(boundaryNodes[i]->id())];
+  }
+
   if (logFile != "none") {
     writeLog = true;
     log.open(logFile);
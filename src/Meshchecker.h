@@ -19,8 +19,11 @@
 #ifndef ADCMOD_MESHCHECKER_H
 #define ADCMOD_MESHCHECKER_H
 
+#include <memory>
+
 #include "AdcircModules_Global.h"
 #include "Mesh.h"
+#include "MeshQuality.h"
 
 namespace Adcirc {
 
@@ -32,6 +35,14 @@ class MeshChecker {
 
   bool ADCIRCMODULES_EXPORT checkMesh(bool ignoreNonfatal = true);
 
+  void ADCIRCMODULES_EXPORT setNumThreads(int numThreads);
+  int ADCIRCMODULES_EXPORT numThreads() const;
+
+  const MeshQuality ADCIRCMODULES_EXPORT *quality();
+
+  bool ADCIRCMODULES_EXPORT checkElementQuality(double minimumAngle,
+                                                double maximumAngle);
+
   static bool ADCIRCMODULES_EXPORT checkLeveeHeights(
       Adcirc::Geometry::Mesh *mesh, double minimumCrestElevationOverTopography);
   static bool ADCIRCMODULES_EXPORT
@@ -53,6 +64,8 @@ class MeshChecker {
 
  private:
   Adcirc::Geometry::Mesh *m_mesh;
+  int m_numThreads;
+  std::unique_ptr<MeshQuality> m_quality;
 
   static void printFailedLeveeStatus(
       Adcirc::Geometry::Boundary *bc, size_t index,
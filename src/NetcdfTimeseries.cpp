@@ -20,6 +20,7 @@
 
 #include <cstring>
 #include <memory>
+#include <utility>
 
 #include "CDate.h"
 #include "FileIO.h"
@@ -37,6 +38,7 @@ using namespace Adcirc::Output;
 NetcdfTimeseries::NetcdfTimeseries() {
   this->m_filename = std::string();
   this->m_epsg = 4326;
+  this->m_dimension = 1;
   this->m_units = "unknown";
   this->m_verticalDatum = "unknown";
   this->m_horizontalProjection = "WGS84";
@@ -54,6 +56,21 @@ int NetcdfTimeseries::epsg() const { return this->m_epsg; }
 
 void NetcdfTimeseries::setEpsg(int epsg) { this->m_epsg = epsg; }
 
+size_t NetcdfTimeseries::dimension() const { return this->m_dimension; }
+
+/**
+ * @brief Sets the number of data components to read
+ * @param dimension 1 for scalar data, 2 for vector data
+ *
+ * Vector data can only be read from the CF discrete sampling geometry layout
+ */
+void NetcdfTimeseries::setDimension(size_t dimension) {
+  if (dimension != 1 && dimension != 2) {
+    adcircmodules_throw_exception("Invalid netCDF time series dimension");
+  }
+  this->m_dimension = dimension;
+}
+
 int NetcdfTimeseries::read(bool stationsOnly = false) {
   if (this->m_filename == std::string()) return 1;
 
@@ -94,13 +111,29 @@ int NetcdfTimeseries::read(bool stationsOnly = false) {
 
   for (size_t i = 0; i < this->m_numStations; i++) {
     std::string s = stationName.substr(200 * i, 200);
-    s.erase(s.find_last_not_of("\t\n\v\f\r ") + 1);
+    s.erase(s.find_last_not_of(std::string("\t\n\v\f\r \0", 7)) + 1);
     this->m_stationName.push_back(s);
   }
 
   if (!stationsOnly) {
     this->m_time.resize(this->m_numStations);
     this->m_data.resize(this->m_numStations);
+    if (this->m_dimension == 2) this->m_dataV.resize(this->m_numStations);
+  }
+
+  //...Files written with the CF discrete sampling geometry layout hold all
+  // stations in a single set of variables
+  int varid_rowSize, dimid_time;
+  if (nc_inq_varid(ncid, "row_size", &varid_rowSize) == NC_NOERR) {
+    return this->readDsg(ncid, false, stationsOnly);
+  } else if (nc_inq_dimid(ncid, "time", &dimid_time) == NC_NOERR) {
+    return this->readDsg(ncid, true, stationsOnly);
+  }
+
+  if (this->m_dimension > 1) {
+    nc_close(ncid);
+    adcircmodules_throw_exception(
+        "generic netcdf format files cannot contain vector data.");
   }
 
   for (size_t i = 0; i < this->m_numStations; i++) {
@@ -154,14 +187,118 @@ int NetcdfTimeseries::read(bool stationsOnly = false) {
       NCCHECK(nc_get_var_double(ncid, varid_data, varData.data()))
       NCCHECK(nc_get_var_longlong(ncid, varid_time, timeData.data()))
 
-      this->m_data[i].resize(length);
+      const long long reference = reftime.toSeconds();
       this->m_time[i].resize(length);
-
       for (size_t j = 0; j < length; j++) {
-        this->m_data[i][j] = varData[j];
-        CDate t = reftime;
-        t += static_cast<long>(timeData[j]);
-        this->m_time[i][j] = t;
+        this->m_time[i][j] = (reference + timeData[j]) * 1000;
+      }
+      this->m_data[i] = std::move(varData);
+    }
+  }
+
+  NCCHECK(nc_close(ncid))
+
+  this->m_hasData = !stationsOnly;
+  return 0;
+}
+
+/**
+ * @brief Reads the station data from a file written with the CF discrete
+ * sampling geometry layout
+ * @param ncid netCDF file id. The file is closed before returning
+ * @param orthogonal true if the data is an orthogonal [station, time] array,
+ * false if it is a contiguous ragged array
+ * @param stationsOnly only read the station locations
+ * @return 0 on success, otherwise the netCDF error code
+ */
+int NetcdfTimeseries::readDsg(int ncid, bool orthogonal, bool stationsOnly) {
+  const size_t ns = this->m_numStations;
+  const bool isVector = this->m_dimension == 2;
+  int dimid_sample, varid_time, varid_data, varid_dataV = -1;
+  size_t nsample;
+
+  NCCHECK(nc_inq_dimid(ncid, orthogonal ? "time" : "obs", &dimid_sample))
+  NCCHECK(nc_inq_dimlen(ncid, dimid_sample, &nsample))
+  NCCHECK(nc_inq_varid(ncid, "time", &varid_time))
+
+  const bool fileIsVector =
+      nc_inq_varid(ncid, "data_u", &varid_data) == NC_NOERR;
+  if (fileIsVector != isVector) {
+    nc_close(ncid);
+    adcircmodules_throw_exception(
+        fileIsVector
+            ? "netCDF file contains vector data but scalar data was requested"
+            : "netCDF file contains scalar data but vector data was "
+              "requested");
+  }
+  if (isVector) {
+    NCCHECK(nc_inq_varid(ncid, "data_v", &varid_dataV))
+  } else {
+    NCCHECK(nc_inq_varid(ncid, "data", &varid_data))
+  }
+
+  double fillValue;
+  NCCHECK(nc_inq_var_fill(ncid, varid_data, NULL, &fillValue))
+  if (fillValue == NC_FILL_DOUBLE) fillValue = -99999.0;
+  this->m_fillValue.assign(ns, fillValue);
+
+  std::vector<size_t> offset(ns + 1, 0);
+  if (orthogonal) {
+    for (size_t i = 0; i < ns; ++i) {
+      offset[i + 1] = offset[i] + nsample;
+    }
+  } else {
+    int varid_rowSize;
+    std::vector<long long> rowSize(ns);
+    NCCHECK(nc_inq_varid(ncid, "row_size", &varid_rowSize))
+    if (ns > 0) {
+      NCCHECK(nc_get_var_longlong(ncid, varid_rowSize, rowSize.data()))
+    }
+    for (size_t i = 0; i < ns; ++i) {
+      offset[i + 1] = offset[i] + static_cast<size_t>(rowSize[i]);
+    }
+    if (offset[ns] != nsample) {
+      nc_close(ncid);
+      return NC_EINVALCOORDS;
+    }
+  }
+
+  for (size_t i = 0; i < ns; ++i) {
+    this->m_stationLength.push_back(offset[i + 1] - offset[i]);
+  }
+
+  if (!stationsOnly) {
+    long long reference, scale;
+    NCCHECK(this->readTimeUnits(ncid, varid_time, reference, scale))
+
+    std::vector<long long> time(nsample);
+    std::vector<double> data(offset[ns]);
+    std::vector<double> dataV(isVector ? offset[ns] : 0);
+    if (nsample > 0) {
+      NCCHECK(nc_get_var_longlong(ncid, varid_time, time.data()))
+    }
+    if (!data.empty()) {
+      NCCHECK(nc_get_var_double(ncid, varid_data, data.data()))
+      if (isVector) {
+        NCCHECK(nc_get_var_double(ncid, varid_dataV, dataV.data()))
+      }
+    }
+    for (auto &t : time) {
+      t = reference + t * scale;
+    }
+
+    for (size_t i = 0; i < ns; ++i) {
+      if (orthogonal) {
+        this->m_time[i] = time;
+      } else {
+        this->m_time[i].assign(time.begin() + offset[i],
+                               time.begin() + offset[i + 1]);
+      }
+      this->m_data[i].assign(data.begin() + offset[i],
+                             data.begin() + offset[i + 1]);
+      if (isVector) {
+        this->m_dataV[i].assign(dataV.begin() + offset[i],
+                                dataV.begin() + offset[i + 1]);
       }
     }
   }
@@ -172,6 +309,48 @@ int NetcdfTimeseries::read(bool stationsOnly = false) {
   return 0;
 }
 
+/**
+ * @brief Reads the CF units of a time variable
+ * @param ncid netCDF file id
+ * @param varid time variable id
+ * @param reference reference time in milliseconds since 1970-01-01 00:00:00
+ * @param scale number of milliseconds in one unit of the variable
+ * @return 0 on success, otherwise the netCDF error code
+ */
+int NetcdfTimeseries::readTimeUnits(int ncid, int varid, long long &reference,
+                                    long long &scale) {
+  size_t length;
+  int ierr = nc_inq_attlen(ncid, varid, "units", &length);
+  if (ierr != NC_NOERR) return ierr;
+  std::string units(length, ' ');
+  ierr = nc_get_att_text(ncid, varid, "units", &units[0]);
+  if (ierr != NC_NOERR) return ierr;
+
+  const std::string since = " since ";
+  size_t pos = units.find(since);
+  if (pos == std::string::npos || units.size() < pos + since.size() + 19) {
+    return NC_EINVAL;
+  }
+
+  std::string unit = units.substr(0, pos);
+  if (unit == "milliseconds") {
+    scale = 1;
+  } else if (unit == "seconds") {
+    scale = 1000;
+  } else if (unit == "minutes") {
+    scale = 60000;
+  } else if (unit == "hours") {
+    scale = 3600000;
+  } else {
+    return NC_EINVAL;
+  }
+
+  CDate reftime;
+  reftime.fromString(units.substr(pos + since.size(), 19));
+  reference = static_cast<long long>(reftime.toSeconds()) * 1000;
+  return NC_NOERR;
+}
+
 int NetcdfTimeseries::toHmdf(Hmdf *hmdf) {
   hmdf->setDatum("unknown");
   hmdf->setHeader1("none");
@@ -180,10 +359,14 @@ int NetcdfTimeseries::toHmdf(Hmdf *hmdf) {
   hmdf->setSuccess(false);
 
   for (size_t i = 0; i < this->m_numStations; i++) {
-    HmdfStation station;
+    HmdfStation station(this->m_dimension);
     if (this->m_hasData) {
-      station.setDate(this->m_time[i]);
-      station.setData(this->m_data[i]);
+      if (this->m_dimension == 2) {
+        station.setTimeseries(this->m_time[i], this->m_data[i],
+                              this->m_dataV[i]);
+      } else {
+        station.setTimeseries(this->m_time[i], this->m_data[i]);
+      }
     }
     station.setLatitude(this->m_ycoor[i]);
     station.setLongitude(this->m_xcoor[i]);
@@ -44,14 +44,22 @@ class NetcdfTimeseries {
   int epsg() const;
   void setEpsg(int epsg);
 
+  size_t dimension() const;
+  void setDimension(size_t dimension);
+
   static int getEpsg(const std::string &file);
 
  private:
+  int readDsg(int ncid, bool orthogonal, bool stationsOnly);
+  static int readTimeUnits(int ncid, int varid, long long &reference,
+                           long long &scale);
+
   std::string m_filename;
   std::string m_units;
   std::string m_verticalDatum;
   std::string m_horizontalProjection;
   int m_epsg;
+  size_t m_dimension;
   bool m_hasData;
   size_t m_numStations;
 
@@ -60,8 +68,9 @@ class NetcdfTimeseries {
   std::vector<double> m_ycoor;
   std::vector<size_t> m_stationLength;
   std::vector<std::string> m_stationName;
-  std::vector<std::vector<CDate> > m_time;
+  std::vector<std::vector<long long> > m_time;
   std::vector<std::vector<double> > m_data;
+  std::vector<std::vector<double> > m_dataV;
 };
 }  // namespace Output
 }  // namespace Adcirc
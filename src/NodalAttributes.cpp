@@ -150,7 +150,13 @@ void NodalAttributes::setNumNodes(size_t numNodes) {
  * @brief Returns a pointer to the nodal attribute object for a specified node
  * @param[in] parameter index where the parameter is located
  * @param[in] node node to return the data for
- * @return NodalAttributes object
+ * @return Attribute object
+ *
+ * The object is a proxy into the attribute storage, so changes made through
+ * it are kept. The pointer remains valid until the file is read again, an
+ * attribute is added or the nodes are permuted. The function may be called
+ * from several threads, but each new proxy is created under a lock, so use
+ * column() for bulk access.
  */
 Adcirc::ModelParameters::Attribute *NodalAttributes::attribute(size_t parameter,
                                                                size_t node) {
@@ -162,12 +168,38 @@ Adcirc::ModelParameters::Attribute *NodalAttributes::attribute(size_t parameter,
  * @param[in] name name of the nodal parameter to return data for
  * @param[in] node node to return the data for
  * @return Attribute object
+ *
+ * The object is a proxy into the attribute storage, so changes made through
+ * it are kept. The pointer remains valid until the file is read again, an
+ * attribute is added or the nodes are permuted. The function may be called
+ * from several threads, but each new proxy is created under a lock, so use
+ * column() for bulk access.
  */
 Adcirc::ModelParameters::Attribute *NodalAttributes::attribute(
     const std::string &name, size_t node) {
   return this->m_impl->attribute(name, node);
 }
 
+/**
+ * @brief Returns the storage for all nodes of a nodal parameter
+ * @param[in] parameter index where the parameter is located
+ * @return AttributeColumn object
+ */
+Adcirc::ModelParameters::AttributeColumn *NodalAttributes::column(
+    size_t parameter) {
+  return this->m_impl->column(parameter);
+}
+
+/**
+ * @brief Returns the storage for all nodes of a nodal parameter
+ * @param[in] name name of the nodal parameter
+ * @return AttributeColumn object
+ */
+Adcirc::ModelParameters::AttributeColumn *NodalAttributes::column(
+    const std::string &name) {
+  return this->m_impl->column(name);
+}
+
 /**
  * @brief Returns the nodal attribute metadata for the given index
  * @param[in] parameter index for the parameter to return
@@ -198,5 +230,14 @@ void NodalAttributes::addAttribute(AttributeMetadata &metadata,
   this->m_impl->addAttribute(metadata, data);
 }
 
+/**
+ * @brief Reorders the nodal values to follow a reordered mesh
+ * @param[in] order gather list returned by Mesh::reorder, where entry i is the
+ * previous position of the node now at position i
+ */
+void NodalAttributes::permute(const std::vector<size_t> &order) {
+  this->m_impl->permute(order);
+}
+
 }  // namespace ModelParameters
 }  // namespace Adcirc
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "AdcircModules_Global.h"
+#include "AttributeColumn.h"
 #include "AttributeMetadata.h"
 #include "Mesh.h"
 
@@ -64,6 +65,11 @@ class NodalAttributes {
   Adcirc::ModelParameters::Attribute ADCIRCMODULES_EXPORT *attribute(
       const std::string &name, size_t node);
 
+  Adcirc::ModelParameters::AttributeColumn ADCIRCMODULES_EXPORT *column(
+      size_t parameter);
+  Adcirc::ModelParameters::AttributeColumn ADCIRCMODULES_EXPORT *column(
+      const std::string &name);
+
   Adcirc::ModelParameters::AttributeMetadata ADCIRCMODULES_EXPORT *metadata(
       size_t parameter);
   Adcirc::ModelParameters::AttributeMetadata ADCIRCMODULES_EXPORT *metadata(
@@ -73,6 +79,8 @@ class NodalAttributes {
   addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
                std::vector<Adcirc::ModelParameters::Attribute> &data);
 
+  void ADCIRCMODULES_EXPORT permute(const std::vector<size_t> &order);
+
  private:
   std::unique_ptr<Adcirc::Private::NodalAttributesPrivate> m_impl;
 };
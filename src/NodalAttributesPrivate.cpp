@@ -20,21 +20,94 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <utility>
 
 #include "Attribute.h"
 #include "DefaultValues.h"
 #include "FileIO.h"
+#include "IdIndex.h"
 #include "Logging.h"
 #include "NodalAttributes.h"
 #include "StringConversion.h"
 #include "boost/format.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Adcirc::ModelParameters;
 using namespace Adcirc::Private;
 
+namespace {
+
+/// Number of lines decoded or formatted together by one thread
+constexpr size_t c_chunkSize = 16384;
+
+/**
+ * @brief Returns the position following the end of the current line
+ * @param[in] p position in the current line
+ * @param[in] end end of the buffer
+ * @return start of the next line, or end
+ */
+const char *nextLine(const char *p, const char *end) {
+  const void *nl = std::memchr(p, '\n', static_cast<size_t>(end - p));
+  return nl == nullptr ? end : static_cast<const char *>(nl) + 1;
+}
+
+/**
+ * @brief Parses a line in the format node, value_1, ..., value_n
+ * @param[in] begin start of the line
+ * @param[in] end end of the line
+ * @param[in] nValues number of values expected
+ * @param[out] node node id
+ * @param[out] values array of nValues values
+ * @return true if the node and all values were found on the line
+ *
+ * strtod and strtoull skip leading whitespace, including newlines, so each
+ * token is checked to end before the end of the line.
+ */
+bool parseAttributeLine(const char *begin, const char *end, size_t nValues,
+                        size_t &node, double *values) {
+  char *next = nullptr;
+  node = std::strtoull(begin, &next, 10);
+  if (next == begin || next > end) return false;
+  for (size_t k = 0; k < nValues; ++k) {
+    const char *p = next;
+    values[k] = std::strtod(p, &next);
+    if (next == p || next > end) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Appends one formatted attribute line to a buffer
+ * @param[in] id node id
+ * @param[in] values array of values
+ * @param[in] nValues number of values
+ * @param[inout] buffer output buffer
+ *
+ * The format matches Attribute::write
+ */
+void formatAttributeLine(size_t id, const double *values, size_t nValues,
+                         std::string &buffer) {
+  char field[64];
+  int n = std::snprintf(field, sizeof(field), "%11zu  ", id);
+  buffer.append(field, static_cast<size_t>(n));
+  for (size_t k = 0; k < nValues; ++k) {
+    n = std::snprintf(field, sizeof(field), "%12.6f  ", values[k]);
+    buffer.append(field, static_cast<size_t>(n));
+  }
+  buffer.push_back('\n');
+}
+
+}  // namespace
+
 NodalAttributes::~NodalAttributes() = default;
 
 NodalAttributesPrivate::NodalAttributesPrivate()
@@ -77,17 +150,27 @@ size_t NodalAttributesPrivate::locateAttribute(
 
 void NodalAttributesPrivate::read() {
   std::ifstream fid(this->filename(), std::ifstream::in);
+  if (!fid.is_open()) {
+    adcircmodules_throw_exception("NodalAttributes: Could not open " +
+                                  this->filename());
+  }
 
   this->_readFort13Header(fid);
   this->_readFort13Defaults(fid);
   this->_fillDefaultValues();
-  this->_readFort13Body(fid);
+
+  //...The body is read into memory in one block and decoded in parallel
+  std::streampos bodyStart = fid.tellg();
+  fid.seekg(0, std::ios::end);
+  std::streampos fileEnd = fid.tellg();
+  fid.seekg(bodyStart);
+  std::string body(static_cast<size_t>(fileEnd - bodyStart), '\0');
+  fid.read(&body[0], static_cast<std::streamsize>(body.size()));
+  body.resize(static_cast<size_t>(fid.gcount()));
 
   fid.close();
 
-  if (this->m_mesh != nullptr) {
-    this->_mapNodes();
-  }
+  this->_readFort13Body(body);
 
   return;
 }
@@ -121,22 +204,12 @@ void NodalAttributesPrivate::_readFort13Header(std::ifstream &fid) {
       adcircmodules_throw_exception(
           "NodalAttributes: Number of nodes does not match provided mesh.");
     }
-  } else {
-    this->setNumNodes(numnodes);
   }
+  this->setNumNodes(numnodes);
 
   this->m_nodalParameters.resize(this->numParameters());
   this->m_nodalData.resize(this->numParameters());
-  for (size_t i = 0; i < this->numParameters(); ++i) {
-    this->m_nodalData[i].resize(this->numNodes());
-    for (size_t j = 0; j < this->numNodes(); ++j) {
-      if (this->m_mesh != nullptr) {
-        this->m_nodalData[i][j].setId(this->mesh()->node(j)->id());
-      } else {
-        this->m_nodalData[i][j].setId(j + 1);
-      }
-    }
-  }
+  this->m_proxies.clear();
 
   return;
 }
@@ -198,92 +271,127 @@ void NodalAttributesPrivate::_readFort13Defaults(std::ifstream &fid) {
 
 void NodalAttributesPrivate::_fillDefaultValues() {
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    if (this->m_nodalParameters[i].numberOfValues() == 1) {
-      for (size_t j = 0; j < this->numNodes(); ++j) {
-        this->m_nodalData[i][j].resize(1);
-        this->m_nodalData[i][j].setValue(
-            this->m_nodalParameters[i].defaultValue());
-      }
-    } else {
-      for (size_t j = 0; j < this->numNodes(); ++j) {
-        this->m_nodalData[i][j].resize(
-            this->m_nodalParameters[i].numberOfValues());
-        this->m_nodalData[i][j].setValue(
-            this->m_nodalParameters[i].getDefaultValues());
-      }
-    }
+    this->m_nodalData[i].resize(this->numNodes(),
+                                this->m_nodalParameters[i].getDefaultValues());
   }
 }
 
-void NodalAttributesPrivate::_mapNodes() {
-  for (size_t i = 0; i < this->numParameters(); ++i) {
-    for (size_t j = 0; j < this->numNodes(); ++j) {
-      this->m_nodalData[i][j].setNode(
-          this->mesh()->nodeById(this->m_nodalData[i][j].id()));
-    }
-  }
-  return;
+/**
+ * @brief Id of the node at a position in the attribute columns
+ * @param[in] position position of the node
+ * @return node id
+ */
+size_t NodalAttributesPrivate::_nodeId(size_t position) const {
+  return this->m_mesh != nullptr ? this->m_mesh->node(position)->id()
+                                 : position + 1;
 }
 
-void NodalAttributesPrivate::_readFort13Body(std::ifstream &fid) {
-  std::string tempLine, name;
-  size_t node;
-  double value;
-  bool ok;
-
+/**
+ * @brief Reads the non-default values of each attribute
+ * @param[in] body text of the file following the default values
+ *
+ * The body is scanned once to find where each attribute section begins and
+ * ends, and each section is split into chunks of lines. The chunks are
+ * independent, so they are decoded in parallel directly into the attribute
+ * columns. The non-default bitmaps are rebuilt once all chunks are decoded.
+ */
+void NodalAttributesPrivate::_readFort13Body(const std::string &body) {
+  struct Chunk {
+    size_t column;
+    const char *begin;
+    const char *end;
+  };
+
+  const char *p = body.data();
+  const char *const bodyEnd = body.data() + body.size();
+
+  std::vector<Chunk> chunks;
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    std::getline(fid, name);
-    name = StringConversion::sanitizeString(name);
-    size_t index = this->m_attributeLocations[name];
+    const char *lineEnd = nextLine(p, bodyEnd);
+    std::string name =
+        StringConversion::sanitizeString(std::string(p, lineEnd));
+    p = lineEnd;
+
+    auto it = this->m_attributeLocations.find(name);
+    if (it == this->m_attributeLocations.end()) {
+      adcircmodules_throw_exception("NodalAttributes: Unknown attribute " +
+                                    name);
+    }
 
-    std::getline(fid, tempLine);
-    size_t numNonDefault = StringConversion::stringToSizet(tempLine, ok);
-    assert(ok);
+    lineEnd = nextLine(p, bodyEnd);
+    bool ok;
+    size_t numNonDefault =
+        StringConversion::stringToSizet(std::string(p, lineEnd), ok);
     if (!ok) {
       adcircmodules_throw_exception("NodalAttributes: Error reading file data");
     }
+    p = lineEnd;
 
-    size_t nValues = this->m_nodalParameters[index].numberOfValues();
-
-    for (size_t j = 0; j < numNonDefault; ++j) {
-      std::getline(fid, tempLine);
-
-      if (nValues == 1) {
-        if (!FileIO::AdcircIO::splitStringAttribute1Format(tempLine, node,
-                                                           value)) {
+    for (size_t j = 0; j < numNonDefault; j += c_chunkSize) {
+      const size_t n = std::min(c_chunkSize, numNonDefault - j);
+      const char *chunkBegin = p;
+      for (size_t k = 0; k < n; ++k) {
+        if (p == bodyEnd) {
           adcircmodules_throw_exception(
-              "NodalAttributes: Error reading file data");
+              "NodalAttributes: Unexpected end of file");
         }
+        p = nextLine(p, bodyEnd);
+      }
+      chunks.push_back({it->second, chunkBegin, p});
+    }
+  }
 
-        Attribute *a;
-        if (this->m_mesh != nullptr) {
-          a = &this->m_nodalData[i][this->mesh()->nodeIndexById(node)];
-        } else {
-          a = &this->m_nodalData[i][node - 1];
-        }
-        a->setValue(value);
-        a->setId(node);
-
-      } else {
-        std::vector<double> values;
-        values.reserve(nValues);
-        if (!FileIO::AdcircIO::splitStringAttributeNFormat(tempLine, node,
-                                                           values)) {
-          adcircmodules_throw_exception(
-              "NodalAttributes: Error reading file data");
-        };
+  //...Node positions are found without throwing inside the parallel region.
+  // Ids that are not in the mesh are reported once all chunks are done
+  IdIndex nodeIndex;
+  if (this->m_mesh != nullptr) {
+    nodeIndex.build(this->numNodes(),
+                    [&](size_t i) { return this->m_mesh->node(i)->id(); });
+  }
 
-        Attribute *a;
-        if (this->m_mesh != nullptr) {
-          a = &this->m_nodalData[i][this->mesh()->nodeIndexById(node)];
-        } else {
-          a = &this->m_nodalData[i][node - 1];
+  bool error = false;
+
+#pragma omp parallel
+  {
+    std::vector<double> values;
+
+#pragma omp for schedule(dynamic)
+    for (size_t c = 0; c < chunks.size(); ++c) {
+      AttributeColumn &column = this->m_nodalData[chunks[c].column];
+      const size_t nValues = column.numValues();
+      values.resize(nValues);
+
+      const char *line = chunks[c].begin;
+      while (line < chunks[c].end) {
+        bool stop;
+#pragma omp atomic read
+        stop = error;
+        if (stop) break;
+
+        const char *lineEnd = nextLine(line, chunks[c].end);
+        size_t node;
+        size_t position = IdIndex::npos();
+        if (parseAttributeLine(line, lineEnd, nValues, node, values.data())) {
+          position = this->m_mesh != nullptr ? nodeIndex.find(node) : node - 1;
         }
-        a->setValue(values);
-        a->setId(node);
+        if (position >= this->numNodes()) {
+#pragma omp atomic write
+          error = true;
+          break;
+        }
+        std::copy(values.begin(), values.end(), column.mutableRow(position));
+        line = lineEnd;
       }
     }
   }
+
+  if (error) {
+    adcircmodules_throw_exception("NodalAttributes: Error reading file data");
+  }
+
+  for (auto &column : this->m_nodalData) {
+    column.updateDefaultMask();
+  }
   return;
 }
 
@@ -312,7 +420,16 @@ Attribute *NodalAttributesPrivate::attribute(size_t parameter, size_t node) {
   assert(parameter < this->numParameters());
 
   if (node < this->numNodes() && parameter < this->numParameters()) {
-    return &this->m_nodalData[parameter][node];
+    //...Proxies are only created for the nodes that are requested so that
+    // the column storage is not duplicated per node
+    std::lock_guard<std::mutex> guard(this->m_proxyMutex);
+    auto &proxy = this->m_proxies[parameter * this->numNodes() + node];
+    if (!proxy) {
+      proxy = std::make_unique<Attribute>(
+          &this->m_nodalData[parameter], node, this->_nodeId(node),
+          this->m_mesh != nullptr ? this->m_mesh->node(node) : nullptr);
+    }
+    return proxy.get();
   }
   adcircmodules_throw_exception(
       "NodalAttributes: Attribute could not be located");
@@ -325,6 +442,21 @@ Attribute *NodalAttributesPrivate::attribute(const std::string &name,
   return this->attribute(index, node);
 }
 
+AttributeColumn *NodalAttributesPrivate::column(size_t parameter) {
+  assert(parameter < this->numParameters());
+  if (parameter < this->numParameters()) {
+    return &this->m_nodalData[parameter];
+  }
+  adcircmodules_throw_exception(
+      "NodalAttributes: Attribute could not be located");
+  return nullptr;
+}
+
+AttributeColumn *NodalAttributesPrivate::column(const std::string &name) {
+  size_t index = this->locateAttribute(name);
+  return this->column(index);
+}
+
 std::string NodalAttributesPrivate::attributeNames(size_t index) {
   assert(index < this->m_nodalParameters.size());
   if (index < this->m_nodalParameters.size()) {
@@ -337,6 +469,10 @@ std::string NodalAttributesPrivate::attributeNames(size_t index) {
 void NodalAttributesPrivate::write(const std::string &outputFilename) {
   std::ofstream outputFile;
   outputFile.open(outputFilename);
+  if (!outputFile.is_open()) {
+    adcircmodules_throw_exception("NodalAttributes: Could not open " +
+                                  outputFilename);
+  }
   this->_writeFort13Header(outputFile);
   this->_writeFort13Body(outputFile);
   outputFile.close();
@@ -353,32 +489,74 @@ void NodalAttributesPrivate::_writeFort13Header(std::ofstream &fid) {
   return;
 }
 
+/**
+ * @brief Writes the non-default values of each attribute
+ * @param[in] fid output stream
+ *
+ * Each attribute section is split into ranges of nodes that are formatted
+ * into separate buffers in parallel. The buffers are written in order in
+ * batches so that only a limited part of the file is held in memory.
+ */
 void NodalAttributesPrivate::_writeFort13Body(std::ofstream &fid) {
+  struct Chunk {
+    size_t column;
+    size_t begin;
+    size_t end;
+    std::string text;
+  };
+
+  std::vector<Chunk> chunks;
   for (size_t i = 0; i < this->numParameters(); ++i) {
-    size_t ndefault =
-        this->_countDefault(this->m_nodalParameters[i], this->m_nodalData[i]);
-    fid << this->m_nodalParameters[i].name() << "\n";
-    fid << boost::str(boost::format("%11i\n") % ndefault);
-
-    for (size_t j = 0; j < this->numNodes(); ++j) {
-      if (!this->m_nodalParameters[i].checkIfDefaultValue(
-              this->m_nodalData[i][j])) {
-        fid << this->m_nodalData[i][j].write();
-      }
+    AttributeColumn &column = this->m_nodalData[i];
+
+    //...The metadata may have been edited since the column was filled
+    std::vector<double> defaults =
+        this->m_nodalParameters[i].getDefaultValues();
+    if (defaults != column.defaultValues()) {
+      column.setDefaultValues(defaults);
+    }
+
+    Chunk header;
+    header.column = i;
+    header.begin = header.end = 0;
+    header.text = this->m_nodalParameters[i].name() + "\n" +
+                  boost::str(boost::format("%11i\n") % column.numNonDefault());
+    chunks.push_back(std::move(header));
+
+    for (size_t j = 0; j < this->numNodes(); j += c_chunkSize) {
+      chunks.push_back({i, j, std::min(j + c_chunkSize, this->numNodes()),
+                        std::string()});
     }
   }
-  return;
-}
 
-size_t NodalAttributesPrivate::_countDefault(AttributeMetadata &metadata,
-                                             std::vector<Attribute> &values) {
-  size_t n = 0;
-  for (auto &v : values) {
-    if (!metadata.checkIfDefaultValue(v)) {
-      n++;
+#ifdef _OPENMP
+  const size_t batch = 4 * static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t batch = 1;
+#endif
+
+  for (size_t b0 = 0; b0 < chunks.size(); b0 += batch) {
+    const size_t b1 = std::min(b0 + batch, chunks.size());
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t c = b0; c < b1; ++c) {
+      Chunk &chunk = chunks[c];
+      const AttributeColumn &column = this->m_nodalData[chunk.column];
+      for (size_t j = chunk.begin; j < chunk.end; ++j) {
+        if (!column.isDefault(j)) {
+          formatAttributeLine(this->_nodeId(j), column.row(j),
+                              column.numValues(), chunk.text);
+        }
+      }
+    }
+
+    for (size_t c = b0; c < b1; ++c) {
+      fid.write(chunks[c].text.data(),
+                static_cast<std::streamsize>(chunks[c].text.size()));
+      std::string().swap(chunks[c].text);
     }
   }
-  return n;
+  return;
 }
 
 AttributeMetadata *NodalAttributesPrivate::metadata(size_t parameter) {
@@ -399,9 +577,35 @@ AttributeMetadata *NodalAttributesPrivate::metadata(const std::string &name) {
 
 void NodalAttributesPrivate::addAttribute(AttributeMetadata &metadata,
                                           std::vector<Attribute> &attribute) {
+  if (this->m_numNodes == 0 && this->m_nodalData.empty()) {
+    this->m_numNodes = attribute.size();
+  }
+  if (attribute.size() != this->numNodes()) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Attribute size does not match number of nodes");
+  }
+
+  AttributeColumn column(this->numNodes(), metadata.getDefaultValues());
+  for (size_t i = 0; i < attribute.size(); ++i) {
+    column.setValues(i, attribute[i].values());
+  }
+
   this->m_nodalParameters.push_back(metadata);
-  this->m_nodalData.push_back(attribute);
+  this->m_nodalData.push_back(std::move(column));
+  this->m_proxies.clear();
   this->m_attributeLocations[metadata.name()] =
       this->m_nodalParameters.size() - 1;
   this->m_numParameters = this->m_nodalParameters.size();
 }
+
+void NodalAttributesPrivate::permute(const std::vector<size_t> &order) {
+  if (order.size() != this->numNodes()) {
+    adcircmodules_throw_exception(
+        "NodalAttributes: Permutation size does not match number of nodes");
+  }
+
+  for (auto &data : this->m_nodalData) {
+    data.permute(order);
+  }
+  this->m_proxies.clear();
+}
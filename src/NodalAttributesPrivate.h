@@ -19,11 +19,14 @@
 #ifndef ADCMOD_NODALATTRIBUTESPRIVATE_H
 #define ADCMOD_NODALATTRIBUTESPRIVATE_H
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "Attribute.h"
+#include "AttributeColumn.h"
 #include "AttributeMetadata.h"
 #include "Mesh.h"
 
@@ -64,22 +67,25 @@ class NodalAttributesPrivate {
   Adcirc::ModelParameters::Attribute *attribute(const std::string &name,
                                                 size_t node);
 
+  Adcirc::ModelParameters::AttributeColumn *column(size_t parameter);
+  Adcirc::ModelParameters::AttributeColumn *column(const std::string &name);
+
   Adcirc::ModelParameters::AttributeMetadata *metadata(size_t parameter);
   Adcirc::ModelParameters::AttributeMetadata *metadata(const std::string &name);
 
   void addAttribute(Adcirc::ModelParameters::AttributeMetadata &metadata,
                     std::vector<Adcirc::ModelParameters::Attribute> &attribute);
 
+  void permute(const std::vector<size_t> &order);
+
  private:
   void _readFort13Header(std::ifstream &fid);
   void _readFort13Defaults(std::ifstream &fid);
-  void _readFort13Body(std::ifstream &fid);
+  void _readFort13Body(const std::string &body);
   void _writeFort13Body(std::ofstream &fid);
   void _writeFort13Header(std::ofstream &fid);
   void _fillDefaultValues();
-  void _mapNodes();
-  size_t _countDefault(Adcirc::ModelParameters::AttributeMetadata &metadata,
-                       std::vector<Adcirc::ModelParameters::Attribute> &values);
+  size_t _nodeId(size_t position) const;
 
   /// Mapping function between the name of a nodal parameter and its position in
   /// the nodalParameters vector
@@ -103,8 +109,17 @@ class NodalAttributesPrivate {
   /// Vector of objects containing the nodal parameters read from the file
   std::vector<Adcirc::ModelParameters::AttributeMetadata> m_nodalParameters;
 
-  /// Vector of objects for the nodal parameters
-  std::vector<std::vector<Adcirc::ModelParameters::Attribute> > m_nodalData;
+  /// Values of each nodal parameter for all nodes
+  std::vector<Adcirc::ModelParameters::AttributeColumn> m_nodalData;
+
+  /// Proxies handed out by attribute(), keyed by parameter * numNodes + node.
+  /// Cleared whenever the columns are reallocated or reordered
+  std::unordered_map<size_t,
+                     std::unique_ptr<Adcirc::ModelParameters::Attribute>>
+      m_proxies;
+
+  /// Guards m_proxies so attribute() can be called from several threads
+  std::mutex m_proxyMutex;
 };
 }  // namespace Private
 }  // namespace Adcirc
@@ -18,8 +18,6 @@
 //------------------------------------------------------------------------*/
 #include "NodeTable.h"
 
-#include <algorithm>
-
 #include "MeshPrivate.h"
 
 using namespace Adcirc::Geometry;
@@ -27,70 +25,85 @@ using namespace Adcirc::Geometry;
 NodeTable::NodeTable(Adcirc::Private::MeshPrivate *mesh) : m_mesh(mesh) {}
 
 size_t NodeTable::numNodesAroundNode(Node *node) {
-  size_t idx = m_mesh->nodeIndexById(node->id());
-  return m_nodeTable[idx].size();
+  return m_nodeTable.size(m_mesh->nodeIndex(node));
 }
 
 size_t NodeTable::numNodesAroundNode(size_t node) {
-  return m_nodeTable[node].size();
+  return m_nodeTable.size(node);
 }
 
+/**
+ * @brief Builds the list of nodes connected to each node by an element edge
+ */
 void NodeTable::build() {
-  this->m_nodeTable.resize(m_mesh->numNodes());
-  for (auto &t : m_nodeTable) {
-    t.reserve(20);
+  const size_t ne = m_mesh->numElements();
+  std::vector<size_t> first(ne + 1, 0);
+  for (size_t i = 0; i < ne; ++i) {
+    first[i + 1] = first[i] + 2 * m_mesh->element(i)->n();
   }
 
-  for (auto &e : *m_mesh->elements()) {
-    Node *n1 = e.node(0);
-    Node *n2 = e.node(1);
-    Node *n3 = e.node(2);
-    size_t id1 = m_mesh->nodeIndexById(n1->id());
-    size_t id2 = m_mesh->nodeIndexById(n2->id());
-    size_t id3 = m_mesh->nodeIndexById(n3->id());
-    m_nodeTable[id1].push_back(n2);
-    m_nodeTable[id1].push_back(n3);
-    m_nodeTable[id2].push_back(n1);
-    m_nodeTable[id2].push_back(n3);
-    m_nodeTable[id3].push_back(n1);
-    m_nodeTable[id3].push_back(n2);
-    if (e.n() == 3) {
-    } else if (e.n() == 4) {
-      Node *n4 = e.node(3);
-      size_t id4 = m_mesh->nodeIndexById(n4->id());
-      m_nodeTable[id1].push_back(n2);
-      m_nodeTable[id1].push_back(n4);
-      m_nodeTable[id2].push_back(n3);
-      m_nodeTable[id2].push_back(n1);
-      m_nodeTable[id3].push_back(n2);
-      m_nodeTable[id3].push_back(n4);
-      m_nodeTable[id4].push_back(n1);
-      m_nodeTable[id4].push_back(n3);
+  std::vector<CsrAdjacency::Entry> entries(first.back());
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < ne; ++i) {
+    Element *e = m_mesh->element(i);
+    size_t k = first[i];
+    for (size_t j = 0; j < e->n(); ++j) {
+      auto leg = e->elementLeg(j);
+      auto n1 = static_cast<CsrAdjacency::index_type>(
+          m_mesh->nodeIndex(leg.first));
+      auto n2 = static_cast<CsrAdjacency::index_type>(
+          m_mesh->nodeIndex(leg.second));
+      entries[k++] = {n1, n2, 0};
+      entries[k++] = {n2, n1, 0};
     }
   }
 
-  for (auto &v : m_nodeTable) {
-    std::sort(v.begin(), v.end());
-    auto it = std::unique(v.begin(), v.end());
-    v = std::vector<Adcirc::Geometry::Node *>(v.begin(), it);
-  }
+  m_nodeTable.build(m_mesh->numNodes(), entries, true, false);
 }
 
 std::vector<Adcirc::Geometry::Node *> NodeTable::nodeList(
     Adcirc::Geometry::Node *node) {
-  size_t idx = m_mesh->nodeIndexById(node->id());
-  return m_nodeTable[idx];
+  return this->nodeList(m_mesh->nodeIndex(node));
 }
 
 std::vector<Adcirc::Geometry::Node *> NodeTable::nodeList(size_t index) {
-  return m_nodeTable[index];
+  const auto r = m_nodeTable.row(index);
+  std::vector<Adcirc::Geometry::Node *> list;
+  list.reserve(r.size());
+  for (const auto n : r) {
+    list.push_back(m_mesh->node(n));
+  }
+  return list;
 }
 
 Adcirc::Geometry::Node *NodeTable::node(Adcirc::Geometry::Node *node,
                                         size_t index) {
-  return this->nodeList(node)[index];
+  return m_mesh->node(m_nodeTable.row(m_mesh->nodeIndex(node))[index]);
 }
 
 Adcirc::Geometry::Node *NodeTable::node(size_t node, size_t index) {
-  return this->nodeList(node)[index];
+  return m_mesh->node(m_nodeTable.row(node)[index]);
 }
+
+/**
+ * @brief Returns the indices of the nodes connected to a node without making
+ * a copy
+ * @param node index of the node in the mesh
+ * @return range of node indices, in ascending order
+ */
+CsrAdjacency::Range NodeTable::nodeIndices(size_t node) const {
+  return m_nodeTable.row(node);
+}
+
+/**
+ * @brief Returns the underlying compressed table
+ * @return reference to the adjacency table
+ */
+const CsrAdjacency &NodeTable::adjacency() const { return m_nodeTable; }
+
+/**
+ * @brief Returns the initialization status
+ * @return true if the table has been built
+ */
+bool NodeTable::initialized() const { return !m_nodeTable.empty(); }
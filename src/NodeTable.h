@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "AdcircModules_Global.h"
+#include "CsrAdjacency.h"
 #include "Node.h"
 
 namespace Adcirc {
@@ -47,10 +48,17 @@ class NodeTable {
       Adcirc::Geometry::Node *node, size_t index);
   Adcirc::Geometry::Node ADCIRCMODULES_EXPORT *node(size_t node, size_t index);
 
+#ifndef SWIG
+  CsrAdjacency::Range ADCIRCMODULES_EXPORT nodeIndices(size_t node) const;
+  const CsrAdjacency ADCIRCMODULES_EXPORT &adjacency() const;
+#endif
+
   void ADCIRCMODULES_EXPORT build();
 
+  bool ADCIRCMODULES_EXPORT initialized() const;
+
  private:
-  std::vector<std::vector<Adcirc::Geometry::Node *>> m_nodeTable;
+  CsrAdjacency m_nodeTable;
   Adcirc::Private::MeshPrivate *m_mesh;
 };
 
@@ -19,19 +19,58 @@
 
 #include "OceanweatherRecord.h"
 
+#include <algorithm>
 #include <cassert>
+#include <string>
 
 #include "Constants.h"
 #include "Logging.h"
+#include "StringConversion.h"
 #include "boost/format.hpp"
-#include "boost/spirit/include/phoenix.hpp"
-#include "boost/spirit/include/qi.hpp"
 
 using namespace Adcirc;
 
-namespace qi = boost::spirit::qi;
-namespace ascii = boost::spirit::ascii;
-namespace phoenix = boost::phoenix;
+namespace {
+
+/// Number of values on each line of an OWI data block
+constexpr size_t c_owiValuesPerLine = 8;
+
+/// Width of each F10.4 column in an OWI data block
+constexpr size_t c_owiColumnWidth = 10;
+
+/**
+ * @brief Parses the values on one line of an OWI data block using the fixed
+ * column widths of the format
+ * @param[in] line line read from the file
+ * @param[in] n number of values expected on the line
+ * @param[out] values array of n values
+ * @return true if all values were found
+ *
+ * Each value is read only from its own column, so adjacent values that fill
+ * their columns do not need to be separated by a blank. Lines that are not
+ * written with fixed columns are read as blank separated values.
+ */
+bool parseOwiLine(const std::string &line, size_t n, double *values) {
+  const char *const begin = line.data();
+  const char *const end = begin + line.size();
+
+  bool fixed = line.size() >= n * c_owiColumnWidth;
+  for (size_t k = 0; k < n && fixed; ++k) {
+    const char *p = begin + k * c_owiColumnWidth;
+    const char *const columnEnd = p + c_owiColumnWidth;
+    fixed = StringConversion::parseDouble(p, columnEnd, values[k]);
+    while (fixed && p < columnEnd) fixed = *p++ == ' ';
+  }
+  if (fixed) return true;
+
+  const char *p = begin;
+  for (size_t k = 0; k < n; ++k) {
+    if (!StringConversion::parseDouble(p, end, values[k])) return false;
+  }
+  return true;
+}
+
+}  // namespace
 
 OceanweatherRecord::OceanweatherRecord()
     : m_backgroundPressure(1013.0), m_gridchanged(true) {}
@@ -44,10 +83,21 @@ void OceanweatherRecord::addDomain(std::ifstream *fid_pressure,
   this->m_domains.push_back(d);
 }
 
+/**
+ * @brief Reads the next snap for all domains
+ * @return 0 on success
+ *
+ * The grid lines are read and checked for each domain first. The data blocks
+ * are then parsed concurrently, with the pressure file and the wind file of
+ * every domain each handled by a separate task.
+ */
 int OceanweatherRecord::read() {
   int has_error = 0;
-  for (auto &d : m_domains) {
-    if (d.fid_pressure->peek() && d.fid_wind->peek()) {
+  std::vector<char> active(m_domains.size(), 0);
+  for (size_t k = 0; k < m_domains.size(); ++k) {
+    auto &d = m_domains[k];
+    if (d.fid_pressure->peek() != std::ifstream::traits_type::eof() &&
+        d.fid_wind->peek() != std::ifstream::traits_type::eof()) {
       std::string header_pressure, header_wind;
       std::getline(*(d.fid_pressure), header_pressure);
       std::getline(*(d.fid_wind), header_wind);
@@ -68,17 +118,32 @@ int OceanweatherRecord::read() {
       } else {
         m_gridchanged = false;
       }
-
-      int ierr =
-          OceanweatherRecord::readData(d, d.fid_pressure, d.data_pressure);
-      ierr += OceanweatherRecord::readData(d, d.fid_wind, d.data_u);
-      ierr += OceanweatherRecord::readData(d, d.fid_wind, d.data_v);
-      if (ierr != 0) has_error = 1;
+      active[k] = 1;
     } else {
       Logging::warning("Reached end of file");
       has_error = 1;
     }
   }
+
+  const size_t ntask = 2 * m_domains.size();
+  std::vector<int> ierr(ntask, 0);
+#pragma omp parallel for schedule(dynamic)
+  for (size_t t = 0; t < ntask; ++t) {
+    auto &d = m_domains[t / 2];
+    if (!active[t / 2]) continue;
+    if (t % 2 == 0) {
+      ierr[t] = OceanweatherRecord::readData(d, d.fid_pressure,
+                                             d.data_pressure);
+    } else {
+      ierr[t] = OceanweatherRecord::readData(d, d.fid_wind, d.data_u);
+      if (ierr[t] == 0) {
+        ierr[t] = OceanweatherRecord::readData(d, d.fid_wind, d.data_v);
+      }
+    }
+  }
+  if (std::any_of(ierr.begin(), ierr.end(), [](int e) { return e != 0; })) {
+    has_error = 1;
+  }
   return has_error;
 }
 
@@ -185,22 +250,25 @@ void OceanweatherRecord::setBackgroundPressure(double backgroundPressure) {
   m_backgroundPressure = backgroundPressure;
 }
 
+/**
+ * @brief Reads one data block from an OWI file into a domain array
+ * @param[in] d domain that provides the grid dimensions
+ * @param[in] fid file positioned at the start of the data block
+ * @param[out] array values read. The array is only reallocated when the grid
+ * size changes
+ * @return 0 on success, 1 if the block is incomplete or cannot be parsed
+ */
 int OceanweatherRecord::readData(const OceanweatherRecord::Domain &d,
                                  std::ifstream *fid,
                                  std::vector<double> &array) {
-  constexpr size_t rpl = 8;  // 8 records per line for OWI format
   const size_t nv = d.grid.nx * d.grid.ny;
+  array.resize(nv);
 
-  array.clear();
-  array.reserve(nv);
-
-  for (size_t i = 0; i < nv; i += rpl) {
-    std::string line;
-    std::getline(*(fid), line);
-    auto err = qi::phrase_parse(
-        line.begin(), line.end(),
-        (*(qi::double_[phoenix::push_back(phoenix::ref(array), qi::_1)])),
-        ascii::space);
+  std::string line;
+  for (size_t i = 0; i < nv; i += c_owiValuesPerLine) {
+    if (!std::getline(*(fid), line)) return 1;
+    const size_t n = std::min(c_owiValuesPerLine, nv - i);
+    if (!parseOwiLine(line, n, array.data() + i)) return 1;
   }
   return 0;
 }
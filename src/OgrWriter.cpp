@@ -0,0 +1,212 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "OgrWriter.h"
+
+#include <algorithm>
+#include <cctype>
+
+#include "FileTypes.h"
+#include "Logging.h"
+
+#ifdef USE_GDAL
+#include "cpl_string.h"
+#include "gdal_priv.h"
+#include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
+#endif
+
+using namespace Adcirc::FileIO;
+
+/**
+ * @brief Constructor
+ * @param filename name of the output file. The format is selected from the
+ * extension
+ * @param epsg coordinate system of the features. If 0, no coordinate system
+ * is written
+ * @param transactionSize number of features inserted in each transaction
+ */
+OgrWriter::OgrWriter(const std::string &filename, int epsg,
+                     size_t transactionSize)
+    : m_filename(filename),
+      m_epsg(epsg),
+      m_transactionSize(std::max(transactionSize, static_cast<size_t>(1))) {}
+
+/**
+ * @brief Returns the GDAL driver name for a file based on its extension
+ * @param filename name of the file
+ * @return driver name, or an empty string if the extension is not recognized
+ */
+std::string OgrWriter::driverName(const std::string &filename) {
+  std::string ext = Adcirc::getExtension(filename);
+  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+  if (ext == "gpkg") return "GPKG";
+  if (ext == "fgb") return "FlatGeobuf";
+  if (ext == "shp") return "ESRI Shapefile";
+  return std::string();
+}
+
+/**
+ * @brief Writes the features to a new layer
+ * @param table features to write
+ * @param layerName name of the layer to create
+ */
+void OgrWriter::write(const FeatureTable &table,
+                      const std::string &layerName) const {
+#ifndef USE_GDAL
+  adcircmodules_throw_exception("GDAL is not enabled.");
+#else
+  const std::string driverName = OgrWriter::driverName(this->m_filename);
+  if (driverName.empty()) {
+    adcircmodules_throw_exception("OgrWriter: Unknown vector format for " +
+                                  this->m_filename);
+  }
+
+  GDALAllRegister();
+  GDALDriver *driver =
+      GetGDALDriverManager()->GetDriverByName(driverName.c_str());
+  if (driver == nullptr) {
+    adcircmodules_throw_exception("OgrWriter: GDAL driver " + driverName +
+                                  " is not available");
+  }
+
+  GDALDataset *ds = driver->Create(this->m_filename.c_str(), 0, 0, 0,
+                                   GDT_Unknown, nullptr);
+  if (ds == nullptr) {
+    adcircmodules_throw_exception("OgrWriter: Could not create " +
+                                  this->m_filename);
+  }
+
+  OGRSpatialReference srs;
+  OGRSpatialReference *srsPtr = nullptr;
+  if (this->m_epsg != 0 && srs.importFromEPSG(this->m_epsg) == OGRERR_NONE) {
+#if GDAL_VERSION_MAJOR >= 3
+    srs.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+#endif
+    srsPtr = &srs;
+  }
+
+  OGRwkbGeometryType gtype = wkbUnknown;
+  switch (table.geometryType()) {
+    case FeatureTable::FeaturePoint:
+      gtype = table.hasZ() ? wkbPoint25D : wkbPoint;
+      break;
+    case FeatureTable::FeatureLineString:
+      gtype = table.hasZ() ? wkbLineString25D : wkbLineString;
+      break;
+    case FeatureTable::FeaturePolygon:
+      gtype = table.hasZ() ? wkbPolygon25D : wkbPolygon;
+      break;
+  }
+
+  char **options = CSLSetNameValue(nullptr, "SPATIAL_INDEX", "YES");
+  OGRLayer *layer = ds->CreateLayer(layerName.c_str(), srsPtr, gtype, options);
+  CSLDestroy(options);
+  if (layer == nullptr) {
+    GDALClose(static_cast<GDALDatasetH>(ds));
+    adcircmodules_throw_exception("OgrWriter: Could not create layer " +
+                                  layerName);
+  }
+
+  for (size_t j = 0; j < table.numFields(); ++j) {
+    const auto &f = table.field(j);
+    OGRFieldDefn defn(f.name.c_str(), f.type == FeatureTable::FieldInteger
+                                          ? OFTInteger64
+                                          : OFTReal);
+    if (f.type == FeatureTable::FieldDouble) {
+      defn.SetWidth(f.width);
+      defn.SetPrecision(f.precision);
+    }
+    if (layer->CreateField(&defn) != OGRERR_NONE) {
+      GDALClose(static_cast<GDALDatasetH>(ds));
+      adcircmodules_throw_exception("OgrWriter: Could not create field " +
+                                    f.name);
+    }
+  }
+
+  //...Formats without transaction support return an error here and are
+  // written without one
+  bool inTransaction = ds->StartTransaction() == OGRERR_NONE;
+
+  OGRFeature *feature = OGRFeature::CreateFeature(layer->GetLayerDefn());
+  const bool hasZ = table.hasZ();
+  bool ok = true;
+
+  for (size_t i = 0; i < table.numFeatures() && ok; ++i) {
+    for (size_t j = 0; j < table.numFields(); ++j) {
+      const int jj = static_cast<int>(j);
+      if (table.field(j).type == FeatureTable::FieldInteger) {
+        feature->SetField(jj, static_cast<GIntBig>(table.integer(j, i)));
+      } else {
+        feature->SetField(jj, table.real(j, i));
+      }
+    }
+
+    const size_t v0 = table.vertexOffset(i);
+    const int np = static_cast<int>(table.numVertices(i));
+    if (table.geometryType() == FeatureTable::FeaturePoint) {
+      if (hasZ) {
+        feature->SetGeometryDirectly(
+            new OGRPoint(table.x(v0), table.y(v0), table.z(v0)));
+      } else {
+        feature->SetGeometryDirectly(new OGRPoint(table.x(v0), table.y(v0)));
+      }
+    } else {
+      OGRLineString *line = table.geometryType() ==
+                                    FeatureTable::FeatureLineString
+                                ? new OGRLineString()
+                                : new OGRLinearRing();
+      line->setNumPoints(np, FALSE);
+      for (int k = 0; k < np; ++k) {
+        const size_t v = v0 + static_cast<size_t>(k);
+        if (hasZ) {
+          line->setPoint(k, table.x(v), table.y(v), table.z(v));
+        } else {
+          line->setPoint(k, table.x(v), table.y(v));
+        }
+      }
+      if (table.geometryType() == FeatureTable::FeatureLineString) {
+        feature->SetGeometryDirectly(line);
+      } else {
+        auto *polygon = new OGRPolygon();
+        polygon->addRingDirectly(static_cast<OGRLinearRing *>(line));
+        feature->SetGeometryDirectly(polygon);
+      }
+    }
+
+    feature->SetFID(OGRNullFID);
+    ok = layer->CreateFeature(feature) == OGRERR_NONE;
+
+    if (inTransaction && (i + 1) % this->m_transactionSize == 0) {
+      ok = ok && ds->CommitTransaction() == OGRERR_NONE;
+      inTransaction = ds->StartTransaction() == OGRERR_NONE;
+    }
+  }
+
+  OGRFeature::DestroyFeature(feature);
+  if (inTransaction) {
+    ok = ds->CommitTransaction() == OGRERR_NONE && ok;
+  }
+  GDALClose(static_cast<GDALDatasetH>(ds));
+
+  if (!ok) {
+    adcircmodules_throw_exception("OgrWriter: Error writing features to " +
+                                  this->m_filename);
+  }
+#endif
+}
@@ -0,0 +1,60 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_OGRWRITER_H
+#define ADCMOD_OGRWRITER_H
+
+#include <string>
+
+#include "FeatureTable.h"
+
+namespace Adcirc {
+namespace FileIO {
+
+/**
+ * @class OgrWriter
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Writes a FeatureTable to a GDAL/OGR vector format such as
+ * GeoPackage or FlatGeobuf
+ *
+ * Features are inserted inside transactions of transactionSize features so
+ * that database backed formats do not commit each row. A spatial index is
+ * requested when the layer is created. One feature object is reused for all
+ * rows.
+ */
+class OgrWriter {
+ public:
+  explicit OgrWriter(const std::string &filename, int epsg = 0,
+                     size_t transactionSize = 100000);
+
+  void write(const FeatureTable &table, const std::string &layerName) const;
+
+  static std::string driverName(const std::string &filename);
+
+ private:
+  std::string m_filename;
+  int m_epsg;
+  size_t m_transactionSize;
+};
+
+}  // namespace FileIO
+}  // namespace Adcirc
+
+#endif  // ADCMOD_OGRWRITER_H
@@ -97,6 +97,31 @@ void OutputRecord::setIteration(long long iteration) {
   this->m_iteration = iteration;
 }
 
+/**
+ * @brief Reorders the record values to follow a reordered mesh
+ * @param[in] order gather list returned by Mesh::reorder, where entry i is the
+ * previous position of the node now at position i
+ */
+void OutputRecord::permute(const std::vector<size_t>& order) {
+  if (order.size() != this->m_numNodes) {
+    adcircmodules_throw_exception(
+        "OutputRecord: Permutation size does not match number of nodes");
+  }
+
+  auto apply = [&](std::vector<double>& v) {
+    if (v.size() != order.size()) return;
+    std::vector<double> p(v.size());
+    for (size_t i = 0; i < p.size(); ++i) {
+      p[i] = v[order[i]];
+    }
+    v.swap(p);
+  };
+
+  apply(this->m_u);
+  apply(this->m_v);
+  apply(this->m_w);
+}
+
 void OutputRecord::fill(double value) {
   std::fill(this->m_u.begin(), this->m_u.end(), value);
   if (this->m_metadata.dimension() > 1) {
@@ -443,6 +468,25 @@ std::vector<double> OutputRecord::values(size_t column) {
   }
 }
 
+/**
+ * @brief Returns a pointer to the values held in one column of the record
+ * @param column column to return (0=u, 1=v, 2=w). Scalar records hold their
+ * values in column 0
+ * @return pointer to numNodes() values
+ */
+const double* OutputRecord::data(size_t column) const {
+  if (column == 0) {
+    return this->m_u.data();
+  } else if (column == 1 && this->m_metadata.dimension() > 1) {
+    return this->m_v.data();
+  } else if (column == 2 && this->m_metadata.dimension() > 2) {
+    return this->m_w.data();
+  } else {
+    adcircmodules_throw_exception("OutputRecord: Invalid column specified");
+    return nullptr;
+  }
+}
+
 void OutputRecord::setAll(size_t size, const double* values) {
   assert(this->m_metadata.dimension() == 1);
   assert(size == this->m_numNodes);
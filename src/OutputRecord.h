@@ -55,12 +55,14 @@ class OutputRecord {
   OutputRecord(const size_t record, const size_t numNodes,
                Adcirc::Output::OutputMetadata& metadata,
                const CDate& coldstart = CDate(1970, 1, 1, 0, 0, 0));
-  OutputRecord(const size_t record, const size_t numNodes, const bool isMax,
-               const bool isVector, const size_t dimension,
+  OutputRecord(const size_t record, const size_t numNodes, const bool isVector,
+               const bool isMax, const size_t dimension,
                const CDate& coldstart = CDate(1970, 1, 1, 0, 0, 0));
 
   void fill(double z);
 
+  void permute(const std::vector<size_t>& order);
+
   void setU(size_t index, double z);
   void setV(size_t index, double z);
   void setW(size_t index, double value);
@@ -86,6 +88,10 @@ class OutputRecord {
   std::vector<double> magnitudes();
   std::vector<double> directions(AngleUnits angleType = AngleUnits::Degrees);
 
+#ifndef SWIG
+  const double* data(size_t column = 0) const;
+#endif
+
   double z(size_t index) const;
   double u(size_t index) const;
   double v(size_t index) const;
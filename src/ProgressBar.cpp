@@ -18,6 +18,10 @@
 //------------------------------------------------------------------------*/
 #include "ProgressBar.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 #include "boost/timer/progress_display.hpp"
 #include "indicators.hpp"
 
@@ -30,13 +34,34 @@
 #include <utility>
 #endif
 
+namespace {
+
+/// Minimum time between redraws of the progress bar, in milliseconds
+constexpr int64_t c_renderInterval = 100;
+
+/// Number of redraw checks over the full range of iterations
+constexpr size_t c_renderSteps = 1000;
+
+int64_t now() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
 ProgressBar::ProgressBar(size_t total_iterations, std::string prefix)
     : m_display_mode(istty()),
       m_total_iterations(total_iterations),
+      m_render_step(std::max<size_t>(1, total_iterations / c_renderSteps)),
+      m_active(false),
       m_current(0),
+      m_next_render(std::numeric_limits<uint64_t>::max()),
+      m_next_render_time(0),
+      m_rendered(0),
       m_prefix(std::move(prefix)),
-      m_boost_progress(nullptr),
-      m_indicators_progress(nullptr) {}
+      m_indicators_progress(nullptr),
+      m_boost_progress(nullptr) {}
 
 ProgressBar::~ProgressBar() = default;
 
@@ -67,14 +92,24 @@ void ProgressBar::begin() {
     m_indicators_progress->set_option(
         indicators::option::ShowRemainingTime(true));
     m_indicators_progress->set_option(indicators::option::PrefixText(m_prefix));
-    m_current = 0;
   } else {
     m_boost_progress =
         std::make_unique<boost::timer::progress_display>(m_total_iterations);
   }
+  m_current.store(0, std::memory_order_relaxed);
+  m_next_render.store(m_render_step, std::memory_order_relaxed);
+  m_next_render_time = 0;
+  m_rendered = 0;
+  m_active = true;
 }
 
 void ProgressBar::end() {
+  if (!m_active) return;
+  this->render(true);
+  std::lock_guard<std::mutex> guard(m_mutex);
+  m_active = false;
+  m_next_render.store(std::numeric_limits<uint64_t>::max(),
+                      std::memory_order_relaxed);
   if (m_display_mode == 1) {
     indicators::show_console_cursor(true);
     m_indicators_progress.reset(nullptr);
@@ -83,24 +118,78 @@ void ProgressBar::end() {
   }
 }
 
-void ProgressBar::tick() {
-  std::lock_guard<std::mutex> guard(m_mutex);
+/**
+ * @brief Advances the progress bar. Safe to call from multiple threads
+ * @param n number of iterations completed
+ */
+void ProgressBar::tick(size_t n) {
+  const uint64_t c = m_current.fetch_add(n, std::memory_order_relaxed) + n;
+  if (c >= m_next_render.load(std::memory_order_relaxed)) {
+    this->render(false);
+  }
+}
+
+/**
+ * @brief Redraws the progress bar
+ * @param force redraw even if the minimum interval has not passed, waiting
+ * for any thread that is currently drawing
+ */
+void ProgressBar::render(bool force) {
+  std::unique_lock<std::mutex> guard(m_mutex, std::try_to_lock);
+  if (!guard.owns_lock()) {
+    if (!force) return;
+    guard.lock();
+  }
+  if (!m_active) return;
+
+  const uint64_t c = std::min<uint64_t>(
+      m_current.load(std::memory_order_relaxed), m_total_iterations);
+  m_next_render.store(c + m_render_step, std::memory_order_relaxed);
+
+  const int64_t t = now();
+  if (!force && t < m_next_render_time) return;
+  m_next_render_time = t + c_renderInterval;
+  if (c == m_rendered && !force) return;
+
   if (m_display_mode == 1) {
-    m_current++;
-    if (m_current < m_total_iterations) {
+    if (c < m_total_iterations) {
       std::string postfix_string =
-          std::to_string(m_current) + "/" + std::to_string(m_total_iterations);
-      this->m_indicators_progress->set_option(
+          std::to_string(c) + "/" + std::to_string(m_total_iterations);
+      m_indicators_progress->set_option(
           indicators::option::PostfixText(postfix_string));
     } else {
-      this->m_indicators_progress->set_option(
-          indicators::option::PostfixText(""));
+      m_indicators_progress->set_option(indicators::option::PostfixText(""));
       m_indicators_progress->set_option(
           indicators::option::ShowRemainingTime(false));
     }
-    m_indicators_progress->tick();
+    m_indicators_progress->set_progress(c);
   } else {
-    ++(*m_boost_progress);
+    *m_boost_progress += static_cast<unsigned long>(c - m_rendered);
   }
+  m_rendered = c;
+}
+
+void ProgressBar::setPrefix(const std::string &prefix) { m_prefix = prefix; }
+
+/**
+ * @brief Constructor
+ * @param bar progress bar to forward iterations to. The batch size is chosen
+ * so that the shared counter is updated about ten thousand times over the full
+ * range of iterations
+ */
+ProgressBar::LocalCounter::LocalCounter(ProgressBar *bar)
+    : m_bar(bar),
+      m_pending(0),
+      m_batch(std::min<size_t>(
+          1024, std::max<size_t>(1, bar->m_total_iterations / 10000))) {}
+
+ProgressBar::LocalCounter::~LocalCounter() { this->flush(); }
+
+/**
+ * @brief Forwards the iterations counted so far to the progress bar
+ */
+void ProgressBar::LocalCounter::flush() {
+  if (m_pending == 0) return;
+  m_bar->tick(m_pending);
+  m_pending = 0;
 }
-void ProgressBar::setPrefix(const std::string& prefix) { m_prefix = prefix; }
@@ -19,6 +19,8 @@
 #ifndef PROGRESSBAR_H
 #define PROGRESSBAR_H
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -33,22 +35,61 @@ class progress_display;
 }
 }  // namespace boost
 
+/**
+ * @class ProgressBar
+ * @brief Console progress bar that can be advanced from parallel loops
+ *
+ * The iteration count is a relaxed atomic counter, so tick() does not take a
+ * lock. The bar is only redrawn after a minimum number of iterations and a
+ * minimum time have passed, and only by one thread at a time; threads that
+ * find another thread drawing skip the redraw. In tight loops, each thread can
+ * hold a LocalCounter that adds its iterations to the shared counter in
+ * batches.
+ */
 class ProgressBar {
  public:
-  explicit ProgressBar(size_t total_iterations, std::string prefix = std::string());
+  /**
+   * @brief Per-thread counter that forwards iterations to a ProgressBar in
+   * batches. Any remaining iterations are forwarded when it is destroyed
+   */
+  class LocalCounter {
+   public:
+    explicit LocalCounter(ProgressBar *bar);
+    ~LocalCounter();
+
+    void tick() {
+      if (++m_pending >= m_batch) this->flush();
+    }
+
+    void flush();
+
+   private:
+    ProgressBar *m_bar;
+    size_t m_pending;
+    size_t m_batch;
+  };
+
+  explicit ProgressBar(size_t total_iterations,
+                       std::string prefix = std::string());
   ~ProgressBar();
 
   void setPrefix(const std::string &prefix);
   void begin();
-  void tick();
+  void tick(size_t n = 1);
   void end();
 
  private:
   static bool istty();
+  void render(bool force);
 
   short m_display_mode;
   size_t m_total_iterations;
-  unsigned long long m_current;
+  size_t m_render_step;
+  bool m_active;
+  std::atomic<uint64_t> m_current;
+  std::atomic<uint64_t> m_next_render;
+  int64_t m_next_render_time;
+  uint64_t m_rendered;
   std::string m_prefix;
   std::mutex m_mutex;
   std::unique_ptr<indicators::ProgressBar> m_indicators_progress;
@@ -18,9 +18,15 @@
 //------------------------------------------------------------------------//
 #include "Projection.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "Constants.h"
 #include "Logging.h"
@@ -36,6 +42,158 @@
 
 using namespace Adcirc;
 
+namespace {
+
+//...Number of points sent to proj_trans_generic at once. Large arrays are
+// split into blocks of this size and spread over the OpenMP threads
+constexpr size_t c_transformBlockSize = 16384;
+
+//...Arrays smaller than this are transformed on the calling thread since
+// each thread must generate its own transformer on first use
+constexpr size_t c_transformParallelThreshold = 8 * c_transformBlockSize;
+
+/**
+ * @brief Transformer between two EPSG codes along with the unit information
+ * needed to prepare the coordinates
+ */
+struct CachedTransformer {
+  PJ *pj = nullptr;
+  bool angularInput = false;
+  bool angularOutput = false;
+};
+
+/**
+ * @brief Per-thread proj context and the transformers generated with it
+ *
+ * PJ objects may not be shared between threads, so each thread keeps its own
+ * context and set of transformers keyed by the input and output EPSG codes.
+ * The cache is regenerated when the proj database location changes.
+ */
+class TransformerCache {
+ public:
+  TransformerCache() : m_context(nullptr), m_generation(0) {}
+
+  ~TransformerCache() { this->clear(); }
+
+  TransformerCache(const TransformerCache &) = delete;
+  TransformerCache &operator=(const TransformerCache &) = delete;
+
+  const CachedTransformer *get(int epsgInput, int epsgOutput,
+                               unsigned generation, int &ierr);
+
+ private:
+  void clear();
+
+  PJ_CONTEXT *m_context;
+  unsigned m_generation;
+  std::map<std::pair<int, int>, CachedTransformer> m_transformers;
+};
+
+std::mutex s_projMutex;
+std::atomic<unsigned> s_projGeneration(1);
+std::unordered_map<int, std::pair<int, Projection::projection_epsg_result>>
+    s_epsgCache;
+
+thread_local TransformerCache s_transformerCache;
+
+void TransformerCache::clear() {
+  for (auto &t : this->m_transformers) {
+    adcmod_proj_destroy(t.second.pj);
+  }
+  this->m_transformers.clear();
+  if (this->m_context) {
+    adcmod_proj_context_destroy(this->m_context);
+    this->m_context = nullptr;
+  }
+}
+
+const CachedTransformer *TransformerCache::get(int epsgInput, int epsgOutput,
+                                               unsigned generation,
+                                               int &ierr) {
+  ierr = 0;
+  if (this->m_generation != generation) {
+    this->clear();
+    this->m_generation = generation;
+  }
+
+  const auto key = std::make_pair(epsgInput, epsgOutput);
+  const auto it = this->m_transformers.find(key);
+  if (it != this->m_transformers.end()) return &it->second;
+
+  if (this->m_context == nullptr) {
+    std::lock_guard<std::mutex> guard(s_projMutex);
+    this->m_context = adcmod_proj_context_create();
+    const char *db = adcmod_proj_context_get_database_path(PJ_DEFAULT_CTX);
+    if (db != nullptr) {
+      adcmod_proj_context_set_database_path(this->m_context, db, nullptr,
+                                            nullptr);
+    }
+  }
+
+  const std::string p1 = "EPSG:" + std::to_string(epsgInput);
+  const std::string p2 = "EPSG:" + std::to_string(epsgOutput);
+  PJ *pj1 = adcmod_proj_create_crs_to_crs(this->m_context, p1.c_str(),
+                                          p2.c_str(), nullptr);
+  if (pj1 == nullptr) {
+    ierr = 5;
+    return nullptr;
+  }
+  PJ *pj2 = adcmod_proj_normalize_for_visualization(this->m_context, pj1);
+  adcmod_proj_destroy(pj1);
+  if (pj2 == nullptr) {
+    ierr = 6;
+    return nullptr;
+  }
+
+  CachedTransformer t;
+  t.pj = pj2;
+  t.angularInput = adcmod_proj_angular_input(pj2, PJ_INV);
+  t.angularOutput = adcmod_proj_angular_output(pj2, PJ_FWD);
+  return &(this->m_transformers[key] = t);
+}
+
+/**
+ * @brief Transforms a block of coordinates in place with the calling thread's
+ * transformer
+ */
+void transformBlock(const CachedTransformer *t, double *x, double *y,
+                    size_t stride, size_t n) {
+  auto xi = [&](size_t i) -> double & {
+    return *reinterpret_cast<double *>(reinterpret_cast<char *>(x) +
+                                       i * stride);
+  };
+  auto yi = [&](size_t i) -> double & {
+    return *reinterpret_cast<double *>(reinterpret_cast<char *>(y) +
+                                       i * stride);
+  };
+
+  if (t->angularInput) {
+    for (size_t i = 0; i < n; ++i) {
+      xi(i) = adcmod_proj_torad(xi(i));
+      yi(i) = adcmod_proj_torad(yi(i));
+    }
+  }
+
+  adcmod_proj_trans_generic(t->pj, PJ_FWD, x, stride, n, y, stride, n,
+                            nullptr, 0, 0, nullptr, 0, 0);
+
+  if (t->angularOutput) {
+    for (size_t i = 0; i < n; ++i) {
+      xi(i) = adcmod_proj_todeg(xi(i));
+      yi(i) = adcmod_proj_todeg(yi(i));
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Checks if the proj database contains an EPSG code
+ * @param epsg coordinate system code
+ * @return true if the code is found
+ *
+ * Results are cached so that the database is only queried once per code
+ */
 bool Projection::containsEpsg(int epsg) {
   projection_epsg_result result = {false, 0, ""};
   return Projection::queryProjDatabase(epsg, result) == 0;
@@ -66,6 +224,13 @@ static int projection_sqlite_callback(void *data, int argc, char **argv,
 }
 
 int Projection::queryProjDatabase(int epsg, projection_epsg_result &result) {
+  std::lock_guard<std::mutex> guard(s_projMutex);
+  const auto it = s_epsgCache.find(epsg);
+  if (it != s_epsgCache.end()) {
+    result = it->second.second;
+    return it->second.first;
+  }
+
   sqlite3 *db;
   sqlite3_open(adcmod_proj_context_get_database_path(PJ_DEFAULT_CTX), &db);
   std::string queryString =
@@ -76,8 +241,9 @@ int Projection::queryProjDatabase(int epsg, projection_epsg_result &result) {
   sqlite3_exec(db, queryString.c_str(), projection_sqlite_callback, &result,
                &errString);
   sqlite3_close(db);
-  if (std::get<0>(result)) return 0;
-  return 1;
+  const int ierr = std::get<0>(result) ? 0 : 1;
+  s_epsgCache[epsg] = std::make_pair(ierr, result);
+  return ierr;
 }
 
 int Projection::transform(int epsgInput, int epsgOutput, double x, double y,
@@ -102,48 +268,92 @@ int Projection::transform(int epsgInput, int epsgOutput,
   isLatLon = false;
   if (x.size() != y.size()) return 1;
   if (x.empty()) return 2;
+  outx = x;
+  outy = y;
+  return Projection::transformInPlace(epsgInput, epsgOutput, outx, outy,
+                                      isLatLon);
+}
+
+/**
+ * @brief Transforms coordinate vectors without making a copy
+ * @param epsgInput coordinate system of the input data
+ * @param epsgOutput coordinate system to transform to
+ * @param x x-coordinates, overwritten with the transformed values
+ * @param y y-coordinates, overwritten with the transformed values
+ * @param isLatLon set to true if the output is geographic
+ * @return error code, 0 on success
+ */
+int Projection::transformInPlace(int epsgInput, int epsgOutput,
+                                 std::vector<double> &x, std::vector<double> &y,
+                                 bool &isLatLon) {
+  isLatLon = false;
+  if (x.size() != y.size()) return 1;
+  if (x.empty()) return 2;
+  return Projection::transformInPlace(epsgInput, epsgOutput, x.size(),
+                                      x.data(), y.data(), sizeof(double),
+                                      isLatLon);
+}
+
+/**
+ * @brief Transforms strided coordinate arrays without making a copy
+ * @param epsgInput coordinate system of the input data
+ * @param epsgOutput coordinate system to transform to
+ * @param n number of points
+ * @param x pointer to the first x-coordinate
+ * @param y pointer to the first y-coordinate
+ * @param stride distance in bytes between consecutive points
+ * @param isLatLon set to true if the output is geographic
+ * @return error code, 0 on success
+ *
+ * Transformers are cached by thread and EPSG pair so repeated calls do not
+ * regenerate the coordinate operation. Large arrays are split into blocks
+ * that are transformed in parallel.
+ */
+int Projection::transformInPlace(int epsgInput, int epsgOutput, size_t n,
+                                 double *x, double *y, size_t stride,
+                                 bool &isLatLon) {
+  isLatLon = false;
+  if (n == 0) return 2;
 
   if (!Projection::containsEpsg(epsgInput)) return 3;
   if (!Projection::containsEpsg(epsgOutput)) return 4;
 
-  std::string p1 = "EPSG:" + std::to_string(epsgInput);
-  std::string p2 = "EPSG:" + std::to_string(epsgOutput);
-  PJ *pj1 = adcmod_proj_create_crs_to_crs(PJ_DEFAULT_CTX, p1.c_str(),
-                                          p2.c_str(), NULL);
-  if (pj1 == nullptr) return 5;
-  PJ *pj2 = adcmod_proj_normalize_for_visualization(PJ_DEFAULT_CTX, pj1);
-  if (pj2 == nullptr) return 6;
-  adcmod_proj_destroy(pj1);
+  const unsigned generation = s_projGeneration.load();
+  int ierr = 0;
+  const CachedTransformer *t =
+      s_transformerCache.get(epsgInput, epsgOutput, generation, ierr);
+  if (t == nullptr) return ierr;
+  isLatLon = t->angularOutput;
 
-  outx.clear();
-  outy.clear();
-  outx.reserve(x.size());
-  outy.reserve(y.size());
-
-  for (size_t i = 0; i < x.size(); ++i) {
-    PJ_COORD cin;
-    if (adcmod_proj_angular_input(pj2, PJ_INV)) {
-      cin.lp.lam = adcmod_proj_torad(x[i]);
-      cin.lp.phi = adcmod_proj_torad(y[i]);
-    } else {
-      cin.xy.x = x[i];
-      cin.xy.y = y[i];
-    }
+  auto *xb = reinterpret_cast<char *>(x);
+  auto *yb = reinterpret_cast<char *>(y);
+
+  if (n < c_transformParallelThreshold) {
+    transformBlock(t, x, y, stride, n);
+    return 0;
+  }
 
-    PJ_COORD cout = adcmod_proj_trans(pj2, PJ_FWD, cin);
+  const auto nBlocks = static_cast<long long>(
+      (n + c_transformBlockSize - 1) / c_transformBlockSize);
+  int threadError = 0;
 
-    if (adcmod_proj_angular_output(pj2, PJ_FWD)) {
-      outx.push_back(adcmod_proj_todeg(cout.lp.lam));
-      outy.push_back(adcmod_proj_todeg(cout.lp.phi));
-      isLatLon = true;
-    } else {
-      outx.push_back(cout.xy.x);
-      outy.push_back(cout.xy.y);
-      isLatLon = false;
+#pragma omp parallel for schedule(static)
+  for (long long b = 0; b < nBlocks; ++b) {
+    int e = 0;
+    const CachedTransformer *tb =
+        s_transformerCache.get(epsgInput, epsgOutput, generation, e);
+    if (tb == nullptr) {
+#pragma omp atomic write
+      threadError = e;
+      continue;
     }
+    const size_t i0 = static_cast<size_t>(b) * c_transformBlockSize;
+    const size_t nb = std::min(c_transformBlockSize, n - i0);
+    transformBlock(tb, reinterpret_cast<double *>(xb + i0 * stride),
+                   reinterpret_cast<double *>(yb + i0 * stride), stride, nb);
   }
-  adcmod_proj_destroy(pj2);
-  return 0;
+
+  return threadError;
 }
 
 int Projection::transform(int epsgInput, int epsgOutput,
@@ -253,9 +463,13 @@ int Projection::inverseCpp(double lambda0, double phi0,
 }
 
 void Projection::setProjDatabaseLocation(const std::string &dblocation) {
+  std::lock_guard<std::mutex> guard(s_projMutex);
   adcmod_proj_context_set_database_path(PJ_DEFAULT_CTX, dblocation.c_str(),
                                         nullptr, nullptr);
+  s_epsgCache.clear();
+  ++s_projGeneration;
 }
 std::string Projection::projDatabaseLocation() {
+  std::lock_guard<std::mutex> guard(s_projMutex);
   return adcmod_proj_context_get_database_path(PJ_DEFAULT_CTX);
 }
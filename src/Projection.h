@@ -56,6 +56,18 @@ class Projection {
       int epsgInput, int epsgOutput, const std::vector<Adcirc::Point> &points,
       std::vector<Adcirc::Point> &output, bool &isLatLon);
 
+  static int ADCIRCMODULES_EXPORT transformInPlace(int epsgInput,
+                                                   int epsgOutput,
+                                                   std::vector<double> &x,
+                                                   std::vector<double> &y,
+                                                   bool &isLatLon);
+
+  static int ADCIRCMODULES_EXPORT transformInPlace(int epsgInput,
+                                                   int epsgOutput, size_t n,
+                                                   double *x, double *y,
+                                                   size_t stride,
+                                                   bool &isLatLon);
+
   static int ADCIRCMODULES_EXPORT cpp(double lambda, double phi, double x,
                                       double y, double &outx, double &outy);
   static int ADCIRCMODULES_EXPORT cpp(double lambda, double phi,
@@ -47,7 +47,8 @@ template double Adcirc::Raster::Rasterdata::nodata<double>() const;
 // Macro to initialize constructors
 #define RASTERDATACLASSINIT                                                   \
   m_file(nullptr), m_band(nullptr), m_isOpen(false), m_isRead(false),         \
-      m_epsg(4326), m_nx(-std::numeric_limits<size_t>::max()),                \
+      m_ownsFile(true), m_epsg(4326),                                         \
+      m_nx(-std::numeric_limits<size_t>::max()),                              \
       m_ny(-std::numeric_limits<size_t>::max()),                              \
       m_xmin(std::numeric_limits<double>::max()),                             \
       m_xmax(-std::numeric_limits<double>::max()),                            \
@@ -69,6 +70,39 @@ Rasterdata::Rasterdata() : m_filename(std::string()), RASTERDATACLASSINIT {}
 Rasterdata::Rasterdata(std::string filename)
     : m_filename(std::move(filename)), RASTERDATACLASSINIT {}
 
+/**
+ * @brief Constructor used for reduced resolution copies of a raster
+ * @param parent raster that this object is derived from
+ * @param nx number of pixels in the x-direction
+ * @param ny number of pixels in the y-direction
+ *
+ * The metadata is taken from the parent and the pixel size is scaled so that
+ * the extents of the parent are preserved. The new object does not own the
+ * GDAL dataset.
+ */
+Rasterdata::Rasterdata(const Rasterdata &parent, size_t nx, size_t ny)
+    : m_filename(parent.m_filename), RASTERDATACLASSINIT {
+  this->m_ownsFile = false;
+  this->m_nx = nx;
+  this->m_ny = ny;
+  this->m_epsg = parent.m_epsg;
+  this->m_xmin = parent.m_xmin;
+  this->m_ymax = parent.m_ymax;
+  this->m_dx = parent.m_dx * static_cast<double>(parent.m_nx) /
+               static_cast<double>(nx);
+  this->m_dy = parent.m_dy * static_cast<double>(parent.m_ny) /
+               static_cast<double>(ny);
+  this->m_xmax =
+      static_cast<double>(this->m_nx - 1) * this->m_dx + this->m_xmin;
+  this->m_ymin =
+      static_cast<double>(this->m_ny - 1) * (-this->m_dy) + this->m_ymax;
+  this->m_nodata = parent.m_nodata;
+  this->m_nodataint = parent.m_nodataint;
+  this->m_readType = parent.m_readType;
+  this->m_rasterType = parent.m_rasterType;
+  this->m_projectionReference = parent.m_projectionReference;
+}
+
 /**
  * @brief Destructor
  */
@@ -159,7 +193,11 @@ void Rasterdata::setFilename(const std::string &filename) {
  */
 bool Rasterdata::close() {
   if (this->m_file != nullptr) {
-    GDALClose(static_cast<GDALDatasetH>(this->m_file));
+    if (this->m_ownsFile) {
+      GDALClose(static_cast<GDALDatasetH>(this->m_file));
+    }
+    this->m_file = nullptr;
+    this->m_band = nullptr;
     this->m_isOpen = false;
     return true;
   }
@@ -549,3 +587,136 @@ int Rasterdata::epsg() const { return this->m_epsg; }
  * @param epsg epsg code for the raster
  */
 void Rasterdata::setEpsg(int epsg) { this->m_epsg = epsg; }
+
+/**
+ * @brief Builds the summed area tables and maximum pyramid used to quickly
+ * compute window statistics
+ * @return true if the tables were built
+ *
+ * The raster is read into memory if it has not been already. The tables
+ * require roughly three times the memory of the raster itself and are only
+ * available for floating point rasters.
+ */
+bool Rasterdata::buildIntegralTables() {
+  if (this->m_rasterType != RasterTypes::Double) {
+    Adcirc::Logging::warning(
+        "Integral tables are only available for floating point rasters");
+    return false;
+  }
+  this->read();
+  if (!this->m_integralTables.isBuilt()) {
+    this->m_integralTables.build(this->m_doubleOnDisk.data(), this->m_nx,
+                                 this->m_ny, this->m_nodata, this->m_xmin,
+                                 this->m_ymax, this->m_dx, this->m_dy);
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the integral tables for the raster
+ * @return pointer to the tables, or nullptr if they have not been built
+ */
+const RasterIntegralTables *Rasterdata::integralTables() const {
+  return this->m_integralTables.isBuilt() ? &this->m_integralTables : nullptr;
+}
+
+/**
+ * @brief Returns the number of reduced resolution overviews stored with the
+ * raster file
+ * @return number of overviews
+ */
+size_t Rasterdata::overviewCount() const {
+  if (this->m_band == nullptr) return 0;
+  return static_cast<size_t>(std::max(0, this->m_band->GetOverviewCount()));
+}
+
+/**
+ * @brief Generates a raster object which reads from one of the overviews
+ * stored with the raster file
+ * @param index overview index
+ * @return raster object for the overview, or nullptr if it is not available
+ *
+ * The overview shares the GDAL dataset with this object and must not outlive
+ * it
+ */
+std::unique_ptr<Rasterdata> Rasterdata::overview(size_t index) const {
+  if (index >= this->overviewCount()) return nullptr;
+  GDALRasterBand *band = this->m_band->GetOverview(static_cast<int>(index));
+  if (band == nullptr || band->GetXSize() < 1 || band->GetYSize() < 1) {
+    return nullptr;
+  }
+  std::unique_ptr<Rasterdata> r(
+      new Rasterdata(*this, static_cast<size_t>(band->GetXSize()),
+                     static_cast<size_t>(band->GetYSize())));
+  r->m_file = this->m_file;
+  r->m_band = band;
+  r->m_isOpen = true;
+  return r;
+}
+
+/**
+ * @brief Generates an in-memory copy of the raster at half the resolution
+ * @return reduced resolution raster
+ *
+ * Floating point rasters are reduced using the average of the valid pixels in
+ * each 2x2 block. Integer rasters, which are usually classifications, use the
+ * first valid pixel in the block. The raster must already be read into memory.
+ */
+std::unique_ptr<Rasterdata> Rasterdata::downsample() const {
+  if (!this->m_isRead) {
+    adcircmodules_throw_exception(
+        "Rasterdata: The raster must be in memory to downsample");
+  }
+
+  const size_t nx = (this->m_nx + 1) / 2;
+  const size_t ny = (this->m_ny + 1) / 2;
+  std::unique_ptr<Rasterdata> r(new Rasterdata(*this, nx, ny));
+  r->m_dx = 2.0 * this->m_dx;
+  r->m_dy = 2.0 * this->m_dy;
+  r->m_xmax = static_cast<double>(nx - 1) * r->m_dx + r->m_xmin;
+  r->m_ymin = static_cast<double>(ny - 1) * (-r->m_dy) + r->m_ymax;
+  r->m_isOpen = true;
+  r->m_isRead = true;
+
+  if (this->m_rasterType == RasterTypes::Double) {
+    r->m_doubleOnDisk.resize(boost::extents[ny][nx]);
+#pragma omp parallel for schedule(static)
+    for (size_t j = 0; j < ny; ++j) {
+      for (size_t i = 0; i < nx; ++i) {
+        double a = 0.0;
+        size_t n = 0;
+        for (size_t jj = 2 * j; jj < std::min(2 * j + 2, this->m_ny); ++jj) {
+          for (size_t ii = 2 * i; ii < std::min(2 * i + 2, this->m_nx); ++ii) {
+            const double z = this->m_doubleOnDisk[jj][ii];
+            if (z != this->m_nodata) {
+              a += z;
+              n++;
+            }
+          }
+        }
+        r->m_doubleOnDisk[j][i] =
+            n > 0 ? a / static_cast<double>(n) : this->m_nodata;
+      }
+    }
+  } else {
+    r->m_intOnDisk.resize(boost::extents[ny][nx]);
+#pragma omp parallel for schedule(static)
+    for (size_t j = 0; j < ny; ++j) {
+      for (size_t i = 0; i < nx; ++i) {
+        int v = this->m_nodataint;
+        for (size_t jj = 2 * j;
+             jj < std::min(2 * j + 2, this->m_ny) && v == this->m_nodataint;
+             ++jj) {
+          for (size_t ii = 2 * i; ii < std::min(2 * i + 2, this->m_nx); ++ii) {
+            if (this->m_intOnDisk[jj][ii] != this->m_nodataint) {
+              v = this->m_intOnDisk[jj][ii];
+              break;
+            }
+          }
+        }
+        r->m_intOnDisk[j][i] = v;
+      }
+    }
+  }
+  return r;
+}
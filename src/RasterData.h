@@ -19,12 +19,14 @@
 #ifndef ADCMOD_RASTERDATA_H
 #define ADCMOD_RASTERDATA_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "Pixel.h"
 #include "PixelValueVector.h"
 #include "Point.h"
+#include "RasterIntegralTables.h"
 #include "boost/multi_array.hpp"
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -116,7 +118,16 @@ class Rasterdata {
 
   bool isOpen() const;
 
+  bool buildIntegralTables();
+  const Adcirc::Raster::RasterIntegralTables *integralTables() const;
+
+  size_t overviewCount() const;
+  std::unique_ptr<Rasterdata> overview(size_t index) const;
+  std::unique_ptr<Rasterdata> downsample() const;
+
  private:
+  Rasterdata(const Rasterdata &parent, size_t nx, size_t ny);
+
   bool getRasterMetadata();
   Adcirc::Raster::Rasterdata::RasterTypes selectRasterType(int d);
 
@@ -137,8 +148,11 @@ class Rasterdata {
   boost::multi_array<double, 2> m_doubleOnDisk;
   boost::multi_array<int, 2> m_intOnDisk;
 
+  Adcirc::Raster::RasterIntegralTables m_integralTables;
+
   bool m_isOpen;
   bool m_isRead;
+  bool m_ownsFile;
   size_t m_nx, m_ny;
   int m_epsg;
   double m_dx, m_dy;
@@ -0,0 +1,107 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "RasterFile.h"
+
+#include "FileIO.h"
+#include "Logging.h"
+#include "boost/format.hpp"
+
+#ifdef USE_GDAL
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_priv.h"
+#include "ogr_spatialref.h"
+#endif
+
+/**
+ * @brief Creates a single band Float32 raster for mesh output
+ * @param[in] filename name of the output raster (.tif or .img)
+ * @param[in] nx number of columns
+ * @param[in] ny number of rows
+ * @param[in] xmin left edge of the raster
+ * @param[in] ymax top edge of the raster
+ * @param[in] resolution pixel size
+ * @param[in] epsg coordinate system of the raster
+ * @param[in] nullvalue nodata value of the band
+ * @param[in] description description of the data
+ * @param[in] units data units
+ * @return dataset opened for writing
+ */
+GDALDataset *Adcirc::FileIO::createRaster(
+    const std::string &filename, size_t nx, size_t ny, double xmin,
+    double ymax, double resolution, int epsg, double nullvalue,
+    const std::string &description, const std::string &units) {
+#ifndef USE_GDAL
+  adcircmodules_throw_exception("GDAL is not enabled.");
+  return nullptr;
+#else
+  const std::string ext = Adcirc::FileIO::Generic::getFileExtension(filename);
+  std::string fmt;
+  if (ext == ".tif") {
+    fmt = "GTiff";
+  } else if (ext == ".img") {
+    fmt = "HFA";
+  } else {
+    adcircmodules_throw_exception("Could not determine the raster format");
+  }
+
+  GDALAllRegister();
+  GDALDriver *driver = GetGDALDriverManager()->GetDriverByName(fmt.c_str());
+  if (driver == nullptr) {
+    adcircmodules_throw_exception("GDAL driver " + fmt + " is not available");
+  }
+
+  char **options = nullptr;
+  if (fmt == "GTiff") {
+    options = CSLSetNameValue(options, "BIGTIFF", "IF_SAFER");
+    options = CSLSetNameValue(options, "TILED", "YES");
+    options = CSLSetNameValue(options, "BLOCKXSIZE", "256");
+    options = CSLSetNameValue(options, "BLOCKYSIZE", "256");
+    options = CSLSetNameValue(options, "COMPRESS", "LZW");
+  } else {
+    options = CSLSetNameValue(options, "COMPRESS", "YES");
+  }
+
+  GDALDataset *raster =
+      driver->Create(filename.c_str(), static_cast<int>(nx),
+                     static_cast<int>(ny), 1, GDT_Float32, options);
+  CSLDestroy(options);
+  if (raster == nullptr) {
+    adcircmodules_throw_exception("Could not create raster " + filename);
+  }
+
+  double transform[6] = {xmin, resolution, 0, ymax, 0, -resolution};
+  raster->SetGeoTransform(transform);
+
+  char *cwkt = nullptr;
+  OGRSpatialReference sref;
+  std::string srefstr = boost::str(boost::format("EPSG:%i") % epsg);
+  sref.SetWellKnownGeogCS(srefstr.c_str());
+  sref.exportToWkt(&cwkt);
+  raster->SetProjection(cwkt);
+  CPLFree(cwkt);
+
+  GDALRasterBand *band = raster->GetRasterBand(1);
+  band->SetDescription(description.c_str());
+  band->SetUnitType(units.c_str());
+  band->SetNoDataValue(nullvalue);
+
+  return raster;
+#endif
+}
@@ -0,0 +1,47 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERFILE_H
+#define ADCMOD_RASTERFILE_H
+
+#include <cstddef>
+#include <string>
+
+class GDALDataset;
+
+namespace Adcirc {
+namespace FileIO {
+
+/**
+ * @brief Creates a single band Float32 raster for mesh output
+ *
+ * The format is selected from the extension (.tif or .img). GeoTIFF output is
+ * tiled in 256x256 blocks and compressed. The returned dataset has its
+ * geotransform, projection, band description, units and nodata value set
+ * and must be closed by the caller with GDALClose.
+ */
+GDALDataset *createRaster(const std::string &filename, size_t nx, size_t ny,
+                          double xmin, double ymax, double resolution,
+                          int epsg, double nullvalue,
+                          const std::string &description,
+                          const std::string &units);
+
+}  // namespace FileIO
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERFILE_H
@@ -0,0 +1,476 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "RasterIntegralTables.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "Constants.h"
+
+using namespace Adcirc::Raster;
+
+RasterIntegralTables::RasterIntegralTables()
+    : m_data(nullptr),
+      m_nx(0),
+      m_ny(0),
+      m_nodata(0.0),
+      m_xmin(0.0),
+      m_ymax(0.0),
+      m_dx(0.0),
+      m_dy(0.0),
+      m_offset(0.0) {}
+
+/**
+ * @brief Builds the summed area tables and maximum pyramid
+ * @param data raster values stored row-major as [ny][nx]. The pointer must
+ * remain valid for the life of the tables
+ * @param nx number of pixels in the x-direction
+ * @param ny number of pixels in the y-direction
+ * @param nodata value used to mark pixels without data
+ * @param xmin left edge of the raster
+ * @param ymax top edge of the raster
+ * @param dx pixel size in the x-direction
+ * @param dy pixel size in the y-direction
+ */
+void RasterIntegralTables::build(const double *data, size_t nx, size_t ny,
+                                 double nodata, double xmin, double ymax,
+                                 double dx, double dy) {
+  assert(data != nullptr);
+  this->m_data = data;
+  this->m_nx = nx;
+  this->m_ny = ny;
+  this->m_nodata = nodata;
+  this->m_xmin = xmin;
+  this->m_ymax = ymax;
+  this->m_dx = dx;
+  this->m_dy = dy;
+  this->buildSums();
+  this->buildPyramid();
+}
+
+/**
+ * @brief Releases the memory held by the tables
+ */
+void RasterIntegralTables::clear() {
+  this->m_data = nullptr;
+  this->m_nx = 0;
+  this->m_ny = 0;
+  this->m_sum = std::vector<double>();
+  this->m_sumSquared = std::vector<double>();
+  this->m_count = std::vector<uint64_t>();
+  this->m_pyramid = std::vector<std::vector<double>>();
+  this->m_pyramidNx = std::vector<size_t>();
+  this->m_pyramidNy = std::vector<size_t>();
+}
+
+/**
+ * @brief Returns true if the tables have been built
+ * @return true if tables are available
+ */
+bool RasterIntegralTables::isBuilt() const { return this->m_data != nullptr; }
+
+/**
+ * @brief Number of pixels in the x-direction
+ * @return number of x pixels
+ */
+size_t RasterIntegralTables::nx() const { return this->m_nx; }
+
+/**
+ * @brief Number of pixels in the y-direction
+ * @return number of y pixels
+ */
+size_t RasterIntegralTables::ny() const { return this->m_ny; }
+
+/**
+ * @brief Computes the running sums in two passes, first along rows and then
+ * down columns
+ *
+ * Values are offset by the raster mean before accumulating so that the
+ * differences taken from the tables do not lose precision on rasters with a
+ * large mean value
+ */
+void RasterIntegralTables::buildSums() {
+  const size_t nx = this->m_nx;
+  const size_t ny = this->m_ny;
+  const size_t stride = nx + 1;
+
+  double total = 0.0;
+  uint64_t ntotal = 0;
+#pragma omp parallel for reduction(+ : total, ntotal) schedule(static)
+  for (size_t j = 0; j < ny; ++j) {
+    const double *row = this->m_data + j * nx;
+    for (size_t i = 0; i < nx; ++i) {
+      if (this->isValid(row[i])) {
+        total += row[i];
+        ntotal++;
+      }
+    }
+  }
+  this->m_offset = ntotal > 0 ? total / static_cast<double>(ntotal) : 0.0;
+
+  this->m_sum.assign(stride * (ny + 1), 0.0);
+  this->m_sumSquared.assign(stride * (ny + 1), 0.0);
+  this->m_count.assign(stride * (ny + 1), 0);
+
+#pragma omp parallel for schedule(static)
+  for (size_t j = 0; j < ny; ++j) {
+    const double *row = this->m_data + j * nx;
+    const size_t base = (j + 1) * stride;
+    double s = 0.0;
+    double s2 = 0.0;
+    uint64_t c = 0;
+    for (size_t i = 0; i < nx; ++i) {
+      if (this->isValid(row[i])) {
+        const double z = row[i] - this->m_offset;
+        s += z;
+        s2 += z * z;
+        c++;
+      }
+      this->m_sum[base + i + 1] = s;
+      this->m_sumSquared[base + i + 1] = s2;
+      this->m_count[base + i + 1] = c;
+    }
+  }
+
+  constexpr size_t blockSize = 512;
+  const size_t nblocks = (stride + blockSize - 1) / blockSize;
+#pragma omp parallel for schedule(static)
+  for (size_t b = 0; b < nblocks; ++b) {
+    const size_t i0 = b * blockSize;
+    const size_t i1 = std::min(stride, i0 + blockSize);
+    for (size_t j = 2; j <= ny; ++j) {
+      const size_t above = (j - 1) * stride;
+      const size_t here = j * stride;
+      for (size_t i = i0; i < i1; ++i) {
+        this->m_sum[here + i] += this->m_sum[above + i];
+        this->m_sumSquared[here + i] += this->m_sumSquared[above + i];
+        this->m_count[here + i] += this->m_count[above + i];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Builds the maximum pyramid where each level holds the maximum of a
+ * 2x2 block of the level below it. Level zero is the raster itself.
+ */
+void RasterIntegralTables::buildPyramid() {
+  this->m_pyramid.clear();
+  this->m_pyramidNx.clear();
+  this->m_pyramidNy.clear();
+
+  this->m_pyramid.emplace_back();
+  this->m_pyramidNx.push_back(this->m_nx);
+  this->m_pyramidNy.push_back(this->m_ny);
+
+  while (this->m_pyramidNx.back() > 1 || this->m_pyramidNy.back() > 1) {
+    const size_t level = this->m_pyramid.size();
+    const size_t fnx = this->m_pyramidNx.back();
+    const size_t fny = this->m_pyramidNy.back();
+    const size_t cnx = (fnx + 1) / 2;
+    const size_t cny = (fny + 1) / 2;
+    std::vector<double> coarse(cnx * cny, noValue());
+    const std::vector<double> &fine = this->m_pyramid.back();
+
+#pragma omp parallel for schedule(static)
+    for (size_t cj = 0; cj < cny; ++cj) {
+      for (size_t ci = 0; ci < cnx; ++ci) {
+        double zmax = noValue();
+        for (size_t fj = 2 * cj; fj < std::min(2 * cj + 2, fny); ++fj) {
+          for (size_t fi = 2 * ci; fi < std::min(2 * ci + 2, fnx); ++fi) {
+            double z;
+            if (level == 1) {
+              z = this->m_data[fj * fnx + fi];
+              if (!this->isValid(z)) continue;
+            } else {
+              z = fine[fj * fnx + fi];
+            }
+            zmax = std::max(zmax, z);
+          }
+        }
+        coarse[cj * cnx + ci] = zmax;
+      }
+    }
+
+    this->m_pyramid.push_back(std::move(coarse));
+    this->m_pyramidNx.push_back(cnx);
+    this->m_pyramidNy.push_back(cny);
+  }
+}
+
+double RasterIntegralTables::xcenter(size_t i) const {
+  return i * this->m_dx + this->m_xmin + 0.50 * this->m_dx;
+}
+
+double RasterIntegralTables::ycenter(size_t j) const {
+  return this->m_ymax - (j + 1) * this->m_dy + 0.50 * this->m_dy;
+}
+
+/**
+ * @brief Tests if the center of a pixel falls within the search radius using
+ * the same distance calculation as the pixel by pixel search
+ */
+bool RasterIntegralTables::inside(const Window &w, size_t i, size_t j) const {
+  return !(Adcirc::Constants::distance(w.x, w.y, this->xcenter(i),
+                                       this->ycenter(j)) > w.radius);
+}
+
+/**
+ * @brief Accumulates the centered sums for an inclusive pixel box
+ */
+void RasterIntegralTables::addBox(size_t ibegin, size_t jbegin, size_t iend,
+                                  size_t jend, Sums &s) const {
+  const size_t stride = this->m_nx + 1;
+  const size_t a = jbegin * stride + ibegin;
+  const size_t b = jbegin * stride + iend + 1;
+  const size_t c = (jend + 1) * stride + ibegin;
+  const size_t d = (jend + 1) * stride + iend + 1;
+  s.sum += this->m_sum[d] - this->m_sum[b] - this->m_sum[c] + this->m_sum[a];
+  s.sumSquared += this->m_sumSquared[d] - this->m_sumSquared[b] -
+                  this->m_sumSquared[c] + this->m_sumSquared[a];
+  s.count += this->m_count[d] - this->m_count[b] - this->m_count[c] +
+             this->m_count[a];
+}
+
+RasterIntegralTables::Statistics RasterIntegralTables::toStatistics(
+    const Sums &s) const {
+  Statistics stats;
+  stats.count = s.count;
+  if (s.count > 0) {
+    const double n = static_cast<double>(s.count);
+    const double m = s.sum / n;
+    stats.mean = this->m_offset + m;
+    stats.variance = std::max(0.0, s.sumSquared / n - m * m);
+  }
+  return stats;
+}
+
+/**
+ * @brief Summarizes the valid pixels within an inclusive pixel box
+ * @param ibegin beginning i-index
+ * @param jbegin beginning j-index
+ * @param iend ending i-index
+ * @param jend ending j-index
+ * @return statistics for the box
+ */
+RasterIntegralTables::Statistics RasterIntegralTables::boxStatistics(
+    size_t ibegin, size_t jbegin, size_t iend, size_t jend) const {
+  assert(this->isBuilt());
+  assert(iend < this->m_nx && jend < this->m_ny);
+  Sums s;
+  if (ibegin <= iend && jbegin <= jend) {
+    this->addBox(ibegin, jbegin, iend, jend, s);
+  }
+  return this->toStatistics(s);
+}
+
+/**
+ * @brief Finds the span of pixels inside the circle for each raster row
+ * @param w query window
+ * @param spans vector to fill with the row spans, ordered by row
+ * @return number of spans found
+ */
+size_t RasterIntegralTables::findSpans(const Window &w,
+                                       std::vector<Span> &spans) const {
+  spans.clear();
+  const auto ib = static_cast<long long>(w.ibegin);
+  const auto ie = static_cast<long long>(w.iend);
+  for (size_t j = w.jbegin; j <= w.jend; ++j) {
+    const double ddy = this->ycenter(j) - w.y;
+    if (std::abs(ddy) > w.radius) continue;
+    const double half = std::sqrt(w.radius * w.radius - ddy * ddy);
+    const double lo = (w.x - half - this->m_xmin) / this->m_dx - 0.5;
+    const double hi = (w.x + half - this->m_xmin) / this->m_dx - 0.5;
+
+    //...The analytic chord is only a first guess. The ends are moved using
+    // the exact pixel test so that rounding cannot change the result
+    long long i0 = std::max(ib, static_cast<long long>(std::ceil(lo)));
+    long long i1 = std::min(ie, static_cast<long long>(std::floor(hi)));
+    i0 = std::min(i0, ie + 1);
+    i1 = std::max(i1, ib - 1);
+    while (i0 <= ie && i0 <= i1 && !this->inside(w, i0, j)) ++i0;
+    while (i0 > ib && this->inside(w, i0 - 1, j)) --i0;
+    if (i1 < i0 - 1) i1 = i0 - 1;
+    while (i1 >= i0 && !this->inside(w, i1, j)) --i1;
+    while (i1 < ie && this->inside(w, i1 + 1, j)) ++i1;
+
+    if (i0 <= i1) {
+      spans.push_back({j, static_cast<size_t>(i0), static_cast<size_t>(i1)});
+    }
+  }
+  return spans.size();
+}
+
+/**
+ * @brief Summarizes the valid pixels within a circular window
+ * @param w query window
+ * @return statistics for the window
+ *
+ * The rows near the center of the circle share a common box which is summed
+ * with a single lookup. The remaining pixels are added one row span at a time
+ * so the cost grows with the window diameter instead of its area.
+ */
+RasterIntegralTables::Statistics RasterIntegralTables::windowStatistics(
+    const Window &w) const {
+  assert(this->isBuilt());
+  std::vector<Span> spans;
+  this->findSpans(w, spans);
+
+  const double coreHalfHeight = w.radius * std::sqrt(0.5);
+  size_t first = spans.size();
+  size_t last = 0;
+  size_t ci0 = 0;
+  size_t ci1 = std::numeric_limits<size_t>::max();
+  for (size_t k = 0; k < spans.size(); ++k) {
+    if (std::abs(this->ycenter(spans[k].j) - w.y) <= coreHalfHeight) {
+      first = std::min(first, k);
+      last = k;
+      ci0 = std::max(ci0, spans[k].ibegin);
+      ci1 = std::min(ci1, spans[k].iend);
+    }
+  }
+
+  bool useCore = first < spans.size() && ci0 <= ci1 &&
+                 spans[last].j - spans[first].j == last - first;
+
+  Sums s;
+  if (useCore) {
+    this->addBox(ci0, spans[first].j, ci1, spans[last].j, s);
+  }
+  for (size_t k = 0; k < spans.size(); ++k) {
+    const auto &sp = spans[k];
+    if (useCore && k >= first && k <= last) {
+      if (sp.ibegin < ci0) this->addBox(sp.ibegin, sp.j, ci0 - 1, sp.j, s);
+      if (sp.iend > ci1) this->addBox(ci1 + 1, sp.j, sp.iend, sp.j, s);
+    } else {
+      this->addBox(sp.ibegin, sp.j, sp.iend, sp.j, s);
+    }
+  }
+  return this->toStatistics(s);
+}
+
+/**
+ * @brief Computes the average of the valid pixels in the window that are at
+ * or above a cutoff value
+ * @param w query window
+ * @param cutoff lowest value to include in the average
+ * @param n number of pixels included in the average
+ * @return average value, or noValue() if no pixels were found
+ *
+ * This cannot be answered from the tables since the cutoff is not known until
+ * the window statistics are computed, so the raster is scanned directly one
+ * row span at a time.
+ */
+double RasterIntegralTables::windowAverageAbove(const Window &w, double cutoff,
+                                                size_t &n) const {
+  assert(this->isBuilt());
+  std::vector<Span> spans;
+  this->findSpans(w, spans);
+  double a = 0.0;
+  n = 0;
+  for (const auto &sp : spans) {
+    const double *row = this->m_data + sp.j * this->m_nx;
+    for (size_t i = sp.ibegin; i <= sp.iend; ++i) {
+      if (this->isValid(row[i]) && row[i] >= cutoff) {
+        a += row[i];
+        n++;
+      }
+    }
+  }
+  return n > 0 ? a / static_cast<double>(n) : noValue();
+}
+
+/**
+ * @brief Computes the maximum valid value within a circular window
+ * @param w query window
+ * @return maximum value, or noValue() if there are no valid pixels
+ */
+double RasterIntegralTables::windowMaximum(const Window &w) const {
+  assert(this->isBuilt());
+  if (w.iend < w.ibegin || w.jend < w.jbegin) return noValue();
+
+  //...Start from the coarsest level where the window spans only a few blocks
+  const size_t extent =
+      std::max(w.iend - w.ibegin + 1, w.jend - w.jbegin + 1);
+  size_t level = 0;
+  while (level + 1 < this->m_pyramid.size() &&
+         (static_cast<size_t>(1) << (level + 1)) <= extent) {
+    level++;
+  }
+
+  double zmax = noValue();
+  for (size_t bj = w.jbegin >> level; bj <= (w.jend >> level); ++bj) {
+    for (size_t bi = w.ibegin >> level; bi <= (w.iend >> level); ++bi) {
+      zmax = std::max(zmax, this->blockMaximum(w, level, bi, bj));
+    }
+  }
+  return zmax;
+}
+
+/**
+ * @brief Recursively finds the maximum value of a pyramid block within the
+ * window, using the stored block maximum when the block is completely inside
+ */
+double RasterIntegralTables::blockMaximum(const Window &w, size_t level,
+                                          size_t bi, size_t bj) const {
+  const size_t i0 = std::max(bi << level, w.ibegin);
+  const size_t i1 = std::min(((bi + 1) << level) - 1, w.iend);
+  const size_t j0 = std::max(bj << level, w.jbegin);
+  const size_t j1 = std::min(((bj + 1) << level) - 1, w.jend);
+  if (i0 > i1 || j0 > j1) return noValue();
+
+  if (level == 0) {
+    const double z = this->m_data[bj * this->m_nx + bi];
+    return this->isValid(z) && this->inside(w, bi, bj) ? z : noValue();
+  }
+
+  const double xlo = this->xcenter(i0);
+  const double xhi = this->xcenter(i1);
+  const double yhi = this->ycenter(j0);
+  const double ylo = this->ycenter(j1);
+  const double xnear = std::min(std::max(w.x, xlo), xhi);
+  const double ynear = std::min(std::max(w.y, ylo), yhi);
+  if (Adcirc::Constants::distance(w.x, w.y, xnear, ynear) > w.radius) {
+    return noValue();
+  }
+
+  const bool wholeBlock = i0 == (bi << level) && j0 == (bj << level) &&
+                          i1 == std::min(((bi + 1) << level) - 1,
+                                         this->m_nx - 1) &&
+                          j1 == std::min(((bj + 1) << level) - 1,
+                                         this->m_ny - 1);
+  if (wholeBlock) {
+    const double xfar = std::abs(w.x - xlo) > std::abs(w.x - xhi) ? xlo : xhi;
+    const double yfar = std::abs(w.y - ylo) > std::abs(w.y - yhi) ? ylo : yhi;
+    if (!(Adcirc::Constants::distance(w.x, w.y, xfar, yfar) > w.radius)) {
+      return this->m_pyramid[level][bj * this->m_pyramidNx[level] + bi];
+    }
+  }
+
+  double zmax = noValue();
+  const size_t cjend = std::min(2 * bj + 2, this->m_pyramidNy[level - 1]);
+  const size_t ciend = std::min(2 * bi + 2, this->m_pyramidNx[level - 1]);
+  for (size_t cj = 2 * bj; cj < cjend; ++cj) {
+    for (size_t ci = 2 * bi; ci < ciend; ++ci) {
+      zmax = std::max(zmax, this->blockMaximum(w, level - 1, ci, cj));
+    }
+  }
+  return zmax;
+}
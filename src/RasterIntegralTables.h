@@ -0,0 +1,149 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERINTEGRALTABLES_H
+#define ADCMOD_RASTERINTEGRALTABLES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Adcirc {
+namespace Raster {
+
+/**
+ * @class RasterIntegralTables
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Summed area tables and a maximum pyramid built over an in-memory
+ * raster so that window statistics do not need to visit every pixel
+ *
+ * The tables hold the running sum, sum of squares and number of valid pixels
+ * so that any axis aligned box can be summarized with four lookups. Circular
+ * windows are answered as the largest box that fits inside the circle plus
+ * one span per raster row for the rim. Maximum values are found by descending
+ * a 2x2 maximum pyramid, using whole blocks that fall inside the window.
+ *
+ * The pixel values themselves are not copied. The tables keep a pointer to
+ * the raster data owned by the Rasterdata object and must be cleared when that
+ * data is released.
+ */
+class RasterIntegralTables {
+ public:
+  /**
+   * @brief Summary of the valid pixels found inside a window
+   */
+  struct Statistics {
+    size_t count = 0;
+    double mean = 0.0;
+    double variance = 0.0;
+  };
+
+  /**
+   * @brief Circular query window clipped to an inclusive pixel index box
+   */
+  struct Window {
+    double x;
+    double y;
+    double radius;
+    size_t ibegin;
+    size_t jbegin;
+    size_t iend;
+    size_t jend;
+  };
+
+  RasterIntegralTables();
+
+  void build(const double *data, size_t nx, size_t ny, double nodata,
+             double xmin, double ymax, double dx, double dy);
+  void clear();
+
+  bool isBuilt() const;
+
+  size_t nx() const;
+  size_t ny() const;
+
+  Statistics boxStatistics(size_t ibegin, size_t jbegin, size_t iend,
+                           size_t jend) const;
+
+  Statistics windowStatistics(const Window &w) const;
+
+  double windowMaximum(const Window &w) const;
+
+  double windowAverageAbove(const Window &w, double cutoff, size_t &n) const;
+
+  static constexpr double noValue() {
+    return -std::numeric_limits<double>::max();
+  }
+
+ private:
+  struct Span {
+    size_t j;
+    size_t ibegin;
+    size_t iend;
+  };
+
+  struct Sums {
+    uint64_t count = 0;
+    double sum = 0.0;
+    double sumSquared = 0.0;
+  };
+
+  void buildSums();
+  void buildPyramid();
+
+  void addBox(size_t ibegin, size_t jbegin, size_t iend, size_t jend,
+              Sums &s) const;
+  Statistics toStatistics(const Sums &s) const;
+
+  size_t findSpans(const Window &w, std::vector<Span> &spans) const;
+  bool inside(const Window &w, size_t i, size_t j) const;
+
+  double xcenter(size_t i) const;
+  double ycenter(size_t j) const;
+
+  double blockMaximum(const Window &w, size_t level, size_t bi,
+                      size_t bj) const;
+
+  bool isValid(double z) const { return z != m_nodata; }
+
+  const double *m_data;
+  size_t m_nx;
+  size_t m_ny;
+  double m_nodata;
+  double m_xmin;
+  double m_ymax;
+  double m_dx;
+  double m_dy;
+  double m_offset;
+
+  std::vector<double> m_sum;
+  std::vector<double> m_sumSquared;
+  std::vector<uint64_t> m_count;
+
+  std::vector<std::vector<double>> m_pyramid;
+  std::vector<size_t> m_pyramidNx;
+  std::vector<size_t> m_pyramidNy;
+};
+
+}  // namespace Raster
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERINTEGRALTABLES_H
@@ -0,0 +1,177 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "RasterMosaic.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <numeric>
+
+#include "Logging.h"
+
+using namespace Adcirc::Raster;
+
+namespace bgi = boost::geometry::index;
+
+/**
+ * @brief Adds a raster to the mosaic
+ * @param filename name of the raster file
+ * @param priority priority of the raster. Higher values are used first
+ */
+void RasterMosaic::addRaster(const std::string &filename, int priority) {
+  this->m_rasters.push_back(std::make_unique<Rasterdata>(filename));
+  this->m_priority.push_back(priority);
+  this->m_index.clear();
+}
+
+/**
+ * @brief Number of rasters in the mosaic
+ * @return number of rasters
+ */
+size_t RasterMosaic::size() const { return this->m_rasters.size(); }
+
+/**
+ * @brief Returns a raster in the mosaic
+ * @param index raster index, in the order added
+ * @return pointer to raster
+ */
+Rasterdata *RasterMosaic::raster(size_t index) {
+  assert(index < this->m_rasters.size());
+  return this->m_rasters[index].get();
+}
+
+/**
+ * @brief Returns a raster in the mosaic
+ * @param index raster index, in the order added
+ * @return pointer to raster
+ */
+const Rasterdata *RasterMosaic::raster(size_t index) const {
+  assert(index < this->m_rasters.size());
+  return this->m_rasters[index].get();
+}
+
+/**
+ * @brief Returns the priority of a raster in the mosaic
+ * @param index raster index, in the order added
+ * @return priority
+ */
+int RasterMosaic::priority(size_t index) const {
+  assert(index < this->m_priority.size());
+  return this->m_priority[index];
+}
+
+/**
+ * @brief Opens all rasters in the mosaic and generates the spatial index of
+ * their extents
+ * @return true if all rasters were opened
+ */
+bool RasterMosaic::open() {
+  std::vector<value_t> boxes;
+  boxes.reserve(this->m_rasters.size());
+  for (size_t i = 0; i < this->m_rasters.size(); ++i) {
+    auto &r = this->m_rasters[i];
+    if (!r->isOpen()) {
+      if (!r->open()) {
+        Adcirc::Logging::logError("Could not open raster " + r->filename());
+        return false;
+      }
+    }
+    boxes.emplace_back(box_t(point_t(r->xmin(), r->ymin() - r->dy()),
+                             point_t(r->xmax() + r->dx(), r->ymax())),
+                       i);
+  }
+
+  //...The packing constructor generates a better balanced tree than
+  // inserting the boxes one at a time
+  this->m_index = decltype(this->m_index)(boxes.begin(), boxes.end());
+
+  this->m_rank.resize(this->m_rasters.size());
+  std::iota(this->m_rank.begin(), this->m_rank.end(), 0);
+  std::stable_sort(this->m_rank.begin(), this->m_rank.end(),
+                   [&](size_t a, size_t b) {
+                     return this->m_priority[a] > this->m_priority[b];
+                   });
+  return true;
+}
+
+/**
+ * @brief Returns true if the rasters have been opened and indexed
+ * @return true if the mosaic is open
+ */
+bool RasterMosaic::isOpen() const {
+  return !this->m_rasters.empty() &&
+         this->m_index.size() == this->m_rasters.size();
+}
+
+/**
+ * @brief Returns the raster with the highest priority
+ * @return index of the raster with the highest priority
+ */
+size_t RasterMosaic::primary() const {
+  return this->m_rank.empty() ? 0 : this->m_rank.front();
+}
+
+/**
+ * @brief Finds the rasters with extents that overlap a search box
+ * @param x x-location
+ * @param y y-location
+ * @param radius half the side of the search box
+ * @return indices of the rasters ordered from highest to lowest priority
+ */
+std::vector<size_t> RasterMosaic::candidates(double x, double y,
+                                             double radius) const {
+  std::vector<value_t> hits;
+  this->m_index.query(
+      bgi::intersects(box_t(point_t(x - radius, y - radius),
+                            point_t(x + radius, y + radius))),
+      std::back_inserter(hits));
+
+  std::vector<size_t> result;
+  result.reserve(hits.size());
+  for (const auto &h : hits) {
+    result.push_back(h.second);
+  }
+  std::sort(result.begin(), result.end(), [&](size_t a, size_t b) {
+    if (this->m_priority[a] != this->m_priority[b]) {
+      return this->m_priority[a] > this->m_priority[b];
+    }
+    return a < b;
+  });
+  return result;
+}
+
+/**
+ * @brief Gets the combined extents of all rasters as xmin,ymin,xmax,ymax
+ * @return vector of extents
+ */
+std::vector<double> RasterMosaic::extents() const {
+  if (this->m_rasters.empty()) return std::vector<double>(4);
+  std::vector<double> e{std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::max(),
+                        -std::numeric_limits<double>::max(),
+                        -std::numeric_limits<double>::max()};
+  for (const auto &r : this->m_rasters) {
+    e[0] = std::min(e[0], r->xmin());
+    e[1] = std::min(e[1], r->ymin());
+    e[2] = std::max(e[2], r->xmax());
+    e[3] = std::max(e[3], r->ymax());
+  }
+  return e;
+}
@@ -0,0 +1,85 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERMOSAIC_H
+#define ADCMOD_RASTERMOSAIC_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RasterData.h"
+#include "boost/geometry.hpp"
+#include "boost/geometry/index/rtree.hpp"
+
+namespace Adcirc {
+namespace Raster {
+
+/**
+ * @class RasterMosaic
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Collection of overlapping rasters with a priority order
+ *
+ * The extents of each raster are placed in an r-tree so that the rasters
+ * covering a query location can be found without testing every tile. The
+ * rasters covering a location are returned from highest to lowest priority.
+ * Rasters with equal priority are ordered as they were added.
+ */
+class RasterMosaic {
+ public:
+  RasterMosaic() = default;
+
+  void addRaster(const std::string &filename, int priority);
+
+  size_t size() const;
+
+  Rasterdata *raster(size_t index);
+  const Rasterdata *raster(size_t index) const;
+
+  int priority(size_t index) const;
+
+  bool open();
+  bool isOpen() const;
+
+  size_t primary() const;
+
+  std::vector<size_t> candidates(double x, double y, double radius) const;
+
+  std::vector<double> extents() const;
+
+ private:
+  typedef boost::geometry::model::point<double, 2,
+                                        boost::geometry::cs::cartesian>
+      point_t;
+  typedef boost::geometry::model::box<point_t> box_t;
+  typedef std::pair<box_t, size_t> value_t;
+
+  std::vector<std::unique_ptr<Rasterdata>> m_rasters;
+  std::vector<int> m_priority;
+  std::vector<size_t> m_rank;
+  boost::geometry::index::rtree<value_t, boost::geometry::index::quadratic<16>>
+      m_index;
+};
+
+}  // namespace Raster
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERMOSAIC_H
@@ -0,0 +1,596 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "RasterizationPlan.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "DefaultValues.h"
+#include "FileIO.h"
+#include "Logging.h"
+#include "RasterFile.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USE_GDAL
+#include "gdal_priv.h"
+#endif
+
+using namespace Adcirc::Utility;
+using namespace Adcirc::Geometry;
+
+namespace {
+
+constexpr char c_planMagic[8] = {'A', 'D', 'C', 'R', 'P', 'L', 'A', 'N'};
+constexpr uint32_t c_planVersion = 1;
+
+struct PlanEntry {
+  uint64_t pixel;
+  uint32_t node[3];
+  float weight[3];
+};
+
+template <typename T>
+void writeBinary(std::ofstream &f, const T &v) {
+  f.write(reinterpret_cast<const char *>(&v), sizeof(T));
+}
+
+template <typename T>
+void writeBinary(std::ofstream &f, const std::vector<T> &v) {
+  f.write(reinterpret_cast<const char *>(v.data()), v.size() * sizeof(T));
+}
+
+template <typename T>
+void readBinary(std::ifstream &f, T &v) {
+  f.read(reinterpret_cast<char *>(&v), sizeof(T));
+}
+
+template <typename T>
+void readBinary(std::ifstream &f, std::vector<T> &v, size_t n) {
+  v.resize(n);
+  f.read(reinterpret_cast<char *>(v.data()), n * sizeof(T));
+}
+
+}  // namespace
+
+/**
+ * @brief Default constructor. The plan must be built or loaded before use
+ */
+RasterizationPlan::RasterizationPlan()
+    : m_nx(0),
+      m_ny(0),
+      m_xmin(0.0),
+      m_ymax(0.0),
+      m_resolution(0.0),
+      m_epsg(0),
+      m_numMeshNodes(0) {}
+
+/**
+ * @brief Constructor that builds the plan
+ * @param[in] mesh mesh to rasterize
+ * @param[in] extent x1,y1,x2,y2 of the raster
+ * @param[in] resolution horizontal resolution of the raster
+ */
+RasterizationPlan::RasterizationPlan(Mesh *mesh,
+                                     const std::vector<double> &extent,
+                                     double resolution)
+    : RasterizationPlan() {
+  this->build(mesh, extent, resolution);
+}
+
+/**
+ * @brief Locates the mesh element containing each raster pixel and stores the
+ * interpolation weights of the pixels that fall inside the mesh
+ * @param[in] mesh mesh to rasterize
+ * @param[in] extent x1,y1,x2,y2 of the raster
+ * @param[in] resolution horizontal resolution of the raster
+ */
+void RasterizationPlan::build(Mesh *mesh, const std::vector<double> &extent,
+                              double resolution) {
+  if (mesh == nullptr || mesh->numNodes() == 0) {
+    adcircmodules_throw_exception("RasterizationPlan: No mesh defined");
+  }
+  if (extent.size() < 4) {
+    adcircmodules_throw_exception("RasterizationPlan: Invalid extent");
+  }
+  if (resolution <= 0.0) {
+    adcircmodules_throw_exception("Invalid resolution specified.");
+  }
+  if (mesh->numNodes() >= std::numeric_limits<uint32_t>::max()) {
+    adcircmodules_throw_exception("RasterizationPlan: Mesh is too large");
+  }
+
+  this->clear();
+
+  const double xmin = std::min(extent[0], extent[2]);
+  const double xmax = std::max(extent[0], extent[2]);
+  const double ymin = std::min(extent[1], extent[3]);
+  const double ymax = std::max(extent[1], extent[3]);
+  const size_t nx =
+      static_cast<size_t>(std::floor((xmax - xmin) / resolution)) + 1;
+  const size_t ny =
+      static_cast<size_t>(std::floor((ymax - ymin) / resolution)) + 1;
+
+  if (nx < 3 || ny < 3) {
+    adcircmodules_throw_exception("Invalid resolution specified.");
+  }
+
+  if (!mesh->elementalSearchTreeInitialized()) {
+    mesh->buildElementalSearchTree();
+  }
+
+  const Node *base = mesh->node(0);
+
+  //...Rows are searched in parallel and then concatenated in order so that
+  // the pixel list is sorted regardless of the number of threads
+  std::vector<std::vector<PlanEntry>> rows(ny);
+
+#pragma omp parallel
+  {
+    std::vector<double> w(3);
+
+#pragma omp for schedule(dynamic)
+    for (size_t j = 0; j < ny; ++j) {
+      const double y = ymax - (j + 1) * resolution + 0.5 * resolution;
+      for (size_t i = 0; i < nx; ++i) {
+        const double x = i * resolution + xmin + 0.5 * resolution;
+        const size_t e = mesh->findElement(x, y, w);
+        if (e == adcircmodules_default_value<size_t>()) continue;
+        const Element *el = mesh->element(e);
+        PlanEntry p;
+        p.pixel = j * nx + i;
+        for (size_t k = 0; k < 3; ++k) {
+          p.node[k] = static_cast<uint32_t>(el->node(k) - base);
+          p.weight[k] = static_cast<float>(w[k]);
+        }
+        rows[j].push_back(p);
+      }
+    }
+  }
+
+  size_t n = 0;
+  for (const auto &r : rows) {
+    n += r.size();
+  }
+
+  this->m_pixel.reserve(n);
+  this->m_node1.reserve(n);
+  this->m_node2.reserve(n);
+  this->m_node3.reserve(n);
+  this->m_weight1.reserve(n);
+  this->m_weight2.reserve(n);
+  this->m_weight3.reserve(n);
+
+  for (auto &r : rows) {
+    for (const auto &p : r) {
+      this->m_pixel.push_back(p.pixel);
+      this->m_node1.push_back(p.node[0]);
+      this->m_node2.push_back(p.node[1]);
+      this->m_node3.push_back(p.node[2]);
+      this->m_weight1.push_back(p.weight[0]);
+      this->m_weight2.push_back(p.weight[1]);
+      this->m_weight3.push_back(p.weight[2]);
+    }
+    std::vector<PlanEntry>().swap(r);
+  }
+
+  this->m_nx = nx;
+  this->m_ny = ny;
+  this->m_xmin = xmin;
+  this->m_ymax = ymax;
+  this->m_resolution = resolution;
+  this->m_epsg = mesh->projection();
+  this->m_numMeshNodes = mesh->numNodes();
+}
+
+/**
+ * @brief Releases the plan
+ */
+void RasterizationPlan::clear() {
+  this->m_nx = 0;
+  this->m_ny = 0;
+  this->m_xmin = 0.0;
+  this->m_ymax = 0.0;
+  this->m_resolution = 0.0;
+  this->m_epsg = 0;
+  this->m_numMeshNodes = 0;
+  this->m_pixel.clear();
+  this->m_node1.clear();
+  this->m_node2.clear();
+  this->m_node3.clear();
+  this->m_weight1.clear();
+  this->m_weight2.clear();
+  this->m_weight3.clear();
+}
+
+/**
+ * @brief Returns true if the plan has been built or loaded
+ * @return true if the plan can be applied
+ */
+bool RasterizationPlan::isBuilt() const { return this->m_nx > 0; }
+
+/**
+ * @brief Number of raster columns
+ * @return number of columns
+ */
+size_t RasterizationPlan::nx() const { return this->m_nx; }
+
+/**
+ * @brief Number of raster rows
+ * @return number of rows
+ */
+size_t RasterizationPlan::ny() const { return this->m_ny; }
+
+/**
+ * @brief Left edge of the raster
+ * @return minimum x
+ */
+double RasterizationPlan::xmin() const { return this->m_xmin; }
+
+/**
+ * @brief Top edge of the raster
+ * @return maximum y
+ */
+double RasterizationPlan::ymax() const { return this->m_ymax; }
+
+/**
+ * @brief Pixel size of the raster
+ * @return resolution
+ */
+double RasterizationPlan::resolution() const { return this->m_resolution; }
+
+/**
+ * @brief Coordinate system of the mesh used to build the plan
+ * @return epsg code
+ */
+int RasterizationPlan::epsg() const { return this->m_epsg; }
+
+/**
+ * @brief Number of nodes in the mesh used to build the plan
+ * @return number of nodes
+ */
+size_t RasterizationPlan::numMeshNodes() const { return this->m_numMeshNodes; }
+
+/**
+ * @brief Number of raster pixels that fall inside the mesh
+ * @return number of active pixels
+ */
+size_t RasterizationPlan::numActivePixels() const {
+  return this->m_pixel.size();
+}
+
+/**
+ * @brief Interpolates nodal values onto the raster
+ * @param[in] z nodal values, one per mesh node
+ * @param[in] nullvalue value used for dry pixels and pixels outside the mesh
+ * @param[in] partialWetting compute values for partially wet elements from
+ * the wet nodes only
+ * @return raster values in row-major order, nx * ny
+ */
+std::vector<float> RasterizationPlan::apply(const std::vector<double> &z,
+                                            double nullvalue,
+                                            bool partialWetting) const {
+  if (z.size() != this->m_numMeshNodes) {
+    adcircmodules_throw_exception(
+        "RasterizationPlan: Number of values does not match the mesh");
+  }
+  std::vector<float> output(this->m_nx * this->m_ny);
+  this->apply(z.data(), output.data(), nullvalue, partialWetting);
+  return output;
+}
+
+/**
+ * @brief Interpolates nodal values onto the raster
+ * @param[in] z nodal values, one per mesh node
+ * @param[out] output raster values in row-major order. Must hold nx * ny
+ * values
+ * @param[in] nullvalue value used for dry pixels and pixels outside the mesh
+ * @param[in] partialWetting compute values for partially wet elements from
+ * the wet nodes only
+ */
+void RasterizationPlan::apply(const double *z, float *output, double nullvalue,
+                              bool partialWetting) const {
+  if (!this->isBuilt()) {
+    adcircmodules_throw_exception("RasterizationPlan: Plan has not been built");
+  }
+  std::fill(output, output + this->m_nx * this->m_ny,
+            static_cast<float>(nullvalue));
+  this->applyRange(z, 0, this->m_pixel.size(), 0, output, nullvalue,
+                   partialWetting);
+}
+
+/**
+ * @brief Interpolates nodal values for a contiguous range of active pixels
+ * @param[in] z nodal values
+ * @param[in] begin first active pixel
+ * @param[in] end one past the last active pixel
+ * @param[in] offset linear raster index corresponding to output[0]
+ * @param[out] output raster values
+ * @param[in] nullvalue value used for dry pixels
+ * @param[in] partialWetting compute values for partially wet elements
+ *
+ * The result matches Mesh::toRaster. Without partial wetting a pixel is null
+ * if any of its nodes equals the null value. With partial wetting nodes that
+ * equal the null value or the default (dry) value are dropped and the
+ * remaining weights are renormalized. A pixel with one wet node takes that
+ * node's value. Dry nodes are masked out of the weighted sum instead of being
+ * tested in branches so that the loop vectorizes as a gather, multiply and
+ * add. The weights are stored in single precision, so the values can differ
+ * from Mesh::toRaster in the last bits of a float.
+ */
+void RasterizationPlan::applyRange(const double *z, const size_t begin,
+                                   const size_t end, const uint64_t offset,
+                                   float *output, const double nullvalue,
+                                   const bool partialWetting) const {
+  const double dryValue = partialWetting ? adcircmodules_default_value<double>()
+                                         : nullvalue;
+  const uint64_t *pixel = this->m_pixel.data();
+  const uint32_t *n1 = this->m_node1.data();
+  const uint32_t *n2 = this->m_node2.data();
+  const uint32_t *n3 = this->m_node3.data();
+  const float *w1 = this->m_weight1.data();
+  const float *w2 = this->m_weight2.data();
+  const float *w3 = this->m_weight3.data();
+
+#pragma omp parallel for simd schedule(static)
+  for (size_t k = begin; k < end; ++k) {
+    const double v1 = z[n1[k]];
+    const double v2 = z[n2[k]];
+    const double v3 = z[n3[k]];
+    const bool b1 = v1 == nullvalue || v1 == dryValue;
+    const bool b2 = v2 == nullvalue || v2 == dryValue;
+    const bool b3 = v3 == nullvalue || v3 == dryValue;
+    const int numWet = (b1 ? 0 : 1) + (b2 ? 0 : 1) + (b3 ? 0 : 1);
+    const double a1 = b1 ? 0.0 : static_cast<double>(w1[k]);
+    const double a2 = b2 ? 0.0 : static_cast<double>(w2[k]);
+    const double a3 = b3 ? 0.0 : static_cast<double>(w3[k]);
+    const double weight = a1 + a2 + a3;
+    const double f = numWet == 3 || weight == 0.0 ? 1.0 : 1.0 / weight;
+    const double c1 = b1 ? 0.0 : v1;
+    const double c2 = b2 ? 0.0 : v2;
+    const double c3 = b3 ? 0.0 : v3;
+    const double value = numWet == 1 ? c1 + c2 + c3
+                                     : a1 * f * c1 + a2 * f * c2 + a3 * f * c3;
+    const bool valid = partialWetting
+                           ? numWet == 3 || numWet == 1 ||
+                                 (numWet == 2 && weight > 0.0)
+                           : numWet == 3;
+    output[pixel[k] - offset] = valid ? static_cast<float>(value)
+                                      : static_cast<float>(nullvalue);
+  }
+}
+
+/**
+ * @brief Interpolates nodal values onto the raster and writes it using gdal
+ * @param[in] filename name of the output raster (.tif or .img)
+ * @param[in] z nodal values, one per mesh node
+ * @param[in] nullvalue value used for dry pixels and pixels outside the mesh
+ * @param[in] description description of the data
+ * @param[in] units data units
+ * @param[in] partialWetting compute values for partially wet elements
+ *
+ * The raster is written in strips of rows so that only one strip is held in
+ * memory at a time.
+ */
+void RasterizationPlan::toRaster(const std::string &filename,
+                                 const std::vector<double> &z,
+                                 double nullvalue,
+                                 const std::string &description,
+                                 const std::string &units,
+                                 bool partialWetting) const {
+#ifndef USE_GDAL
+  adcircmodules_throw_exception("GDAL is not enabled.");
+#else
+  if (!this->isBuilt()) {
+    adcircmodules_throw_exception("RasterizationPlan: Plan has not been built");
+  }
+  if (z.size() != this->m_numMeshNodes) {
+    adcircmodules_throw_exception(
+        "RasterizationPlan: Number of values does not match the mesh");
+  }
+
+  const int nx = static_cast<int>(this->m_nx);
+
+  GDALDataset *raster = Adcirc::FileIO::createRaster(
+      filename, this->m_nx, this->m_ny, this->m_xmin, this->m_ymax,
+      this->m_resolution, this->m_epsg, nullvalue, description, units);
+  GDALRasterBand *band = raster->GetRasterBand(1);
+
+  int blockx, blocky;
+  band->GetBlockSize(&blockx, &blocky);
+  const size_t strip = static_cast<size_t>(std::max(blocky, 1));
+
+  const float fnull = static_cast<float>(nullvalue);
+  std::vector<float> buffer(strip * this->m_nx);
+
+  size_t count = 0;
+  double sum = 0.0, sumSquared = 0.0;
+  double vmin = std::numeric_limits<double>::max();
+  double vmax = -std::numeric_limits<double>::max();
+
+  size_t begin = 0;
+  for (size_t j0 = 0; j0 < this->m_ny; j0 += strip) {
+    const size_t nj = std::min(strip, this->m_ny - j0);
+    const uint64_t first = j0 * this->m_nx;
+    const uint64_t last = (j0 + nj) * this->m_nx;
+    const size_t end = static_cast<size_t>(
+        std::lower_bound(this->m_pixel.begin() + begin, this->m_pixel.end(),
+                         last) -
+        this->m_pixel.begin());
+
+    std::fill(buffer.begin(), buffer.begin() + nj * this->m_nx, fnull);
+    this->applyRange(z.data(), begin, end, first, buffer.data(), nullvalue,
+                     partialWetting);
+
+    for (size_t k = begin; k < end; ++k) {
+      const double v = buffer[this->m_pixel[k] - first];
+      if (v == fnull) continue;
+      count++;
+      sum += v;
+      sumSquared += v * v;
+      vmin = std::min(vmin, v);
+      vmax = std::max(vmax, v);
+    }
+
+    CPLErr cr = band->RasterIO(GF_Write, 0, static_cast<int>(j0), nx,
+                               static_cast<int>(nj), buffer.data(), nx,
+                               static_cast<int>(nj), GDT_Float32, 0, 0);
+    if (cr != CE_None) {
+      GDALClose(static_cast<GDALDatasetH>(raster));
+      adcircmodules_throw_exception("Error during Raster I/O in GDAL library");
+    }
+    begin = end;
+  }
+
+  if (count > 0) {
+    const double mean = sum / count;
+    const double sigma =
+        std::sqrt(std::max(0.0, sumSquared / count - mean * mean));
+    band->SetStatistics(vmin, vmax, mean, sigma);
+  }
+
+  GDALClose(static_cast<GDALDatasetH>(raster));
+#endif
+}
+
+/**
+ * @brief Writes the plan to a binary file
+ * @param[in] filename name of the file to write
+ *
+ * The file is written in the native byte order of the machine and is
+ * intended to be reused on the same platform.
+ */
+void RasterizationPlan::save(const std::string &filename) const {
+  if (!this->isBuilt()) {
+    adcircmodules_throw_exception("RasterizationPlan: Plan has not been built");
+  }
+
+  std::ofstream f(filename, std::ios::binary | std::ios::trunc);
+  if (!f.is_open()) {
+    adcircmodules_throw_exception("RasterizationPlan: Could not open " +
+                                  filename);
+  }
+
+  f.write(c_planMagic, sizeof(c_planMagic));
+  writeBinary(f, c_planVersion);
+  writeBinary(f, static_cast<uint64_t>(this->m_nx));
+  writeBinary(f, static_cast<uint64_t>(this->m_ny));
+  writeBinary(f, this->m_xmin);
+  writeBinary(f, this->m_ymax);
+  writeBinary(f, this->m_resolution);
+  writeBinary(f, static_cast<int32_t>(this->m_epsg));
+  writeBinary(f, static_cast<uint64_t>(this->m_numMeshNodes));
+  writeBinary(f, static_cast<uint64_t>(this->m_pixel.size()));
+  writeBinary(f, this->m_pixel);
+  writeBinary(f, this->m_node1);
+  writeBinary(f, this->m_node2);
+  writeBinary(f, this->m_node3);
+  writeBinary(f, this->m_weight1);
+  writeBinary(f, this->m_weight2);
+  writeBinary(f, this->m_weight3);
+
+  if (!f.good()) {
+    adcircmodules_throw_exception("RasterizationPlan: Error writing " +
+                                  filename);
+  }
+}
+
+/**
+ * @brief Reads a plan previously written with save
+ * @param[in] filename name of the file to read
+ */
+void RasterizationPlan::load(const std::string &filename) {
+  std::ifstream f(filename, std::ios::binary);
+  if (!f.is_open()) {
+    adcircmodules_throw_exception("RasterizationPlan: Could not open " +
+                                  filename);
+  }
+
+  char magic[sizeof(c_planMagic)];
+  uint32_t version = 0;
+  f.read(magic, sizeof(magic));
+  readBinary(f, version);
+  if (!f.good() || std::memcmp(magic, c_planMagic, sizeof(magic)) != 0 ||
+      version != c_planVersion) {
+    adcircmodules_throw_exception("RasterizationPlan: " + filename +
+                                  " is not a valid rasterization plan");
+  }
+
+  uint64_t nx, ny, numMeshNodes, n;
+  int32_t epsg;
+  double xmin, ymax, resolution;
+  readBinary(f, nx);
+  readBinary(f, ny);
+  readBinary(f, xmin);
+  readBinary(f, ymax);
+  readBinary(f, resolution);
+  readBinary(f, epsg);
+  readBinary(f, numMeshNodes);
+  readBinary(f, n);
+  if (!f.good() || nx < 3 || ny < 3 ||
+      ny > std::numeric_limits<uint64_t>::max() / nx || n > nx * ny ||
+      !(resolution > 0.0)) {
+    adcircmodules_throw_exception("RasterizationPlan: Error reading " +
+                                  filename);
+  }
+
+  this->clear();
+  readBinary(f, this->m_pixel, n);
+  readBinary(f, this->m_node1, n);
+  readBinary(f, this->m_node2, n);
+  readBinary(f, this->m_node3, n);
+  readBinary(f, this->m_weight1, n);
+  readBinary(f, this->m_weight2, n);
+  readBinary(f, this->m_weight3, n);
+  if (!f.good()) {
+    this->clear();
+    adcircmodules_throw_exception("RasterizationPlan: Error reading " +
+                                  filename);
+  }
+
+  //...A corrupt or stale file must not index outside the raster or the
+  // nodal values. Pixels must also be increasing since rows are located by
+  // binary search when writing
+  bool valid = true;
+  for (size_t k = 0; k < n && valid; ++k) {
+    valid = this->m_pixel[k] < nx * ny &&
+            (k == 0 || this->m_pixel[k] > this->m_pixel[k - 1]) &&
+            this->m_node1[k] < numMeshNodes &&
+            this->m_node2[k] < numMeshNodes && this->m_node3[k] < numMeshNodes;
+  }
+  if (!valid) {
+    this->clear();
+    adcircmodules_throw_exception("RasterizationPlan: " + filename +
+                                  " contains indices outside the raster or "
+                                  "mesh");
+  }
+
+  this->m_nx = nx;
+  this->m_ny = ny;
+  this->m_xmin = xmin;
+  this->m_ymax = ymax;
+  this->m_resolution = resolution;
+  this->m_epsg = epsg;
+  this->m_numMeshNodes = numMeshNodes;
+}
@@ -0,0 +1,118 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_RASTERIZATIONPLAN_H
+#define ADCMOD_RASTERIZATIONPLAN_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "Mesh.h"
+
+namespace Adcirc {
+namespace Utility {
+
+/**
+ * @class RasterizationPlan
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Precomputed map from raster pixels to mesh interpolation weights
+ *
+ * Locating the element that contains each pixel is the expensive part of
+ * rasterizing a mesh. The plan performs that search once for a given extent
+ * and resolution and keeps only the pixels that fall inside the mesh. Each of
+ * those pixels stores its linear index in the raster, the three node indices
+ * of its element and the three interpolation weights, in separate contiguous
+ * arrays. Applying the plan to a vector of nodal values is then a single
+ * gather, multiply and add over the stored pixels.
+ *
+ * Plans can be saved to disk and loaded again so that the search is not
+ * repeated between runs. A plan is only valid for the mesh used to build it.
+ */
+class RasterizationPlan {
+ public:
+  ADCIRCMODULES_EXPORT RasterizationPlan();
+
+  ADCIRCMODULES_EXPORT RasterizationPlan(Adcirc::Geometry::Mesh *mesh,
+                                         const std::vector<double> &extent,
+                                         double resolution);
+
+  void ADCIRCMODULES_EXPORT build(Adcirc::Geometry::Mesh *mesh,
+                                  const std::vector<double> &extent,
+                                  double resolution);
+
+  void ADCIRCMODULES_EXPORT clear();
+
+  bool ADCIRCMODULES_EXPORT isBuilt() const;
+
+  size_t ADCIRCMODULES_EXPORT nx() const;
+  size_t ADCIRCMODULES_EXPORT ny() const;
+  double ADCIRCMODULES_EXPORT xmin() const;
+  double ADCIRCMODULES_EXPORT ymax() const;
+  double ADCIRCMODULES_EXPORT resolution() const;
+  int ADCIRCMODULES_EXPORT epsg() const;
+  size_t ADCIRCMODULES_EXPORT numMeshNodes() const;
+  size_t ADCIRCMODULES_EXPORT numActivePixels() const;
+
+  std::vector<float> ADCIRCMODULES_EXPORT
+  apply(const std::vector<double> &z, double nullvalue = -99999.0,
+        bool partialWetting = true) const;
+
+#ifndef SWIG
+  void ADCIRCMODULES_EXPORT apply(const double *z, float *output,
+                                  double nullvalue, bool partialWetting) const;
+#endif
+
+  void ADCIRCMODULES_EXPORT toRaster(const std::string &filename,
+                                     const std::vector<double> &z,
+                                     double nullvalue = -99999.0,
+                                     const std::string &description = "none",
+                                     const std::string &units = "none",
+                                     bool partialWetting = true) const;
+
+  void ADCIRCMODULES_EXPORT save(const std::string &filename) const;
+  void ADCIRCMODULES_EXPORT load(const std::string &filename);
+
+ private:
+  void applyRange(const double *z, size_t begin, size_t end, uint64_t offset,
+                  float *output, double nullvalue, bool partialWetting) const;
+
+  size_t m_nx;
+  size_t m_ny;
+  double m_xmin;
+  double m_ymax;
+  double m_resolution;
+  int m_epsg;
+  size_t m_numMeshNodes;
+
+  std::vector<uint64_t> m_pixel;
+  std::vector<uint32_t> m_node1;
+  std::vector<uint32_t> m_node2;
+  std::vector<uint32_t> m_node3;
+  std::vector<float> m_weight1;
+  std::vector<float> m_weight2;
+  std::vector<float> m_weight3;
+};
+
+}  // namespace Utility
+}  // namespace Adcirc
+
+#endif  // ADCMOD_RASTERIZATIONPLAN_H
@@ -0,0 +1,315 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "ShapefileWriter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+#include "DefaultValues.h"
+#include "FileIO.h"
+#include "Logging.h"
+
+using namespace Adcirc::FileIO;
+
+namespace {
+
+void putInt32BE(char *p, int32_t v) {
+  const auto u = static_cast<uint32_t>(v);
+  p[0] = static_cast<char>((u >> 24) & 0xff);
+  p[1] = static_cast<char>((u >> 16) & 0xff);
+  p[2] = static_cast<char>((u >> 8) & 0xff);
+  p[3] = static_cast<char>(u & 0xff);
+}
+
+void putInt32LE(char *p, int32_t v) {
+  const auto u = static_cast<uint32_t>(v);
+  p[0] = static_cast<char>(u & 0xff);
+  p[1] = static_cast<char>((u >> 8) & 0xff);
+  p[2] = static_cast<char>((u >> 16) & 0xff);
+  p[3] = static_cast<char>((u >> 24) & 0xff);
+}
+
+void putInt16LE(char *p, uint16_t v) {
+  p[0] = static_cast<char>(v & 0xff);
+  p[1] = static_cast<char>((v >> 8) & 0xff);
+}
+
+void putDoubleLE(char *p, double v) {
+  uint64_t u;
+  std::memcpy(&u, &v, sizeof(u));
+  for (size_t k = 0; k < 8; ++k) {
+    p[k] = static_cast<char>((u >> (8 * k)) & 0xff);
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Constructor
+ * @param filename name of the output file. The extension is replaced with
+ * .shp, .shx and .dbf
+ * @param blockSize number of records encoded in each write
+ */
+ShapefileWriter::ShapefileWriter(const std::string &filename, size_t blockSize)
+    : m_basename(Generic::getFileWithoutExtension(filename)),
+      m_blockSize(std::max(blockSize, static_cast<size_t>(1))) {}
+
+/**
+ * @brief Writes the features and attributes to disk
+ * @param table features to write
+ */
+void ShapefileWriter::write(const FeatureTable &table) const {
+  this->writeShapes(table);
+  this->writeAttributes(table);
+}
+
+/**
+ * @brief Shapefile shape type code for a feature table
+ * @param table feature table
+ * @return shape type code
+ */
+int ShapefileWriter::shapeType(const FeatureTable &table) {
+  switch (table.geometryType()) {
+    case FeatureTable::FeaturePoint:
+      return table.hasZ() ? 11 : 1;
+    case FeatureTable::FeatureLineString:
+      return table.hasZ() ? 13 : 3;
+    case FeatureTable::FeaturePolygon:
+      return table.hasZ() ? 15 : 5;
+  }
+  return 0;
+}
+
+/**
+ * @brief Size of the content of a shape record, in bytes
+ * @param table feature table
+ * @param feature feature index
+ * @return number of bytes, excluding the record header
+ */
+size_t ShapefileWriter::contentLength(const FeatureTable &table,
+                                      size_t feature) {
+  if (table.geometryType() == FeatureTable::FeaturePoint) {
+    return table.hasZ() ? 36 : 20;
+  }
+  const size_t np = table.numVertices(feature);
+  return 48 + 16 * np + (table.hasZ() ? 16 + 8 * np : 0);
+}
+
+void ShapefileWriter::writeShapes(const FeatureTable &table) const {
+  const size_t n = table.numFeatures();
+  const int type = ShapefileWriter::shapeType(table);
+  const bool isPoint = table.geometryType() == FeatureTable::FeaturePoint;
+  const bool hasZ = table.hasZ();
+
+  std::vector<size_t> offset(n + 1);
+  offset[0] = 100;
+  for (size_t i = 0; i < n; ++i) {
+    offset[i + 1] = offset[i] + 8 + ShapefileWriter::contentLength(table, i);
+  }
+
+  const std::vector<double> ext = table.extent();
+  auto header = [&](size_t fileLength) {
+    std::vector<char> h(100, 0);
+    putInt32BE(h.data(), 9994);
+    putInt32BE(h.data() + 24, static_cast<int32_t>(fileLength / 2));
+    putInt32LE(h.data() + 28, 1000);
+    putInt32LE(h.data() + 32, type);
+    putDoubleLE(h.data() + 36, ext[0]);
+    putDoubleLE(h.data() + 44, ext[1]);
+    putDoubleLE(h.data() + 52, ext[2]);
+    putDoubleLE(h.data() + 60, ext[3]);
+    putDoubleLE(h.data() + 68, ext[4]);
+    putDoubleLE(h.data() + 76, ext[5]);
+    return h;
+  };
+
+  std::ofstream shp(this->m_basename + ".shp", std::ios::binary);
+  std::ofstream shx(this->m_basename + ".shx", std::ios::binary);
+  if (!shp.is_open() || !shx.is_open()) {
+    adcircmodules_throw_exception("ShapefileWriter: Could not open " +
+                                  this->m_basename + ".shp");
+  }
+
+  std::vector<char> h = header(offset[n]);
+  shp.write(h.data(), h.size());
+  h = header(100 + 8 * n);
+  shx.write(h.data(), h.size());
+
+  std::vector<char> shpBuffer, shxBuffer;
+  for (size_t b0 = 0; b0 < n; b0 += this->m_blockSize) {
+    const size_t b1 = std::min(n, b0 + this->m_blockSize);
+    shpBuffer.resize(offset[b1] - offset[b0]);
+    shxBuffer.resize(8 * (b1 - b0));
+
+#pragma omp parallel for schedule(static)
+    for (size_t i = b0; i < b1; ++i) {
+      const size_t length = ShapefileWriter::contentLength(table, i);
+      char *x = shxBuffer.data() + 8 * (i - b0);
+      putInt32BE(x, static_cast<int32_t>(offset[i] / 2));
+      putInt32BE(x + 4, static_cast<int32_t>(length / 2));
+
+      char *p = shpBuffer.data() + (offset[i] - offset[b0]);
+      putInt32BE(p, static_cast<int32_t>(i + 1));
+      putInt32BE(p + 4, static_cast<int32_t>(length / 2));
+      char *q = p + 8;
+      putInt32LE(q, type);
+
+      const size_t v0 = table.vertexOffset(i);
+      const size_t np = table.numVertices(i);
+
+      if (isPoint) {
+        putDoubleLE(q + 4, table.x(v0));
+        putDoubleLE(q + 12, table.y(v0));
+        if (hasZ) {
+          putDoubleLE(q + 20, table.z(v0));
+          putDoubleLE(q + 28, 0.0);
+        }
+        continue;
+      }
+
+      double xmin = table.x(v0), xmax = xmin;
+      double ymin = table.y(v0), ymax = ymin;
+      double zmin = table.z(v0), zmax = zmin;
+      for (size_t k = 0; k < np; ++k) {
+        const size_t v = v0 + k;
+        xmin = std::min(xmin, table.x(v));
+        xmax = std::max(xmax, table.x(v));
+        ymin = std::min(ymin, table.y(v));
+        ymax = std::max(ymax, table.y(v));
+        zmin = std::min(zmin, table.z(v));
+        zmax = std::max(zmax, table.z(v));
+        putDoubleLE(q + 48 + 16 * k, table.x(v));
+        putDoubleLE(q + 56 + 16 * k, table.y(v));
+      }
+      putDoubleLE(q + 4, xmin);
+      putDoubleLE(q + 12, ymin);
+      putDoubleLE(q + 20, xmax);
+      putDoubleLE(q + 28, ymax);
+      putInt32LE(q + 36, 1);
+      putInt32LE(q + 40, static_cast<int32_t>(np));
+      putInt32LE(q + 44, 0);
+
+      if (hasZ) {
+        char *r = q + 48 + 16 * np;
+        putDoubleLE(r, zmin);
+        putDoubleLE(r + 8, zmax);
+        for (size_t k = 0; k < np; ++k) {
+          putDoubleLE(r + 16 + 8 * k, table.z(v0 + k));
+        }
+      }
+    }
+
+    shp.write(shpBuffer.data(), shpBuffer.size());
+    shx.write(shxBuffer.data(), shxBuffer.size());
+  }
+}
+
+void ShapefileWriter::writeAttributes(const FeatureTable &table) const {
+  const size_t n = table.numFeatures();
+  const size_t nf = table.numFields();
+
+  size_t recordLength = 1;
+  for (size_t j = 0; j < nf; ++j) {
+    recordLength += static_cast<size_t>(table.field(j).width);
+  }
+  const size_t headerLength = 32 * (nf + 1) + 1;
+
+  //...The header stores the date of last update as years since 1900
+  const std::time_t now = std::time(nullptr);
+  const std::tm *today = std::localtime(&now);
+
+  std::vector<char> h(headerLength, 0);
+  h[0] = 0x03;
+  h[1] = static_cast<char>(today->tm_year);
+  h[2] = static_cast<char>(today->tm_mon + 1);
+  h[3] = static_cast<char>(today->tm_mday);
+  putInt32LE(h.data() + 4, static_cast<int32_t>(n));
+  putInt16LE(h.data() + 8, static_cast<uint16_t>(headerLength));
+  putInt16LE(h.data() + 10, static_cast<uint16_t>(recordLength));
+  for (size_t j = 0; j < nf; ++j) {
+    const auto &f = table.field(j);
+    char *d = h.data() + 32 * (j + 1);
+    std::strncpy(d, f.name.c_str(), 10);
+    d[11] = 'N';
+    d[16] = static_cast<char>(f.width);
+    d[17] = static_cast<char>(f.type == FeatureTable::FieldDouble ? f.precision
+                                                                  : 0);
+  }
+  h[headerLength - 1] = 0x0D;
+
+  std::ofstream dbf(this->m_basename + ".dbf", std::ios::binary);
+  if (!dbf.is_open()) {
+    adcircmodules_throw_exception("ShapefileWriter: Could not open " +
+                                  this->m_basename + ".dbf");
+  }
+  dbf.write(h.data(), h.size());
+
+  std::vector<char> buffer;
+  size_t overflow = 0;
+  for (size_t b0 = 0; b0 < n; b0 += this->m_blockSize) {
+    const size_t b1 = std::min(n, b0 + this->m_blockSize);
+    buffer.resize(recordLength * (b1 - b0));
+
+#pragma omp parallel for schedule(static) reduction(+ : overflow)
+    for (size_t i = b0; i < b1; ++i) {
+      char *p = buffer.data() + recordLength * (i - b0);
+      char s[320];
+      *p++ = ' ';
+      for (size_t j = 0; j < nf; ++j) {
+        const auto &f = table.field(j);
+        int len;
+        if (f.type == FeatureTable::FieldInteger) {
+          len = std::snprintf(s, sizeof(s), "%*lld", f.width,
+                              static_cast<long long>(f.integers[i]));
+        } else {
+          len = std::snprintf(s, sizeof(s), "%*.*f", f.width, f.precision,
+                              f.doubles[i]);
+        }
+        //...Values that do not fit the field are written as the dBASE
+        // overflow marker rather than truncated to a different number. The
+        // marker is also how a missing (default) value is stored
+        const size_t w = static_cast<size_t>(f.width);
+        if (len < 0 || static_cast<size_t>(len) > w) {
+          std::memset(p, '*', w);
+          if (f.type == FeatureTable::FieldInteger ||
+              f.doubles[i] != adcircmodules_default_value<double>()) {
+            overflow++;
+          }
+        } else {
+          std::memcpy(p, s, static_cast<size_t>(len));
+        }
+        p += w;
+      }
+    }
+
+    dbf.write(buffer.data(), buffer.size());
+  }
+
+  if (overflow > 0) {
+    Adcirc::Logging::warning("ShapefileWriter: " + std::to_string(overflow) +
+                             " attribute values were too wide for their "
+                             "field and were written as '*'");
+  }
+
+  const char eof = 0x1A;
+  dbf.write(&eof, 1);
+}
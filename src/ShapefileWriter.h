@@ -0,0 +1,64 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_SHAPEFILEWRITER_H
+#define ADCMOD_SHAPEFILEWRITER_H
+
+#include <string>
+#include <vector>
+
+#include "FeatureTable.h"
+
+namespace Adcirc {
+namespace FileIO {
+
+/**
+ * @class ShapefileWriter
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Writes a FeatureTable as an ESRI shapefile (.shp, .shx, .dbf)
+ *
+ * The size of every shape record is known from the vertex counts, so the
+ * position of each record in the output is computed up front. Records are
+ * then encoded in parallel into a buffer of blockSize records and the buffer
+ * is written in one call. The attribute table is written the same way using
+ * its fixed record length.
+ */
+class ShapefileWriter {
+ public:
+  explicit ShapefileWriter(const std::string &filename,
+                           size_t blockSize = 65536);
+
+  void write(const FeatureTable &table) const;
+
+ private:
+  static int shapeType(const FeatureTable &table);
+  static size_t contentLength(const FeatureTable &table, size_t feature);
+
+  void writeShapes(const FeatureTable &table) const;
+  void writeAttributes(const FeatureTable &table) const;
+
+  std::string m_basename;
+  size_t m_blockSize;
+};
+
+}  // namespace FileIO
+}  // namespace Adcirc
+
+#endif  // ADCMOD_SHAPEFILEWRITER_H
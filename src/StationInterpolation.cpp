@@ -18,6 +18,9 @@
 //------------------------------------------------------------------------*/
 #include "StationInterpolation.h"
 
+#include <exception>
+#include <utility>
+
 #include "Constants.h"
 #include "FPCompare.h"
 #include "FileIO.h"
@@ -30,7 +33,9 @@ using namespace Adcirc::Output;
 
 StationInterpolation::StationInterpolation(
     const StationInterpolationOptions &options)
-    : m_options(options) {}
+    : m_isVector(false),
+      m_defaultValue(Adcirc::Output::defaultOutputValue()),
+      m_options(options) {}
 
 void StationInterpolation::run() {
   Adcirc::Output::ReadOutput globalFile(this->m_options.globalfile());
@@ -44,6 +49,8 @@ void StationInterpolation::run() {
   } else {
     this->m_options.createStationObject(1);
   }
+  this->m_isVector = globalFile.metadata()->isVector();
+  this->m_defaultValue = globalFile.defaultValue();
 
   Adcirc::Output::OutputFormat filetype = globalFile.filetype();
   Adcirc::Geometry::Mesh m = this->readMesh(filetype);
@@ -56,11 +63,51 @@ void StationInterpolation::run() {
   ProgressBar progress_bar(nsnap);
   progress_bar.begin();
 
-  for (size_t i = this->m_options.startsnap(); i <= this->m_options.endsnap();
-       ++i) {
-    this->interpolateTimeSnapToStations(i, writeVector, coldstart, globalFile);
+  //...The snaps are double buffered. While one thread interpolates the
+  // current snap to the stations, a second thread reads the next snap from
+  // the file. Exceptions cannot leave an OpenMP section, so they are carried
+  // out and rethrown once both sections are complete
+  globalFile.read(this->m_options.startsnap() - 1);
+  Adcirc::Output::OutputRecord current = std::move(*globalFile.dataAt(0));
+  globalFile.clearAt(0);
+
+  for (size_t i = 0; i < nsnap; ++i) {
+    const bool readNext = i + 1 < nsnap;
+    std::exception_ptr readError = nullptr;
+    std::exception_ptr interpolationError = nullptr;
+
+#pragma omp parallel sections num_threads(2) if (readNext)
+    {
+#pragma omp section
+      {
+        if (readNext) {
+          try {
+            globalFile.read(this->m_options.startsnap() + i);
+          } catch (...) {
+            readError = std::current_exception();
+          }
+        }
+      }
+#pragma omp section
+      {
+        try {
+          this->interpolateRecordToStations(current, i, writeVector,
+                                            coldstart);
+        } catch (...) {
+          interpolationError = std::current_exception();
+        }
+      }
+    }
+
+    if (interpolationError) std::rethrow_exception(interpolationError);
+    if (readError) std::rethrow_exception(readError);
+
     progress_bar.tick();
-    globalFile.clearAt(0);
+
+    if (readNext) {
+      current = std::move(*globalFile.dataAt(0));
+      globalFile.clearAt(0);
+    }
   }
   progress_bar.end();
 
@@ -98,24 +145,24 @@ void StationInterpolation::generateInterpolationWeights(
 
   this->m_weights.resize(stn->nstations());
 
+  std::vector<double> x(stn->nstations());
+  std::vector<double> y(stn->nstations());
   for (size_t i = 0; i < stn->nstations(); ++i) {
-    std::vector<double> wt;
-    double x1 = stn->station(i)->longitude();
-    double y1 = stn->station(i)->latitude();
-    double x2 = 0.0;
-    double y2 = 0.0;
-
-    if (this->m_options.epsgStation() != this->m_options.epsgGlobal()) {
-      bool isLatLon;
-      Adcirc::Projection::transform(this->m_options.epsgStation(),
-                                    this->m_options.epsgGlobal(), x1, y1, x2,
-                                    y2, isLatLon);
-    } else {
-      x2 = x1;
-      y2 = y1;
-    }
+    x[i] = stn->station(i)->longitude();
+    y[i] = stn->station(i)->latitude();
+  }
 
-    size_t eidx = m.findElement(x2, y2, wt);
+  if (this->m_options.epsgStation() != this->m_options.epsgGlobal() &&
+      !x.empty()) {
+    bool isLatLon;
+    Adcirc::Projection::transformInPlace(this->m_options.epsgStation(),
+                                         this->m_options.epsgGlobal(), x, y,
+                                         isLatLon);
+  }
+
+  for (size_t i = 0; i < stn->nstations(); ++i) {
+    std::vector<double> wt;
+    size_t eidx = m.findElement(x[i], y[i], wt);
 
     if (eidx == Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
       this->m_weights[i].found = false;
@@ -130,6 +177,22 @@ void StationInterpolation::generateInterpolationWeights(
     }
   }
 
+  this->m_table = InterpolationTable();
+  this->m_table.station.reserve(nFound);
+  for (size_t k = 0; k < 3; ++k) {
+    this->m_table.node[k].reserve(nFound);
+    this->m_table.weight[k].reserve(nFound);
+    this->m_nodal[k].resize(nFound);
+  }
+  for (size_t i = 0; i < stn->nstations(); ++i) {
+    if (!this->m_weights[i].found) continue;
+    this->m_table.station.push_back(i);
+    for (size_t k = 0; k < 3; ++k) {
+      this->m_table.node[k].push_back(this->m_weights[i].node_index[k]);
+      this->m_table.weight[k].push_back(this->m_weights[i].weight[k]);
+    }
+  }
+
   Adcirc::Logging::log(
       boost::str(boost::format("%i of %i stations found inside the mesh") %
                  nFound % stn->nstations()),
@@ -142,26 +205,31 @@ void StationInterpolation::generateInterpolationWeights(
 }
 
 void StationInterpolation::allocateStationArrays() {
-  for (size_t i = 0; i < this->m_options.stations()->nstations(); ++i) {
-    this->m_options.station(i)->reserve(this->m_options.endsnap() -
-                                        this->m_options.startsnap());
+  const size_t nsnap =
+      this->m_options.endsnap() - this->m_options.startsnap() + 1;
+  Hmdf *stationData = this->m_options.stations();
+  for (size_t i = 0; i < stationData->nstations(); ++i) {
+    stationData->station(i)->resize(nsnap);
   }
 }
 
 void StationInterpolation::reprojectStationOutput() {
   if (this->m_options.epsgStation() != this->m_options.epsgOutput()) {
     Hmdf *output = this->m_options.stations();
+    if (output->nstations() == 0) return;
+    std::vector<double> x(output->nstations());
+    std::vector<double> y(output->nstations());
     for (size_t i = 0; i < output->nstations(); ++i) {
-      double x1 = output->station(i)->longitude();
-      double y1 = output->station(i)->latitude();
-      double x2 = 0;
-      double y2 = 0;
-      bool isLatLon;
-      Adcirc::Projection::transform(this->m_options.epsgStation(),
-                                    this->m_options.epsgOutput(), x1, y1, x2,
-                                    y2, isLatLon);
-      output->station(i)->setLongitude(x2);
-      output->station(i)->setLatitude(y2);
+      x[i] = output->station(i)->longitude();
+      y[i] = output->station(i)->latitude();
+    }
+    bool isLatLon;
+    Adcirc::Projection::transformInPlace(this->m_options.epsgStation(),
+                                         this->m_options.epsgOutput(), x, y,
+                                         isLatLon);
+    for (size_t i = 0; i < output->nstations(); ++i) {
+      output->station(i)->setLongitude(x[i]);
+      output->station(i)->setLatitude(y[i]);
     }
   }
 }
@@ -178,75 +246,172 @@ Adcirc::CDate StationInterpolation::getColdstartDate() {
   return Adcirc::CDate(1970, 1, 1, 0, 0, 0);
 }
 
-void StationInterpolation::interpolateTimeSnapToStations(
-    const size_t snap, const bool writeVector, const Adcirc::CDate &coldstart,
-    Adcirc::Output::ReadOutput &globalFile) {
-  globalFile.read(snap - 1);
-  auto adcircTime = globalFile.dataAt(0)->time();
-  auto adcircIt = globalFile.dataAt(0)->iteration();
-  Adcirc::CDate d = coldstart + adcircTime;
+/**
+ * @brief Interpolates a single output record to all stations
+ * @param record output record
+ * @param position index of the record in the station time series
+ * @param writeVector true if both vector components are written
+ * @param coldstart model cold start date
+ *
+ * Scalars, vector components and magnitudes are interpolated in a single
+ * vectorized pass over the interpolation table. Angles and signed
+ * magnitudes are computed station by station.
+ */
+void StationInterpolation::interpolateRecordToStations(
+    const Adcirc::Output::OutputRecord &record, const size_t position,
+    const bool writeVector, const Adcirc::CDate &coldstart) {
+  const double adcircTime = record.time();
+  const auto adcircIt = record.iteration();
+  const Adcirc::CDate d = coldstart + adcircTime;
+  const double dflt = this->m_defaultValue;
   Hmdf *stationData = this->m_options.stations();
 
   for (size_t j = 0; j < stationData->nstations(); ++j) {
-    if (this->m_weights[j].found) {
-      if (writeVector) {
-        stationData->station(j)->setNext(
-            d, Adcirc::Output::StationInterpolation::interpVector(
-                   globalFile, this->m_weights[j]));
-      } else {
-        if (this->m_options.hasPositiveDirection()) {
-          stationData->station(j)->setNext(
-              d, this->interpScalar(
-                     globalFile, this->m_weights[j],
-                     this->m_options.station(j)->positiveDirection()));
-        } else {
-          stationData->station(j)->setNext(
-              d, this->interpScalar(globalFile, this->m_weights[j]));
-        }
+    HmdfStation *s = stationData->station(j);
+    s->setDate(d, position);
+    s->setAdcircTime(position, adcircTime);
+    s->setAdcircIteration(position, adcircIt);
+    if (!this->m_weights[j].found) {
+      for (size_t k = 0; k < s->dimension(); ++k) {
+        s->setData(dflt, position, k);
       }
-    } else {
-      if (writeVector) {
-        stationData->station(j)->setNext(d, globalFile.defaultValue(),
-                                         globalFile.defaultValue());
+    }
+  }
+
+  if (writeVector) {
+    for (size_t k = 0; k < 2; ++k) {
+      this->gatherNodalValues(record.data(k));
+      this->interpolateNodalValues(this->m_result[k]);
+      this->scatterToStations(this->m_result[k], position, k);
+    }
+  } else if (!this->m_isVector && !this->m_options.angle()) {
+    this->gatherNodalValues(record.data(0));
+    this->interpolateNodalValues(this->m_result[0]);
+    this->scatterToStations(this->m_result[0], position, 0);
+  } else if (this->m_isVector && this->m_options.magnitude() &&
+             !this->m_options.hasPositiveDirection()) {
+    this->gatherNodalMagnitudes(record);
+    this->interpolateNodalValues(this->m_result[0]);
+    this->scatterToStations(this->m_result[0], position, 0);
+  } else {
+    for (const auto j : this->m_table.station) {
+      double v;
+      if (this->m_options.hasPositiveDirection()) {
+        v = this->interpScalar(record, this->m_weights[j], dflt,
+                               this->m_isVector,
+                               this->m_options.station(j)->positiveDirection());
       } else {
-        stationData->station(j)->setNext(d, globalFile.defaultValue());
+        v = this->interpScalar(record, this->m_weights[j], dflt,
+                               this->m_isVector);
       }
+      stationData->station(j)->setData(v, position, 0);
+    }
+  }
+}
+
+/**
+ * @brief Gathers the values at the vertices of each station's element
+ * @param values nodal values for the whole mesh
+ */
+void StationInterpolation::gatherNodalValues(const double *values) {
+  const size_t n = this->m_table.station.size();
+  for (size_t k = 0; k < 3; ++k) {
+    const size_t *node = this->m_table.node[k].data();
+    double *v = this->m_nodal[k].data();
+#pragma omp simd
+    for (size_t i = 0; i < n; ++i) {
+      v[i] = values[node[i]];
+    }
+  }
+}
+
+/**
+ * @brief Gathers the vector magnitude at the vertices of each station's
+ * element
+ * @param record vector output record
+ */
+void StationInterpolation::gatherNodalMagnitudes(
+    const Adcirc::Output::OutputRecord &record) {
+  const size_t n = this->m_table.station.size();
+  for (size_t k = 0; k < 3; ++k) {
+    const size_t *node = this->m_table.node[k].data();
+    double *v = this->m_nodal[k].data();
+    for (size_t i = 0; i < n; ++i) {
+      v[i] = record.magnitude(node[i]);
     }
-    auto file_position = stationData->station(j)->numSnaps() - 1;
-    stationData->station(j)->setAdcircTime(file_position, adcircTime);
-    stationData->station(j)->setAdcircIteration(file_position, adcircIt);
+  }
+}
+
+/**
+ * @brief Interpolates the gathered nodal values to each station
+ * @param result interpolated value at each station in the table
+ */
+void StationInterpolation::interpolateNodalValues(
+    std::vector<double> &result) const {
+  result.resize(this->m_table.station.size());
+  StationInterpolation::interpolateDryValues(
+      {this->m_nodal[0].data(), this->m_nodal[1].data(),
+       this->m_nodal[2].data()},
+      {this->m_table.weight[0].data(), this->m_table.weight[1].data(),
+       this->m_table.weight[2].data()},
+      result.size(), this->m_defaultValue, result.data());
+}
+
+/**
+ * @brief Writes interpolated values into the station time series
+ * @param result interpolated value at each station in the table
+ * @param position index in the station time series
+ * @param dim data dimension to write
+ */
+void StationInterpolation::scatterToStations(const std::vector<double> &result,
+                                             const size_t position,
+                                             const size_t dim) {
+  Hmdf *stationData = this->m_options.stations();
+  for (size_t i = 0; i < result.size(); ++i) {
+    stationData->station(this->m_table.station[i])
+        ->setData(result[i], position, dim);
   }
 }
 
 double StationInterpolation::interpScalar(Adcirc::Output::ReadOutput &data,
                                           Weight &w,
                                           const double positive_direction) {
+  return this->interpScalar(*data.dataAt(0), w, data.defaultValue(),
+                            data.metadata()->isVector(), positive_direction);
+}
+
+double StationInterpolation::interpScalar(
+    const Adcirc::Output::OutputRecord &record, const Weight &w,
+    const double defaultValue, const bool isVector,
+    const double positive_direction) {
   if (this->m_options.angle()) {
-    if (data.metadata()->isVector()) {
+    if (isVector) {
       adcircmodules_throw_exception(
           "Vector data supplied when a scalar angle was expected");
     }
-    return Adcirc::Output::StationInterpolation::interpAngle(data, w);
-  } else if (data.metadata()->isVector()) {
-    return this->interpScalarFromVector(data, w, positive_direction);
+    return Adcirc::Output::StationInterpolation::interpAngle(record, w,
+                                                             defaultValue);
+  } else if (isVector) {
+    return this->interpScalarFromVector(record, w, defaultValue,
+                                        positive_direction);
   } else {
     return Adcirc::Output::StationInterpolation::interpolateDryValues(
-        data.dataAt(0)->z(w.node_index[0]), w.weight[0],
-        data.dataAt(0)->z(w.node_index[1]), w.weight[1],
-        data.dataAt(0)->z(w.node_index[2]), w.weight[2], data.defaultValue());
+        record.z(w.node_index[0]), w.weight[0], record.z(w.node_index[1]),
+        w.weight[1], record.z(w.node_index[2]), w.weight[2], defaultValue);
   }
 }
 
-double StationInterpolation::interpAngle(Adcirc::Output::ReadOutput &data,
-                                         Weight &w) {
+double StationInterpolation::interpAngle(
+    const Adcirc::Output::OutputRecord &record, const Weight &w,
+    const double defaultValue) {
   using namespace Adcirc::FpCompare;
   std::array<double, 3> vx{0, 0, 0};
   std::array<double, 3> vy{0, 0, 0};
   for (size_t i = 0; i < 3; ++i) {
-    auto v = data.dataAt(0)->z(w.node_index[i]);
-    if (equalTo(v, data.defaultValue())) {
-      vx[i] = data.defaultValue();
-      vy[i] = data.defaultValue();
+    auto v = record.z(w.node_index[i]);
+    if (equalTo(v, defaultValue)) {
+      vx[i] = defaultValue;
+      vy[i] = defaultValue;
     } else {
       v *= Constants::deg2rad();
       vx[i] = std::cos(v);
@@ -255,12 +420,12 @@ double StationInterpolation::interpAngle(Adcirc::Output::ReadOutput &data,
   }
   auto vvx = StationInterpolation::interpolateDryValues(
       vx[0], w.weight[0], vx[1], w.weight[1], vx[2], w.weight[2],
-      data.defaultValue());
+      defaultValue);
   auto vvy = StationInterpolation::interpolateDryValues(
       vy[0], w.weight[0], vy[1], w.weight[1], vy[2], w.weight[2],
-      data.defaultValue());
-  if (equalTo(vvx, data.defaultValue()) || equalTo(vvy, data.defaultValue())) {
-    return data.defaultValue();
+      defaultValue);
+  if (equalTo(vvx, defaultValue) || equalTo(vvy, defaultValue)) {
+    return defaultValue;
   } else {
     auto angle = std::atan2(vvy, vvx) * Constants::rad2deg();
     return angle < 0.0 ? angle += 360.0 : angle;
@@ -268,30 +433,32 @@ double StationInterpolation::interpAngle(Adcirc::Output::ReadOutput &data,
 }
 
 std::tuple<double, double> StationInterpolation::interpVector(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
+    const Adcirc::Output::OutputRecord &record, const Weight &w,
+    const double defaultValue) {
   std::array<double, 3> vx{0, 0, 0};
   std::array<double, 3> vy{0, 0, 0};
   for (auto i = 0; i < 3; ++i) {
-    vx[i] = data.dataAt(0)->u(w.node_index[i]);
-    vy[i] = data.dataAt(0)->v(w.node_index[i]);
+    vx[i] = record.u(w.node_index[i]);
+    vy[i] = record.v(w.node_index[i]);
   }
   double vxx = StationInterpolation::interpolateDryValues(
       vx[0], w.weight[0], vx[1], w.weight[1], vx[2], w.weight[2],
-      data.defaultValue());
+      defaultValue);
   double vyy = StationInterpolation::interpolateDryValues(
       vy[0], w.weight[0], vy[1], w.weight[1], vy[2], w.weight[2],
-      data.defaultValue());
+      defaultValue);
   return std::make_tuple(vxx, vyy);
 }
 
 double StationInterpolation::interpScalarFromVectorWithFlowDirection(
-    Adcirc::Output::ReadOutput &data, Weight &w,
-    const double positive_direction) {
+    const Adcirc::Output::OutputRecord &record, const Weight &w,
+    const double defaultValue, const double positive_direction) {
   using namespace Adcirc::FpCompare;
   double vx, vy;
-  std::tie(vx, vy) = StationInterpolation::interpVector(data, w);
-  if (equalTo(vx, data.defaultValue()) || equalTo(vy, data.defaultValue())) {
-    return data.defaultValue();
+  std::tie(vx, vy) =
+      StationInterpolation::interpVector(record, w, defaultValue);
+  if (equalTo(vx, defaultValue) || equalTo(vy, defaultValue)) {
+    return defaultValue;
   }
   double magnitude = std::sqrt(std::pow(vx, 2.0) + std::pow(vy, 2.0));
   double direction =
@@ -307,43 +474,46 @@ double StationInterpolation::interpScalarFromVectorWithFlowDirection(
 }
 
 double StationInterpolation::interpScalarFromVectorWithoutFlowDirection(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
+    const Adcirc::Output::OutputRecord &record, const Weight &w,
+    const double defaultValue) {
   return StationInterpolation::interpolateDryValues(
-      data.dataAt(0)->magnitude(w.node_index[0]), w.weight[0],
-      data.dataAt(0)->magnitude(w.node_index[1]), w.weight[1],
-      data.dataAt(0)->magnitude(w.node_index[2]), w.weight[2],
-      data.defaultValue());
+      record.magnitude(w.node_index[0]), w.weight[0],
+      record.magnitude(w.node_index[1]), w.weight[1],
+      record.magnitude(w.node_index[2]), w.weight[2], defaultValue);
 }
 
 double StationInterpolation::interpDirectionFromVector(
-    Adcirc::Output::ReadOutput &data, Weight &w) {
+    const Adcirc::Output::OutputRecord &record, const Weight &w,
+    const double defaultValue) {
   using namespace Adcirc::FpCompare;
   double vx, vy;
-  std::tie(vx, vy) = StationInterpolation::interpVector(data, w);
-  if (equalTo(vx, data.defaultValue()) || equalTo(vy, data.defaultValue())) {
-    return data.defaultValue();
+  std::tie(vx, vy) =
+      StationInterpolation::interpVector(record, w, defaultValue);
+  if (equalTo(vx, defaultValue) || equalTo(vy, defaultValue)) {
+    return defaultValue;
   } else {
     return std::atan2(vy, vx) * Adcirc::Constants::rad2deg();
   }
 }
 
 double StationInterpolation::interpScalarFromVector(
-    Adcirc::Output::ReadOutput &data, Weight &w,
-    const double positive_direction) {
+    const Adcirc::Output::OutputRecord &record, const Weight &w,
+    const double defaultValue, const double positive_direction) {
   using namespace Adcirc::FpCompare;
   if (this->m_options.magnitude() && equalTo(positive_direction, -9999.0)) {
     return StationInterpolation::interpScalarFromVectorWithoutFlowDirection(
-        data, w);
+        record, w, defaultValue);
   } else if (this->m_options.magnitude() &&
              !equalTo(positive_direction, -9999.0)) {
     return StationInterpolation::interpScalarFromVectorWithFlowDirection(
-        data, w, positive_direction);
+        record, w, defaultValue, positive_direction);
   } else if (this->m_options.direction()) {
-    return StationInterpolation::interpDirectionFromVector(data, w);
+    return StationInterpolation::interpDirectionFromVector(record, w,
+                                                           defaultValue);
   } else {
     adcircmodules_throw_exception(
         "Cannot write vector data. Select --magnitude or --direction");
-    return data.defaultValue();
+    return defaultValue;
   }
 }
 
@@ -389,6 +559,47 @@ double StationInterpolation::interpolateDryValues(double v1, double w1,
   return v1 * w1 + v2 * w2 + v3 * w3;
 }
 
+/**
+ * @brief Interpolates many points at once with the same rules as the scalar
+ * interpolateDryValues
+ * @param values value at each of the three element vertices of every point
+ * @param weights interpolation weight of each vertex of every point
+ * @param n number of points
+ * @param defaultVal value that marks a dry vertex
+ * @param result interpolated value of every point, n values
+ *
+ * The loop is branch free so that it vectorizes. The weights of wet vertices
+ * are renormalized in the same order as the scalar form, so both give the
+ * same bits.
+ */
+void StationInterpolation::interpolateDryValues(
+    const std::array<const double *, 3> &values,
+    const std::array<const double *, 3> &weights, const size_t n,
+    const double defaultVal, double *result) {
+  const double *v0 = values[0];
+  const double *v1 = values[1];
+  const double *v2 = values[2];
+  const double *w0 = weights[0];
+  const double *w1 = weights[1];
+  const double *w2 = weights[2];
+
+#pragma omp simd
+  for (size_t i = 0; i < n; ++i) {
+    const bool d0 = v0[i] == defaultVal;
+    const bool d1 = v1[i] == defaultVal;
+    const bool d2 = v2[i] == defaultVal;
+    const int numDry = static_cast<int>(d0) + static_cast<int>(d1) +
+                       static_cast<int>(d2);
+    const double a0 = d0 ? 0.0 : w0[i];
+    const double a1 = d1 ? 0.0 : w1[i];
+    const double a2 = d2 ? 0.0 : w2[i];
+    const double f = numDry == 0 ? 1.0 : 1.0 / (a0 + a1 + a2);
+    const double sum = v0[i] * (a0 * f) + v1[i] * (a1 * f) + v2[i] * (a2 * f);
+    const double single = d0 ? (d1 ? v2[i] : v1[i]) : v0[i];
+    result[i] = numDry == 3 ? defaultVal : numDry == 2 ? single : sum;
+  }
+}
+
 Adcirc::CDate StationInterpolation::dateFromString(
     const std::string &dateString) {
   int year = stoi(dateString.substr(0, 4));
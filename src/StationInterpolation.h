@@ -23,11 +23,13 @@
 #include <limits>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "AdcircModules_Global.h"
 #include "CDate.h"
 #include "Hmdf.h"
 #include "Mesh.h"
+#include "OutputRecord.h"
 #include "ReadOutput.h"
 #include "StationInterpolationOptions.h"
 
@@ -54,7 +56,24 @@ class StationInterpolation {
   static double interpolateDryValues(double v1, double w1, double v2, double w2,
                                      double v3, double w3, double defaultVal);
 
+#ifndef SWIG
+  static void interpolateDryValues(const std::array<const double *, 3> &values,
+                                   const std::array<const double *, 3> &weights,
+                                   size_t n, double defaultVal, double *result);
+#endif
+
  private:
+  /**
+   * @brief Interpolation weights for the stations found inside the mesh,
+   * stored as one array per triangle vertex so that a snap can be
+   * interpolated to every station in a single vectorized pass
+   */
+  struct InterpolationTable {
+    std::vector<size_t> station;
+    std::array<std::vector<size_t>, 3> node;
+    std::array<std::vector<double>, 3> weight;
+  };
+
   void reprojectStationOutput();
   CDate getColdstartDate();
   Adcirc::Geometry::Mesh readMesh(const Adcirc::Output::OutputFormat &filetype);
@@ -63,27 +82,47 @@ class StationInterpolation {
   Adcirc::Output::Hmdf copyStationList(Adcirc::Output::Hmdf &list,
                                        const bool vector = false);
 
-  void interpolateTimeSnapToStations(const size_t snap, const bool writeVector,
-                                     const CDate &coldstart,
-                                     Adcirc::Output::ReadOutput &globalFile);
-  double interpScalarFromVector(Adcirc::Output::ReadOutput &data, Weight &w,
+  void interpolateRecordToStations(const Adcirc::Output::OutputRecord &record,
+                                   size_t position, bool writeVector,
+                                   const CDate &coldstart);
+  void gatherNodalValues(const double *values);
+  void gatherNodalMagnitudes(const Adcirc::Output::OutputRecord &record);
+  void interpolateNodalValues(std::vector<double> &result) const;
+  void scatterToStations(const std::vector<double> &result, size_t position,
+                         size_t dim);
+
+  double interpScalar(const Adcirc::Output::OutputRecord &record,
+                      const Weight &w, double defaultValue, bool isVector,
+                      const double positive_direction = -9999.0);
+  double interpScalarFromVector(const Adcirc::Output::OutputRecord &record,
+                                const Weight &w, double defaultValue,
                                 const double positive_direction = -9999.0);
   static double interpScalarFromVectorWithoutFlowDirection(
-      Adcirc::Output::ReadOutput &data, Weight &w);
+      const Adcirc::Output::OutputRecord &record, const Weight &w,
+      double defaultValue);
   static double interpScalarFromVectorWithFlowDirection(
-      Adcirc::Output::ReadOutput &data, Weight &w,
-      const double positive_direction);
-  static double interpDirectionFromVector(Adcirc::Output::ReadOutput &data, Weight &w);
-  static double interpAngle(Adcirc::Output::ReadOutput &data,Weight &w);
+      const Adcirc::Output::OutputRecord &record, const Weight &w,
+      double defaultValue, const double positive_direction);
+  static double interpDirectionFromVector(
+      const Adcirc::Output::OutputRecord &record, const Weight &w,
+      double defaultValue);
+  static double interpAngle(const Adcirc::Output::OutputRecord &record,
+                            const Weight &w, double defaultValue);
 
   static std::tuple<double, double> interpVector(
-      Adcirc::Output::ReadOutput &data, Weight &w);
+      const Adcirc::Output::OutputRecord &record, const Weight &w,
+      double defaultValue);
   void allocateStationArrays();
   void generateInterpolationWeights(Adcirc::Geometry::Mesh &m);
 
   static CDate dateFromString(const std::string &dateString);
 
   std::vector<Weight> m_weights;
+  InterpolationTable m_table;
+  std::array<std::vector<double>, 3> m_nodal;
+  std::array<std::vector<double>, 2> m_result;
+  bool m_isVector;
+  double m_defaultValue;
   Adcirc::Output::StationInterpolationOptions m_options;
 };
 
@@ -18,12 +18,41 @@
 //------------------------------------------------------------------------*/
 #include "StringConversion.h"
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
 #include <utility>
 
 #include "boost/algorithm/string.hpp"
 
 using namespace Adcirc;
 
+namespace {
+
+bool isBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+/**
+ * @brief Fallback for tokens outside of the exact fast path, such as those
+ * with many significant digits, large exponents or nan/inf
+ */
+bool parseDoubleSlow(const char*& p, const char* end, double& value) {
+  const char* tokenEnd = p;
+  while (tokenEnd < end && !isBlank(*tokenEnd)) ++tokenEnd;
+  std::string token(p, tokenEnd);
+  char* next = nullptr;
+  value = std::strtod(token.c_str(), &next);
+  if (next == token.c_str()) return false;
+  p += next - token.c_str();
+  return true;
+}
+
+}  // namespace
+
 double StringConversion::stringToDouble(const std::string& a, bool& ok) {
   ok = true;
   try {
@@ -70,3 +99,111 @@ std::string StringConversion::sanitizeString(const std::string& a) {
   b.erase(std::remove(b.begin(), b.end(), '\r'), b.end());
   return b;
 }
+
+/**
+ * @brief Parses a floating point value from a character buffer
+ * @param[inout] p position to begin parsing. Moved past the value on success
+ * @param[in] end end of the buffer
+ * @param[out] value parsed value
+ * @return true if a value was found before the end of the buffer
+ *
+ * Leading whitespace is skipped. Values with at most 19 digits, a mantissa
+ * below 2^53 and a decimal exponent within +/-22 are formed with a single
+ * exact multiply or divide, which gives the same correctly rounded result as
+ * strtod without the locale handling. Other values are passed to strtod.
+ */
+bool StringConversion::parseDouble(const char*& p, const char* end,
+                                   double& value) {
+  static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                 1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                 1e18, 1e19, 1e20, 1e21, 1e22};
+  constexpr uint64_t maxExact = uint64_t(1) << 53;
+
+  while (p < end && isBlank(*p)) ++p;
+  if (p == end) return false;
+
+  const char* c = p;
+  bool negative = false;
+  if (*c == '-' || *c == '+') {
+    negative = *c == '-';
+    ++c;
+  }
+
+  //...Digits are accumulated without overflow checks. Tokens with more than
+  // 19 digits, including leading zeros, are sent to the slow path below
+  uint64_t mantissa = 0;
+  const char* digitsBegin = c;
+  while (c < end && isDigit(*c)) {
+    mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+    ++c;
+  }
+  ptrdiff_t digits = c - digitsBegin;
+  int exponent = 0;
+  if (c < end && *c == '.') {
+    ++c;
+    const char* fractionBegin = c;
+    while (c < end && isDigit(*c)) {
+      mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+      ++c;
+    }
+    digits += c - fractionBegin;
+    exponent = -static_cast<int>(c - fractionBegin);
+  }
+  if (digits == 0 || digits > 19) return parseDoubleSlow(p, end, value);
+
+  if (c < end && (*c == 'e' || *c == 'E')) {
+    const char* e = c + 1;
+    bool negativeExponent = false;
+    if (e < end && (*e == '-' || *e == '+')) {
+      negativeExponent = *e == '-';
+      ++e;
+    }
+    if (e < end && isDigit(*e)) {
+      int x = 0;
+      while (e < end && isDigit(*e)) {
+        if (x < 10000) x = x * 10 + (*e - '0');
+        ++e;
+      }
+      exponent += negativeExponent ? -x : x;
+      c = e;
+    }
+  }
+
+  if (c < end && !isBlank(*c) && *c != ',') {
+    return parseDoubleSlow(p, end, value);
+  }
+
+  if (mantissa > maxExact || exponent < -22 || exponent > 22) {
+    return parseDoubleSlow(p, end, value);
+  }
+
+  double v = static_cast<double>(mantissa);
+  v = exponent < 0 ? v / pow10[-exponent] : v * pow10[exponent];
+  value = negative ? -v : v;
+  p = c;
+  return true;
+}
+
+/**
+ * @brief Parses an unsigned integer from a character buffer
+ * @param[inout] p position to begin parsing. Moved past the value on success
+ * @param[in] end end of the buffer
+ * @param[out] value parsed value
+ * @return true if a value was found before the end of the buffer
+ */
+bool StringConversion::parseSizet(const char*& p, const char* end,
+                                  size_t& value) {
+  while (p < end && isBlank(*p)) ++p;
+  const char* c = p;
+  if (c < end && *c == '+') ++c;
+  if (c == end || !isDigit(*c)) return false;
+  size_t v = 0;
+  while (c < end && isDigit(*c)) {
+    v = v * 10 + static_cast<size_t>(*c - '0');
+    ++c;
+  }
+  value = v;
+  p = c;
+  return true;
+}
@@ -30,6 +30,9 @@ class StringConversion {
   static float stringToFloat(const std::string& a, bool& ok);
   static double stringToDouble(const std::string& a, bool& ok);
   static std::string sanitizeString(const std::string& a);
+
+  static bool parseDouble(const char*& p, const char* end, double& value);
+  static bool parseSizet(const char*& p, const char* end, size_t& value);
 };
 }  // namespace Adcirc
 
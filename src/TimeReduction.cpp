@@ -0,0 +1,313 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#include "TimeReduction.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Logging.h"
+
+using namespace Adcirc::Output;
+
+/**
+ * @brief Constructor
+ * @param numNodes number of nodes in each snap
+ */
+TimeReduction::TimeReduction(size_t numNodes)
+    : m_numNodes(numNodes),
+      m_numSnaps(0),
+      m_defaultValue(Adcirc::Output::defaultOutputValue()),
+      m_lastTime(0.0) {}
+
+/**
+ * @brief Registers a reduction. Reductions must be added before any snaps
+ * @param type type of reduction
+ * @param threshold threshold used by ReduceDurationAbove
+ * @return index of the reduction, used to retrieve the result
+ */
+size_t TimeReduction::addReduction(ReductionType type, double threshold) {
+  if (this->m_numSnaps > 0) {
+    adcircmodules_throw_exception(
+        "TimeReduction: Reductions must be added before data");
+  }
+  Reduction r;
+  r.type = type;
+  r.threshold = threshold;
+  this->initialize(r);
+  this->m_reductions.push_back(std::move(r));
+  return this->m_reductions.size() - 1;
+}
+
+size_t TimeReduction::numReductions() const {
+  return this->m_reductions.size();
+}
+
+ReductionType TimeReduction::type(size_t index) const {
+  if (index >= this->m_reductions.size()) {
+    adcircmodules_throw_exception("TimeReduction: Index out of bounds");
+  }
+  return this->m_reductions[index].type;
+}
+
+size_t TimeReduction::numNodes() const { return this->m_numNodes; }
+
+/**
+ * @brief Number of snaps that have been processed
+ * @return number of snaps
+ */
+size_t TimeReduction::numSnaps() const { return this->m_numSnaps; }
+
+double TimeReduction::defaultValue() const { return this->m_defaultValue; }
+
+/**
+ * @brief Sets the value used to mark dry nodes in the input and in the
+ * results
+ * @param defaultValue default value
+ */
+void TimeReduction::setDefaultValue(double defaultValue) {
+  this->m_defaultValue = defaultValue;
+}
+
+/**
+ * @brief Discards all processed snaps. The reductions are kept
+ */
+void TimeReduction::reset() {
+  this->m_numSnaps = 0;
+  this->m_lastTime = 0.0;
+  for (auto &r : this->m_reductions) {
+    this->initialize(r);
+  }
+}
+
+void TimeReduction::initialize(Reduction &r) const {
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  const size_t n = this->m_numNodes;
+  switch (r.type) {
+    case ReduceMaximum:
+      r.value.assign(n, -inf);
+      r.extra.clear();
+      break;
+    case ReduceMinimum:
+      r.value.assign(n, inf);
+      r.extra.clear();
+      break;
+    case ReduceMean:
+      r.value.assign(n, 0.0);
+      r.extra.assign(n, 0.0);
+      break;
+    case ReduceTimeOfMaximum:
+      r.value.assign(n, 0.0);
+      r.extra.assign(n, -inf);
+      break;
+    case ReduceTimeOfMinimum:
+      r.value.assign(n, 0.0);
+      r.extra.assign(n, inf);
+      break;
+    case ReduceDurationAbove:
+      r.value.assign(n, 0.0);
+      r.extra.clear();
+      break;
+  }
+}
+
+/**
+ * @brief Applies a reduction to a block of nodes from one snap
+ * @param r reduction
+ * @param z values for the whole snap
+ * @param i0 first node in the block
+ * @param i1 one past the last node in the block
+ * @param time time of the snap
+ * @param dt time since the previous snap
+ *
+ * The loops are written as selects rather than branches so that they can be
+ * vectorized
+ */
+void TimeReduction::reduceBlock(Reduction &r, const double *z, size_t i0,
+                                size_t i1, double time, double dt) const {
+  const double dflt = this->m_defaultValue;
+  double *value = r.value.data();
+  double *extra = r.extra.data();
+
+  switch (r.type) {
+    case ReduceMaximum:
+#pragma omp simd
+      for (size_t i = i0; i < i1; ++i) {
+        const bool valid = z[i] != dflt && z[i] == z[i];
+        value[i] = valid && z[i] > value[i] ? z[i] : value[i];
+      }
+      break;
+    case ReduceMinimum:
+#pragma omp simd
+      for (size_t i = i0; i < i1; ++i) {
+        const bool valid = z[i] != dflt && z[i] == z[i];
+        value[i] = valid && z[i] < value[i] ? z[i] : value[i];
+      }
+      break;
+    case ReduceMean:
+#pragma omp simd
+      for (size_t i = i0; i < i1; ++i) {
+        const bool valid = z[i] != dflt && z[i] == z[i];
+        value[i] += valid ? z[i] : 0.0;
+        extra[i] += valid ? 1.0 : 0.0;
+      }
+      break;
+    case ReduceTimeOfMaximum:
+#pragma omp simd
+      for (size_t i = i0; i < i1; ++i) {
+        const bool update = z[i] != dflt && z[i] > extra[i];
+        extra[i] = update ? z[i] : extra[i];
+        value[i] = update ? time : value[i];
+      }
+      break;
+    case ReduceTimeOfMinimum:
+#pragma omp simd
+      for (size_t i = i0; i < i1; ++i) {
+        const bool update = z[i] != dflt && z[i] < extra[i];
+        extra[i] = update ? z[i] : extra[i];
+        value[i] = update ? time : value[i];
+      }
+      break;
+    case ReduceDurationAbove: {
+      const double threshold = r.threshold;
+#pragma omp simd
+      for (size_t i = i0; i < i1; ++i) {
+        const bool above = z[i] != dflt && z[i] > threshold;
+        value[i] += above ? dt : 0.0;
+      }
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Updates all reductions with one snap
+ * @param time time of the snap, seconds
+ * @param values value at each node
+ */
+void TimeReduction::update(double time, const double *values) {
+  const double dt = this->m_numSnaps == 0 ? 0.0 : time - this->m_lastTime;
+  const size_t nn = this->m_numNodes;
+  const size_t numBlocks = (nn + c_blockSize - 1) / c_blockSize;
+
+#pragma omp parallel for schedule(static)
+  for (size_t b = 0; b < numBlocks; ++b) {
+    const size_t i0 = b * c_blockSize;
+    const size_t i1 = std::min(nn, i0 + c_blockSize);
+    for (auto &r : this->m_reductions) {
+      this->reduceBlock(r, values, i0, i1, time, dt);
+    }
+  }
+
+  this->m_lastTime = time;
+  this->m_numSnaps++;
+}
+
+/**
+ * @brief Updates all reductions with one snap
+ * @param record output record. Vector records are reduced by magnitude
+ */
+void TimeReduction::update(Adcirc::Output::OutputRecord *record) {
+  if (record->numNodes() != this->m_numNodes) {
+    adcircmodules_throw_exception(
+        "TimeReduction: Record size does not match the reduction");
+  }
+  if (record->metadata()->isVector()) {
+    const std::vector<double> u = record->values(0);
+    const std::vector<double> v = record->values(1);
+    const double dflt = this->m_defaultValue;
+    std::vector<double> m(this->m_numNodes);
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < this->m_numNodes; ++i) {
+      m[i] = u[i] == dflt || v[i] == dflt ? dflt : std::hypot(u[i], v[i]);
+    }
+    this->update(record->time(), m.data());
+  } else {
+    const std::vector<double> z = record->values(0);
+    this->update(record->time(), z.data());
+  }
+}
+
+/**
+ * @brief Updates all reductions with every remaining snap in an output file
+ * @param reader output file. Opened if it is not already open
+ *
+ * Snaps are read and released one at a time. Any records already held by the
+ * reader are released.
+ */
+void TimeReduction::update(Adcirc::Output::ReadOutput *reader) {
+  if (!reader->isOpen()) reader->open();
+  reader->clear();
+  for (size_t i = reader->currentSnap(); i < reader->numSnaps(); ++i) {
+    reader->read();
+    this->update(reader->dataAt(0));
+    reader->clearAt(0);
+  }
+}
+
+/**
+ * @brief Returns the result of a reduction
+ * @param index index returned by addReduction
+ * @return value at each node
+ */
+std::vector<double> TimeReduction::values(size_t index) const {
+  if (index >= this->m_reductions.size()) {
+    adcircmodules_throw_exception("TimeReduction: Index out of bounds");
+  }
+
+  const Reduction &r = this->m_reductions[index];
+  const double dflt = this->m_defaultValue;
+  std::vector<double> out(this->m_numNodes);
+
+  for (size_t i = 0; i < this->m_numNodes; ++i) {
+    switch (r.type) {
+      case ReduceMaximum:
+      case ReduceMinimum:
+        out[i] = std::isinf(r.value[i]) ? dflt : r.value[i];
+        break;
+      case ReduceMean:
+        out[i] = r.extra[i] > 0.0 ? r.value[i] / r.extra[i] : dflt;
+        break;
+      case ReduceTimeOfMaximum:
+      case ReduceTimeOfMinimum:
+        out[i] = std::isinf(r.extra[i]) ? dflt : r.value[i];
+        break;
+      case ReduceDurationAbove:
+        out[i] = r.value[i];
+        break;
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Returns the result of a reduction as an output record that can be
+ * passed to WriteOutput
+ * @param index index returned by addReduction
+ * @param record record number to assign
+ * @return scalar output record. The record time is the time of the last snap
+ */
+OutputRecord TimeReduction::result(size_t index, size_t record) const {
+  std::vector<double> v = this->values(index);
+  OutputRecord r(record, this->m_numNodes, false, false, 1);
+  r.setDefaultValue(this->m_defaultValue);
+  r.setTime(this->m_lastTime);
+  r.setAll(v.size(), v.data());
+  return r;
+}
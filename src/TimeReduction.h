@@ -0,0 +1,113 @@
+/*------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------*/
+#ifndef ADCMOD_TIMEREDUCTION_H
+#define ADCMOD_TIMEREDUCTION_H
+
+#include <vector>
+
+#include "AdcircModules_Global.h"
+#include "OutputRecord.h"
+#include "ReadOutput.h"
+
+namespace Adcirc {
+namespace Output {
+
+enum ReductionType {
+  ReduceMaximum,
+  ReduceMinimum,
+  ReduceMean,
+  ReduceTimeOfMaximum,
+  ReduceTimeOfMinimum,
+  ReduceDurationAbove
+};
+
+/**
+ * @class TimeReduction
+ * @author Zachary Cobell
+ * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
+ * project is released under the terms of the GNU General Public License v3
+ * @brief Reduces a series of output snaps to a single value at each node
+ *
+ * Any number of reductions can be registered and they are all updated in a
+ * single pass over each snap, so an output file only needs to be read once to
+ * produce, for example, the maximum, the time of the maximum and the duration
+ * above a threshold. Nodes are processed in blocks in parallel and each
+ * reduction is applied to the block before moving to the next block.
+ *
+ * Nodes at the default value (dry) are skipped for that snap. Nodes that are
+ * never wet report the default value, except for durations, which report
+ * zero. Vector records are reduced using their magnitude. The duration above
+ * a threshold adds the time since the previous snap for each snap where the
+ * value is above the threshold.
+ */
+class TimeReduction {
+ public:
+  ADCIRCMODULES_EXPORT explicit TimeReduction(size_t numNodes);
+
+  size_t ADCIRCMODULES_EXPORT addReduction(ReductionType type,
+                                           double threshold = 0.0);
+
+  size_t ADCIRCMODULES_EXPORT numReductions() const;
+  ReductionType ADCIRCMODULES_EXPORT type(size_t index) const;
+
+  size_t ADCIRCMODULES_EXPORT numNodes() const;
+  size_t ADCIRCMODULES_EXPORT numSnaps() const;
+
+  double ADCIRCMODULES_EXPORT defaultValue() const;
+  void ADCIRCMODULES_EXPORT setDefaultValue(double defaultValue);
+
+  void ADCIRCMODULES_EXPORT update(Adcirc::Output::OutputRecord *record);
+  void ADCIRCMODULES_EXPORT update(Adcirc::Output::ReadOutput *reader);
+
+#ifndef SWIG
+  void ADCIRCMODULES_EXPORT update(double time, const double *values);
+#endif
+
+  std::vector<double> ADCIRCMODULES_EXPORT values(size_t index) const;
+
+  Adcirc::Output::OutputRecord ADCIRCMODULES_EXPORT
+  result(size_t index, size_t record = 1) const;
+
+  void ADCIRCMODULES_EXPORT reset();
+
+ private:
+  struct Reduction {
+    ReductionType type;
+    double threshold;
+    std::vector<double> value;
+    std::vector<double> extra;
+  };
+
+  void initialize(Reduction &r) const;
+  void reduceBlock(Reduction &r, const double *z, size_t i0, size_t i1,
+                   double time, double dt) const;
+
+  static constexpr size_t c_blockSize = 1024;
+
+  size_t m_numNodes;
+  size_t m_numSnaps;
+  double m_defaultValue;
+  double m_lastTime;
+  std::vector<Reduction> m_reductions;
+};
+
+}  // namespace Output
+}  // namespace Adcirc
+
+#endif  // ADCMOD_TIMEREDUCTION_H
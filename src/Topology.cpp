@@ -28,7 +28,8 @@ Topology::Topology(Adcirc::Private::MeshPrivate *mesh)
     : m_mesh(mesh),
       m_nodeTable(std::make_unique<NodeTable>(m_mesh)),
       m_elementTable(std::make_unique<ElementTable>(m_mesh)),
-      m_faceTable(std::make_unique<FaceTable>(m_mesh)) {}
+      m_faceTable(std::make_unique<FaceTable>(m_mesh)),
+      m_edgeTable(std::make_unique<EdgeTable>(m_mesh)) {}
 
 /**
  * @brief Returns pointer to the node table
@@ -47,3 +48,18 @@ ElementTable *Topology::elementTable() { return m_elementTable.get(); }
  * @return face table pointer
  */
 FaceTable *Topology::faceTable() { return m_faceTable.get(); }
+
+/**
+ * @brief Returns pointer to the edge table, building it if it has not been
+ * generated for the current mesh
+ * @return edge table pointer
+ */
+EdgeTable *Topology::edgeTable() {
+  if (!m_edgeTable->initialized()) m_edgeTable->build();
+  return m_edgeTable.get();
+}
+
+/**
+ * @brief Marks the edge table as out of date without rebuilding it
+ */
+void Topology::invalidateEdgeTable() { m_edgeTable->invalidate(); }
@@ -22,6 +22,7 @@
 #include <memory>
 
 #include "AdcircModules_Global.h"
+#include "EdgeTable.h"
 #include "ElementTable.h"
 #include "FaceTable.h"
 #include "NodeTable.h"
@@ -37,8 +38,8 @@ namespace Geometry {
  * @author Zachary Cobell
  * @copyright Copyright 2015-2020 Zachary Cobell. All Rights Reserved. This
  * project is released under the terms of the GNU General Public License v3
- * @brief The Topology class acts as a wrapper for NodeTable, ElementTable, and
- * FaceTable
+ * @brief The Topology class acts as a wrapper for NodeTable, ElementTable,
+ * FaceTable, and EdgeTable
  *
  */
 class Topology {
@@ -48,12 +49,16 @@ class Topology {
   ADCIRCMODULES_EXPORT Adcirc::Geometry::NodeTable *nodeTable();
   ADCIRCMODULES_EXPORT Adcirc::Geometry::ElementTable *elementTable();
   ADCIRCMODULES_EXPORT Adcirc::Geometry::FaceTable *faceTable();
+  ADCIRCMODULES_EXPORT Adcirc::Geometry::EdgeTable *edgeTable();
+
+  void ADCIRCMODULES_EXPORT invalidateEdgeTable();
 
  private:
   Adcirc::Private::MeshPrivate *m_mesh;
   std::unique_ptr<NodeTable> m_nodeTable;
   std::unique_ptr<ElementTable> m_elementTable;
   std::unique_ptr<FaceTable> m_faceTable;
+  std::unique_ptr<EdgeTable> m_edgeTable;
 };
 }  // namespace Geometry
 }  // namespace Adcirc
@@ -26,6 +26,14 @@ GriddataAverage::GriddataAverage(const Adcirc::Raster::Rasterdata *raster,
     : GriddataMethod(raster, attribute, config) {}
 
 double GriddataAverage::computeFromRaster() const {
+  const auto tables = this->integralTables();
+  if (tables) {
+    Adcirc::Raster::RasterIntegralTables::Window w{};
+    if (!this->integralWindow(w)) return GriddataAverage::methodErrorValue();
+    const auto stats = tables->windowStatistics(w);
+    return stats.count > 0 ? stats.mean : GriddataAverage::methodErrorValue();
+  }
+
   const auto values = this->pixelDataInRadius<double>();
 
   if (values.code() == 0) {
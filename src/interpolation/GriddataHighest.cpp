@@ -27,6 +27,16 @@ GriddataHighest::GriddataHighest(const Adcirc::Raster::Rasterdata *raster,
     : GriddataMethod(raster, attribute, config) {}
 
 double GriddataHighest::computeFromRaster() const {
+  const auto tables = this->integralTables();
+  if (tables) {
+    Adcirc::Raster::RasterIntegralTables::Window w{};
+    if (!this->integralWindow(w)) return GriddataMethod::methodErrorValue();
+    const double zm = tables->windowMaximum(w);
+    return zm == Adcirc::Raster::RasterIntegralTables::noValue()
+               ? GriddataMethod::methodErrorValue()
+               : zm;
+  }
+
   const auto values = this->pixelDataInRadius<double>();
   if (values.code() == 0) {
     double zm = -std::numeric_limits<double>::max();
@@ -49,4 +49,44 @@ std::vector<double> GriddataMethod::computeMultiple() const {
   } else {
     return this->computeMultipleFromRaster();
   }
-}
\ No newline at end of file
+}
+/**
+ * @brief Returns the integral tables if they can be used for this query
+ * @return pointer to the tables, or nullptr if the pixels must be visited
+ *
+ * The tables are built from the raw raster values, so they cannot be used
+ * with lookup tables or when thresholding removes pixels by value
+ */
+const Adcirc::Raster::RasterIntegralTables *GriddataMethod::integralTables()
+    const {
+  if (this->config()->useLookup() ||
+      this->config()->thresholdMethod() !=
+          Interpolation::Threshold::NoThreshold) {
+    return nullptr;
+  }
+  return this->raster()->integralTables();
+}
+
+/**
+ * @brief Generates the integral table query window for this point using the
+ * same search box as the pixel search
+ * @param window query window
+ * @return true if the point is within the raster
+ */
+bool GriddataMethod::integralWindow(
+    Adcirc::Raster::RasterIntegralTables::Window &window) const {
+  Adcirc::Raster::Pixel ul, lr;
+  const double radius = this->attribute()->queryResolution();
+  this->raster()->searchBoxAroundPoint(this->attribute()->point().x(),
+                                       this->attribute()->point().y(), radius,
+                                       ul, lr);
+  if (!ul.isValid() || !lr.isValid()) return false;
+  window = {this->attribute()->point().x(),
+            this->attribute()->point().y(),
+            radius,
+            ul.i(),
+            ul.j(),
+            lr.i(),
+            lr.j()};
+  return true;
+}
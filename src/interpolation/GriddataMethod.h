@@ -68,6 +68,11 @@ class GriddataMethod {
     return std::vector<double>(12, config()->defaultValue());
   }
 
+  const Adcirc::Raster::RasterIntegralTables *integralTables() const;
+
+  bool integralWindow(
+      Adcirc::Raster::RasterIntegralTables::Window &window) const;
+
   template <typename T>
   Adcirc::PixelValueVector<T> pixelDataInSpecifiedRadius(double radius) const {
     Adcirc::Raster::Pixel ul, lr;
@@ -26,6 +26,18 @@ GriddataStandardDeviation::GriddataStandardDeviation(
     : GriddataMethod(raster, attribute, config) {}
 
 double GriddataStandardDeviation::computeFromRaster() const {
+  const auto tables = this->integralTables();
+  if (tables) {
+    Adcirc::Raster::RasterIntegralTables::Window w{};
+    if (!this->integralWindow(w)) return GriddataMethod::methodErrorValue();
+    const auto stats = tables->windowStatistics(w);
+    if (stats.count == 0) return GriddataMethod::methodErrorValue();
+    const double cutoff = stats.mean + m_n * std::sqrt(stats.variance);
+    size_t n = 0;
+    const double a = tables->windowAverageAbove(w, cutoff, n);
+    return n > 0 ? a : GriddataMethod::methodErrorValue();
+  }
+
   const auto values = this->pixelDataInRadius<double>();
   if (values.code() == 0) {
     std::vector<double> z2;
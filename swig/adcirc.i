@@ -33,6 +33,7 @@
 #include "FileTypes.h"
 #include "AdcHash.h"
 #include "HashType.h"
+#include "MeshReorder.h"
 #include "Mesh.h"
 #include "CDate.h"
 #include "Hmdf.h"
@@ -47,6 +48,8 @@
 #include "ElementTable.h"
 #include "NodeTable.h"
 #include "FaceTable.h"
+#include "EdgeTable.h"
+#include "AttributeColumn.h"
 #include "Attribute.h"
 #include "AttributeMetadata.h"
 #include "NodalAttributes.h"
@@ -54,10 +57,15 @@
 #include "ReadOutput.h"
 #include "WriteOutput.h"
 #include "OutputRecord.h"
+#include "TimeReduction.h"
 #include "HarmonicsRecord.h"
+#include "HarmonicsAnalysis.h"
+#include "HarmonicsSynthesis.h"
 #include "HarmonicsOutput.h"
 #include "KDTree.h"
 #include "Projection.h"
+#include "MeshQuality.h"
+#include "RasterizationPlan.h"
 #include "Meshchecker.h"
 #include "Multithreading.h"
 #include "Constants.h"
@@ -95,7 +103,9 @@
 namespace std {
     %template(IntVector) vector<int>;
     %template(SizetVector) vector<size_t>;
+    %template(LongLongVector) vector<long long>;
     %template(DoubleVector) vector<double>;
+    %template(StringVector) vector<std::string>;
     %template(DoubleDoubleVector) vector<vector<double>>;
     %template(SizetSizetVector) vector<vector<size_t>>;
     %template(NodeVector) vector<Adcirc::Geometry::Node*>;
@@ -108,6 +118,7 @@ namespace std {
 %include "FileTypes.h"
 %include "AdcHash.h"
 %include "HashType.h"
+%include "MeshReorder.h"
 %include "Mesh.h"
 %include "CDate.h"
 %include "Hmdf.h"
@@ -122,6 +133,8 @@ namespace std {
 %include "ElementTable.h"
 %include "NodeTable.h"
 %include "FaceTable.h"
+%include "EdgeTable.h"
+%include "AttributeColumn.h"
 %include "Attribute.h"
 %include "AttributeMetadata.h"
 %include "NodalAttributes.h"
@@ -129,10 +142,15 @@ namespace std {
 %include "ReadOutput.h"
 %include "WriteOutput.h"
 %include "OutputRecord.h"
+%include "TimeReduction.h"
 %include "HarmonicsRecord.h"
+%include "HarmonicsAnalysis.h"
+%include "HarmonicsSynthesis.h"
 %include "HarmonicsOutput.h"
 %include "KDTree.h"
 %include "Projection.h"
+%include "MeshQuality.h"
+%include "RasterizationPlan.h"
 %include "Meshchecker.h"
 %include "Multithreading.h"
 %include "Constants.h"
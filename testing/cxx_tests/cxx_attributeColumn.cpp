@@ -0,0 +1,132 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdio>
+#include <string>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+using namespace Adcirc::ModelParameters;
+
+static int fail(const std::string &message) {
+  std::cout << message << std::endl;
+  return 1;
+}
+
+//...Default tracking, changing the defaults and reordering on a bare column
+static int checkColumn() {
+  const size_t nn = 200;
+  AttributeColumn column(nn, {1.0, 2.0});
+  if (column.numValues() != 2 || column.numNonDefault() != 0) {
+    return fail("New column is not all default");
+  }
+
+  column.setValue(5, 1, 3.0);
+  if (column.isDefault(5) || column.numNonDefault() != 1) {
+    return fail("setValue did not mark the node as non-default");
+  }
+  column.setValue(5, 1, 2.0);
+  if (!column.isDefault(5) || column.numNonDefault() != 0) {
+    return fail("setValue back to the default did not clear the node");
+  }
+
+  //...Node 70 is in the second word of the bitmap
+  column.fill(70, 9.0);
+  column.fill(199, 1.0);
+  if (column.isDefault(70) || column.isDefault(199) ||
+      column.numNonDefault() != 2 || column.value(70, 1) != 9.0) {
+    return fail("fill did not mark the nodes as non-default");
+  }
+
+  //...Every node but 70 now differs from the new defaults
+  column.setDefaultValues({9.0, 9.0});
+  if (!column.isDefault(70) || column.isDefault(0) ||
+      column.numNonDefault() != nn - 1) {
+    return fail("setDefaultValues did not recompute the default nodes");
+  }
+  column.setDefaultValues({1.0, 2.0});
+  if (column.numNonDefault() != 2) {
+    return fail("Restoring the defaults did not recompute the default nodes");
+  }
+
+  std::vector<size_t> order(nn);
+  for (size_t i = 0; i < nn; ++i) {
+    order[i] = nn - 1 - i;
+  }
+  column.permute(order);
+  if (column.value(nn - 1 - 70, 0) != 9.0 || column.value(0, 0) != 1.0 ||
+      column.value(0, 1) != 1.0 || column.isDefault(nn - 1 - 70) ||
+      column.isDefault(0) || !column.isDefault(70) ||
+      column.numNonDefault() != 2) {
+    return fail("permute did not move the values and the bitmap");
+  }
+  return 0;
+}
+
+//...Writes through the Attribute proxy reach the column, and metadata
+// default changes are applied to the column when the file is written
+static int checkProxy() {
+  std::unique_ptr<NodalAttributes> fort13(
+      new NodalAttributes("test_files/ms-riv.13"));
+  fort13->read();
+
+  const size_t idx = fort13->locateAttribute("mannings_n_at_sea_floor");
+  AttributeColumn *column = fort13->column(idx);
+  const size_t count = column->numNonDefault();
+
+  size_t node = 0;
+  while (!column->isDefault(node)) ++node;
+
+  Attribute *a = fort13->attribute(idx, node);
+  a->setValue(0, 0.05);
+  if (column->value(node) != 0.05 || column->isDefault(node) ||
+      column->numNonDefault() != count + 1) {
+    return fail("Proxy write did not update the column");
+  }
+  if (fort13->attribute(idx, node) != a) {
+    return fail("Proxy was not reused");
+  }
+  a->setValue(0, column->defaultValues()[0]);
+  if (!column->isDefault(node) || column->numNonDefault() != count) {
+    return fail("Proxy write of the default did not clear the node");
+  }
+
+  fort13->metadata(idx)->setDefaultValue(0.05);
+  a->setValue(0, 0.05);
+  fort13->write("test_files/testwrite_attributeColumn.13");
+  std::remove("test_files/testwrite_attributeColumn.13");
+  size_t expected = 0;
+  for (size_t i = 0; i < column->numNodes(); ++i) {
+    if (column->value(i) != 0.05) ++expected;
+  }
+  if (column->defaultValues()[0] != 0.05 || !column->isDefault(node) ||
+      column->numNonDefault() != expected || expected == 0) {
+    return fail("Metadata default was not applied to the column");
+  }
+  return 0;
+}
+
+int main() {
+  if (checkColumn() != 0) return 1;
+  if (checkProxy() != 0) return 1;
+  std::cout << "Attribute column storage behaves as expected" << std::endl;
+  return 0;
+}
@@ -0,0 +1,174 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "AdcircModules.h"
+
+using namespace Adcirc::ModelParameters;
+
+//...Enough nodes that the first attribute has more non-default lines than
+// fit in one read chunk and every attribute spans several write chunks
+static const size_t c_numNodes = 40000;
+
+static std::string format(const char *fmt, size_t id) {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), fmt, id);
+  return std::string(buffer);
+}
+
+static std::string formatValue(double value, const char *fmt) {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), fmt, value);
+  return std::string(buffer);
+}
+
+//...Builds a fort.13 in the same format that NodalAttributes writes
+static std::string makeFort13() {
+  std::string f = "Synthetic fort.13\n";
+  f += format("%11zu\n", c_numNodes);
+  f += format("%11zu\n", 2);
+  f += "scalar_attribute\nm\n" + format("%11zu\n", 1) +
+       formatValue(0.0, "%12.6f") + "\n";
+  f += "vector_attribute\nm\n" + format("%11zu\n", 3) +
+       formatValue(1.0, "%12.6f") + formatValue(2.0, "%12.6f") +
+       formatValue(3.0, "%12.6f") + "\n";
+
+  std::string scalar, vector;
+  size_t numScalar = 0, numVector = 0;
+  for (size_t i = 1; i <= c_numNodes; ++i) {
+    if (i % 7 != 0) {
+      scalar += format("%11zu  ", i) +
+                formatValue(0.001 * static_cast<double>(i), "%12.6f  ") +
+                "\n";
+      numScalar++;
+    }
+    if (i % 3 == 0) {
+      vector += format("%11zu  ", i);
+      for (size_t k = 0; k < 3; ++k) {
+        vector += formatValue(static_cast<double>(i % 100) + 0.25 * k,
+                              "%12.6f  ");
+      }
+      vector += "\n";
+      numVector++;
+    }
+  }
+  f += "scalar_attribute\n" + format("%11zu\n", numScalar) + scalar;
+  f += "vector_attribute\n" + format("%11zu\n", numVector) + vector;
+  return f;
+}
+
+static std::string readFile(const std::string &filename) {
+  std::ifstream f(filename);
+  std::stringstream s;
+  s << f.rdbuf();
+  return s.str();
+}
+
+static void writeFile(const std::string &filename, const std::string &text) {
+  std::ofstream f(filename);
+  f << text;
+}
+
+static bool readThrows(const std::string &text, const std::string &message) {
+  const std::string filename = "test_files/testwrite_fort13_bad.13";
+  writeFile(filename, text);
+  bool threw = false;
+  try {
+    NodalAttributes fort13(filename);
+    fort13.read();
+  } catch (const std::exception &e) {
+    threw = std::string(e.what()).find(message) != std::string::npos;
+  }
+  std::remove(filename.c_str());
+  return threw;
+}
+
+int main() {
+  const std::string original = makeFort13();
+  const std::string input = "test_files/testwrite_fort13_input.13";
+  const std::string output = "test_files/testwrite_fort13_output.13";
+  writeFile(input, original);
+
+  std::unique_ptr<NodalAttributes> fort13(new NodalAttributes(input));
+  fort13->read();
+  std::remove(input.c_str());
+
+  AttributeColumn *scalar = fort13->column("scalar_attribute");
+  AttributeColumn *vector = fort13->column("vector_attribute");
+  if (scalar->numNonDefault() != c_numNodes - c_numNodes / 7 ||
+      vector->numNonDefault() != c_numNodes / 3 ||
+      scalar->value(16383) != 16.384 || scalar->value(39998) != 39.999 ||
+      !scalar->isDefault(6) || vector->value(29999, 2) != 0.5) {
+    std::cout << "fort.13 values were not read correctly" << std::endl;
+    return 1;
+  }
+
+  fort13->write(output);
+  const std::string rewritten = readFile(output);
+  std::remove(output.c_str());
+  if (rewritten != original) {
+    std::cout << "Rewritten fort.13 does not match the input" << std::endl;
+    return 1;
+  }
+
+  //...Error paths
+  const std::string body = "scalar_attribute\n";
+  const size_t bodyStart = original.find(body, original.find(body) + 1);
+  const size_t firstLine = original.find('\n', bodyStart + body.size()) + 1;
+  const size_t firstLineEnd = original.find('\n', firstLine) + 1;
+
+  if (!readThrows(original.substr(0, firstLine + 1000),
+                  "Unexpected end of file")) {
+    std::cout << "Truncated file did not throw" << std::endl;
+    return 1;
+  }
+
+  std::string badNode = original;
+  badNode.replace(firstLine, firstLineEnd - firstLine,
+                  format("%11zu  ", c_numNodes + 1) +
+                      formatValue(1.0, "%12.6f  ") + "\n");
+  if (!readThrows(badNode, "Error reading file data")) {
+    std::cout << "Unknown node id did not throw" << std::endl;
+    return 1;
+  }
+
+  std::string badValue = original;
+  badValue.replace(firstLine, firstLineEnd - firstLine,
+                   format("%11zu  ", 1) + "   not_a_value\n");
+  if (!readThrows(badValue, "Error reading file data")) {
+    std::cout << "Malformed value line did not throw" << std::endl;
+    return 1;
+  }
+
+  std::string badName = original;
+  badName.replace(bodyStart, body.size(), "unknown_attribute\n");
+  if (!readThrows(badName, "Unknown attribute")) {
+    std::cout << "Unknown attribute did not throw" << std::endl;
+    return 1;
+  }
+
+  std::cout << "fort.13 round trip and error checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,82 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::Harmonics;
+
+  std::unique_ptr<HarmonicsOutput> harm(
+      new HarmonicsOutput("test_files/fort.53"));
+  harm->read();
+
+  //...Reconstruct 30 days of half-hourly water levels and mark the first
+  // node as dry for part of the record
+  HarmonicsSynthesis synthesis(harm.get());
+  HarmonicsAnalysis analysis(harm->numNodes());
+  for (size_t c = 0; c < harm->numConstituents(); ++c) {
+    HarmonicsRecord *r = harm->amplitude(c);
+    analysis.addConstituent(r->name(), r->frequency(), r->nodalFactor(),
+                            r->equilibriumArg());
+  }
+
+  for (size_t i = 0; i < 1440; ++i) {
+    double t = 1800.0 * static_cast<double>(i);
+    std::vector<double> z = synthesis.evaluate(t);
+    if (i % 7 == 0) z[0] = analysis.defaultValue();
+    analysis.add(t, z.data());
+  }
+
+  HarmonicsOutput result;
+  analysis.solve(&result);
+
+  for (size_t c = 0; c < harm->numConstituents(); ++c) {
+    for (size_t i = 0; i < harm->numNodes(); ++i) {
+      double a0 = harm->amplitude(c)->value(i);
+      double a1 = result.amplitude(c)->value(i);
+      double dp = std::remainder(
+          harm->phase(c)->value(i) - result.phase(c)->value(i), 360.0);
+      if (std::abs(a0 - a1) > 1e-6 || (a0 > 1e-4 && std::abs(dp) > 1e-3)) {
+        std::cout << "Mismatch for " << harm->name(c) << " at node " << i
+                  << ": " << a0 << ", " << harm->phase(c)->value(i) << " vs "
+                  << a1 << ", " << result.phase(c)->value(i) << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  std::cout << "Analysis recovered the original constituents" << std::endl;
+
+  result.write("test_files/testwrite_analysis.53");
+  HarmonicsOutput check("test_files/testwrite_analysis.53");
+  check.read();
+  if (check.numNodes() != harm->numNodes() ||
+      std::abs(check.amplitude("M2")->value(10) -
+               harm->amplitude("M2")->value(10)) > 1e-6) {
+    std::cout << "Analysis result was not written correctly" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Wrote analysis result" << std::endl;
+  return 0;
+}
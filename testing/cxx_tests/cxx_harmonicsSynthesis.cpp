@@ -0,0 +1,113 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::Harmonics;
+
+  std::unique_ptr<HarmonicsOutput> harm(
+      new HarmonicsOutput("test_files/fort.53"));
+  harm->read();
+
+  const double deg2rad = M_PI / 180.0;
+  std::vector<size_t> nodes = {0, harm->numNodes() / 2, harm->numNodes() - 1};
+
+  std::vector<double> times;
+  for (size_t i = 0; i < 1000; ++i) {
+    times.push_back(3600.0 + 600.0 * static_cast<double>(i));
+  }
+
+  auto series = harm->synthesize(times, nodes);
+
+  for (size_t t = 0; t < times.size(); ++t) {
+    for (size_t j = 0; j < nodes.size(); ++j) {
+      double expected = 0.0;
+      for (size_t c = 0; c < harm->numConstituents(); ++c) {
+        HarmonicsRecord *a = harm->amplitude(c);
+        HarmonicsRecord *p = harm->phase(c);
+        expected += a->nodalFactor() * a->value(nodes[j]) *
+                    std::cos(a->frequency() * times[t] +
+                             a->equilibriumArg() * deg2rad -
+                             p->value(nodes[j]) * deg2rad);
+      }
+      if (std::abs(series[t][j] - expected) > 1e-8) {
+        std::cout << "Time series mismatch at time " << times[t] << ", node "
+                  << nodes[j] << ": " << series[t][j] << " vs " << expected
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  Adcirc::Output::OutputRecord r = harm->synthesize(times[10]);
+  if (r.numNodes() != harm->numNodes() ||
+      std::abs(r.z(nodes[1]) - series[10][1]) > 1e-10) {
+    std::cout << "Output record does not match time series" << std::endl;
+    return 1;
+  }
+
+  std::unique_ptr<HarmonicsOutput> vel(
+      new HarmonicsOutput("test_files/fort.54"));
+  vel->read();
+
+  const double t0 = times[10];
+  Adcirc::Output::OutputRecord rv = vel->synthesize(t0);
+  if (!rv.metadata()->isVector() || rv.metadata()->isMax()) {
+    std::cout << "Velocity output record has the wrong type" << std::endl;
+    return 1;
+  }
+
+  std::vector<size_t> vnodes = {0, vel->numNodes() / 2, vel->numNodes() - 1};
+  auto useries = vel->synthesize({t0}, vnodes, 0);
+  auto vseries = vel->synthesize({t0}, vnodes, 1);
+
+  for (size_t j = 0; j < vnodes.size(); ++j) {
+    double eu = 0.0;
+    double ev = 0.0;
+    for (size_t c = 0; c < vel->numConstituents(); ++c) {
+      HarmonicsRecord *ua = vel->u_amplitude(c);
+      HarmonicsRecord *up = vel->u_phase(c);
+      HarmonicsRecord *va = vel->v_amplitude(c);
+      HarmonicsRecord *vp = vel->v_phase(c);
+      eu += ua->nodalFactor() * ua->value(vnodes[j]) *
+            std::cos(ua->frequency() * t0 + ua->equilibriumArg() * deg2rad -
+                     up->value(vnodes[j]) * deg2rad);
+      ev += va->nodalFactor() * va->value(vnodes[j]) *
+            std::cos(va->frequency() * t0 + va->equilibriumArg() * deg2rad -
+                     vp->value(vnodes[j]) * deg2rad);
+    }
+    if (std::abs(rv.u(vnodes[j]) - eu) > 1e-8 ||
+        std::abs(rv.v(vnodes[j]) - ev) > 1e-8 ||
+        std::abs(useries[0][j] - eu) > 1e-8 ||
+        std::abs(vseries[0][j] - ev) > 1e-8) {
+      std::cout << "Velocity mismatch at node " << vnodes[j] << ": ("
+                << rv.u(vnodes[j]) << ", " << rv.v(vnodes[j]) << ") vs ("
+                << eu << ", " << ev << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "Synthesis matches direct evaluation" << std::endl;
+  return 0;
+}
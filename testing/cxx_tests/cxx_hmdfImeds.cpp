@@ -0,0 +1,98 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::Output;
+
+  //...Fixed and free format dates, optional seconds and blank lines
+  std::ofstream out("test_files/testwrite_hmdf_input.imeds");
+  out << "% IMEDS generic format\n"
+      << "% year month day hour min sec value\n"
+      << "% test UTC MSL m\n"
+      << "8761724   29.2630000000   -89.9570000000\n"
+      << "2020 01 01 00 00 00 1.5\n"
+      << "2020 1 1 0 6 -2.5e-1\n"
+      << "2020  1  1  0 12 30  3\r\n"
+      << "\n"
+      << "STATION_2,30.0,-90.0\n"
+      << "2020 02 28 23 54 00 -99999.0\n"
+      << "2020 02 28 24 00 00 7.25\n"
+      << "\n";
+  out.close();
+
+  Hmdf hmdf;
+  hmdf.readImeds("test_files/testwrite_hmdf_input.imeds");
+  if (hmdf.nstations() != 2 || hmdf.header3() != "% test UTC MSL m" ||
+      hmdf.station(0)->name() != "8761724" ||
+      hmdf.station(0)->latitude() != 29.263 ||
+      hmdf.station(0)->numSnaps() != 3 ||
+      hmdf.station(1)->longitude() != -90.0 ||
+      hmdf.station(1)->numSnaps() != 2) {
+    std::cout << "IMEDS stations were not read correctly" << std::endl;
+    return 1;
+  }
+
+  const HmdfStation *s0 = hmdf.station(0);
+  const HmdfStation *s1 = hmdf.station(1);
+  if (s0->date(1) != Adcirc::CDate(2020, 1, 1, 0, 6, 0) ||
+      s0->date(2) != Adcirc::CDate(2020, 1, 1, 0, 12, 30) ||
+      s0->data(1) != -0.25 || s0->data(2) != 3.0 ||
+      s1->date(1) != Adcirc::CDate(2020, 2, 29, 0, 0, 0) ||
+      s1->data(1) != 7.25) {
+    std::cout << "IMEDS samples were not read correctly" << std::endl;
+    return 1;
+  }
+
+  //...Written files use fixed format dates
+  hmdf.writeImeds("test_files/testwrite_hmdf_output.imeds");
+  hmdf.writeCsv("test_files/testwrite_hmdf_output.csv");
+
+  std::ifstream imeds("test_files/testwrite_hmdf_output.imeds");
+  std::string line;
+  for (size_t i = 0; i < 7; ++i) std::getline(imeds, line);
+  if (line != "2020 01 01 00 12 30 3.000000e+00") {
+    std::cout << "Incorrect IMEDS line: " << line << std::endl;
+    return 1;
+  }
+
+  std::ifstream csv("test_files/testwrite_hmdf_output.csv");
+  for (size_t i = 0; i < 5; ++i) std::getline(csv, line);
+  if (line != "2020-01-01 00:06:00.0000,-2.5000e-01") {
+    std::cout << "Incorrect CSV line: " << line << std::endl;
+    return 1;
+  }
+
+  Hmdf check;
+  check.readImeds("test_files/testwrite_hmdf_output.imeds");
+  if (check.nstations() != 2 || check.station(1)->name() != "STATION_2" ||
+      check.station(1)->date(1) != s1->date(1) ||
+      check.station(0)->data(2) != s0->data(2)) {
+    std::cout << "IMEDS file was not written correctly" << std::endl;
+    return 1;
+  }
+
+  std::cout << "IMEDS files read and written correctly" << std::endl;
+  return 0;
+}
@@ -0,0 +1,134 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+
+using namespace Adcirc::Output;
+
+static Hmdf makeStations(bool commonTimes, size_t dimension = 1) {
+  Hmdf hmdf(dimension);
+  for (size_t s = 0; s < 3; ++s) {
+    HmdfStation station(dimension);
+    station.setName("station_" + std::to_string(s));
+    station.setId(std::to_string(s));
+    station.setLongitude(-90.0 + static_cast<double>(s));
+    station.setLatitude(30.0);
+    size_t n = commonTimes ? 100 : 100 + 10 * s;
+    std::vector<long long> t(n);
+    std::vector<double> v(n);
+    std::vector<double> u(n);
+    for (size_t i = 0; i < n; ++i) {
+      t[i] = 1577836800000LL + static_cast<long long>(i) * 360000LL;
+      v[i] = static_cast<double>(s) + 0.001 * static_cast<double>(i);
+      u[i] = -v[i];
+    }
+    v[5] = HmdfStation::nullDataValue();
+    u[5] = HmdfStation::nullDataValue();
+    if (dimension == 2) {
+      station.setTimeseries(t, u, v);
+    } else {
+      station.setTimeseries(t, v);
+    }
+    hmdf.addStation(station);
+  }
+  return hmdf;
+}
+
+static bool compare(const Hmdf &a, Hmdf &b) {
+  if (a.nstations() != b.nstations() || a.dimension() != b.dimension()) {
+    return false;
+  }
+  for (size_t s = 0; s < a.nstations(); ++s) {
+    const HmdfStation *sa = a.station(s);
+    const HmdfStation *sb = b.station(s);
+    if (sa->name() != sb->name() || sa->numSnaps() != sb->numSnaps() ||
+        sa->longitude() != sb->longitude()) {
+      return false;
+    }
+    for (size_t i = 0; i < sa->numSnaps(); ++i) {
+      if (sa->epochMilliseconds(i) != sb->epochMilliseconds(i)) return false;
+      for (size_t d = 0; d < a.dimension(); ++d) {
+        if (i == 5) {
+          if (sb->data(i, d) != sb->nullValue()) return false;
+        } else if (std::abs(sa->data(i, d) - sb->data(i, d)) > 1e-12) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+int main() {
+  //...Stations with different sample times are written as a ragged array
+  Hmdf ragged = makeStations(false);
+  ragged.setNetcdfLayout(Hmdf::HmdfNetcdfDsg);
+  ragged.write("test_files/testwrite_hmdf_ragged.nc");
+  Hmdf raggedCheck;
+  if (raggedCheck.readNetcdf("test_files/testwrite_hmdf_ragged.nc") != 0 ||
+      !compare(ragged, raggedCheck)) {
+    std::cout << "Ragged station file was not read correctly" << std::endl;
+    return 1;
+  }
+
+  //...Stations with the same times are written as a [station, time] array
+  Hmdf orthogonal = makeStations(true);
+  orthogonal.setNetcdfLayout(Hmdf::HmdfNetcdfDsg);
+  orthogonal.write("test_files/testwrite_hmdf_orthogonal.nc");
+  Hmdf orthogonalCheck;
+  if (orthogonalCheck.readNetcdf("test_files/testwrite_hmdf_orthogonal.nc") !=
+          0 ||
+      !compare(orthogonal, orthogonalCheck)) {
+    std::cout << "Orthogonal station file was not read correctly" << std::endl;
+    return 1;
+  }
+
+  //...Vector stations are written as data_u and data_v in both layouts
+  for (const bool commonTimes : {false, true}) {
+    Hmdf vector = makeStations(commonTimes, 2);
+    vector.setNetcdfLayout(Hmdf::HmdfNetcdfDsg);
+    vector.write("test_files/testwrite_hmdf_vector.nc");
+    Hmdf vectorCheck(2);
+    if (vectorCheck.readNetcdf("test_files/testwrite_hmdf_vector.nc") != 0 ||
+        !compare(vector, vectorCheck)) {
+      std::cout << "Vector station file was not read correctly" << std::endl;
+      return 1;
+    }
+  }
+
+  //...The legacy layout can still be read
+  Hmdf legacy = makeStations(false);
+  legacy.write("test_files/testwrite_hmdf_legacy.nc");
+  Hmdf legacyCheck;
+  if (legacyCheck.readNetcdf("test_files/testwrite_hmdf_legacy.nc") != 0 ||
+      legacyCheck.nstations() != 3 ||
+      legacyCheck.station(2)->numSnaps() != 120 ||
+      legacyCheck.station(2)->epochMilliseconds(10) !=
+          legacy.station(2)->epochMilliseconds(10)) {
+    std::cout << "Legacy station file was not read correctly" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Station netCDF files read correctly" << std::endl;
+  return 0;
+}
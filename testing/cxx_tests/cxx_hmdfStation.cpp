@@ -0,0 +1,98 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::Output;
+
+  //...Samples appended one at a time are stored by column
+  HmdfStation station(1);
+  Adcirc::CDate start(2020, 1, 1, 0, 0, 0);
+  for (size_t i = 0; i < 240; ++i) {
+    station.setNext(start + static_cast<long>(360 * i),
+                    static_cast<double>(i) * 0.01);
+  }
+  const std::vector<long long> *t = station.epochMillisecondsView();
+  const std::vector<double> *v = station.dataView();
+  if (t->size() != 240 || v->size() != 240 ||
+      station.epochMilliseconds(10) != start.toSeconds() * 1000 + 3600000 ||
+      station.date(10) != Adcirc::CDate(2020, 1, 1, 1, 0, 0) ||
+      (*v)[10] != 0.1) {
+    std::cout << "Appended samples were not stored correctly" << std::endl;
+    return 1;
+  }
+
+  //...Bounds ignore null values and are refreshed after changes
+  station.setData(HmdfStation::nullDataValue(), 0);
+  Adcirc::CDate dmin, dmax;
+  double vmin, vmax;
+  station.dataBounds(dmin, dmax, vmin, vmax);
+  if (dmin != start || dmax != station.date(239) || vmin != 0.01 ||
+      vmax != 2.39) {
+    std::cout << "Incorrect bounds: " << dmin << " " << dmax << " " << vmin
+              << " " << vmax << std::endl;
+    return 1;
+  }
+  station.setData(5.0, 20);
+  station.dataBounds(dmin, dmax, vmin, vmax);
+  if (vmax != 5.0) {
+    std::cout << "Bounds were not updated" << std::endl;
+    return 1;
+  }
+
+  //...Bulk assignment of a vector station
+  HmdfStation vector(2);
+  std::vector<long long> times = {3000, 1000, 2000};
+  std::vector<double> u = {3.0, 1.0, 2.0};
+  std::vector<double> w = {-3.0, -1.0, -2.0};
+  vector.setTimeseries(times, u, w);
+  vector.sanitize(-2.5, 2.5);
+  if (vector.numSnaps() != 3 || vector.epochMilliseconds(0) != 1000 ||
+      vector.data(0, 1) != -1.0 ||
+      vector.data(2, 0) != HmdfStation::nullDataValue() ||
+      (*vector.dataView(1))[1] != -2.0) {
+    std::cout << "Vector station was not sorted and sanitized" << std::endl;
+    return 1;
+  }
+
+  //...Round trip through an IMEDS file
+  Hmdf hmdf(1);
+  station.setName("test_station");
+  station.setLatitude(30.0);
+  station.setLongitude(-90.0);
+  hmdf.addStation(station);
+  hmdf.write("test_files/testwrite_hmdf.imeds");
+
+  Hmdf check(1);
+  check.readImeds("test_files/testwrite_hmdf.imeds");
+  if (check.nstations() != 1 ||
+      check.station(0)->numSnaps() != station.numSnaps() ||
+      check.station(0)->date(100) != station.date(100) ||
+      std::abs(check.station(0)->data(100) - station.data(100)) > 1e-6) {
+    std::cout << "IMEDS file was not written correctly" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Station time series stored correctly" << std::endl;
+  return 0;
+}
@@ -0,0 +1,65 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2020 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  using namespace Adcirc::Interpolation;
+
+  std::unique_ptr<Mesh> m(new Mesh("test_files/ms-riv.grd"));
+  m->read();
+  m->defineProjection(4326, true);
+  m->reproject(26915);
+
+  std::unique_ptr<Griddata> g(
+      new Griddata(m.get(), "test_files/bathy_sampleraster.tif", 26915));
+  std::unique_ptr<Griddata> gi(
+      new Griddata(m.get(), "test_files/bathy_sampleraster.tif", 26915));
+
+  const Method methods[] = {Average, Highest, PlusTwoSigma};
+  for (size_t i = 0; i < m->numNodes(); ++i) {
+    g->setInterpolationFlag(i, methods[i % 3]);
+    gi->setInterpolationFlag(i, methods[i % 3]);
+    g->setFilterSize(i, 1.0 + static_cast<double>(i % 4));
+    gi->setFilterSize(i, 1.0 + static_cast<double>(i % 4));
+  }
+
+  g->setRasterInMemory(true);
+  gi->setUseIntegralTables(true);
+
+  std::cout << "Interpolating with pixel search..." << std::endl;
+  std::vector<double> r = g->computeValuesFromRaster();
+
+  std::cout << "Interpolating with integral tables..." << std::endl;
+  std::vector<double> ri = gi->computeValuesFromRaster();
+
+  for (size_t i = 0; i < r.size(); ++i) {
+    if (std::abs(r[i] - ri[i]) > 0.000001) {
+      std::cout << "Mismatch at node " << i << ": " << r[i] << " " << ri[i]
+                << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "RasterMosaic.h"
+#include "gdal_priv.h"
+#include "ogr_spatialref.h"
+
+//...Writes a square raster with a constant value and an optional block of
+// nodata pixels
+static void makeRaster(const std::string &filename, double xmin, float value,
+                       bool hole) {
+  const int n = 40;
+  const double dx = 10.0;
+  GDALAllRegister();
+  GDALDriver *driver = GetGDALDriverManager()->GetDriverByName("GTiff");
+  GDALDataset *raster =
+      driver->Create(filename.c_str(), n, n, 1, GDT_Float32, nullptr);
+  double transform[6] = {xmin, dx, 0.0, 400.0, 0.0, -dx};
+  raster->SetGeoTransform(transform);
+
+  OGRSpatialReference sref;
+  sref.importFromEPSG(26915);
+  char *wkt = nullptr;
+  sref.exportToWkt(&wkt);
+  raster->SetProjection(wkt);
+  CPLFree(wkt);
+
+  std::vector<float> data(n * n, value);
+  if (hole) {
+    for (int j = 10; j < 20; ++j) {
+      for (int i = 25; i < 35; ++i) {
+        data[j * n + i] = -9999.0f;
+      }
+    }
+  }
+  GDALRasterBand *band = raster->GetRasterBand(1);
+  band->SetNoDataValue(-9999.0);
+  band->RasterIO(GF_Write, 0, 0, n, n, data.data(), n, n, GDT_Float32, 0, 0);
+  GDALClose(static_cast<GDALDatasetH>(raster));
+}
+
+static bool check(const std::vector<double> &r,
+                  const std::vector<double> &expected) {
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (std::abs(r[i] - expected[i]) > 1e-6) {
+      std::cout << "Point " << i << ": expected " << expected[i] << ", got "
+                << r[i] << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  using namespace Adcirc::Interpolation;
+
+  //...Raster a covers 0-400 with a nodata hole at x=250-350, y=200-300.
+  // Raster b covers 200-600
+  const std::string a = "test_files/testwrite_mosaic_a.tif";
+  const std::string b = "test_files/testwrite_mosaic_b.tif";
+  makeRaster(a, 0.0, 1.0f, true);
+  makeRaster(b, 200.0, 2.0f, false);
+
+  //...Candidates are found from the r-tree and ordered by priority
+  Adcirc::Raster::RasterMosaic mosaic;
+  mosaic.addRaster(a, 1);
+  mosaic.addRaster(b, 2);
+  if (!mosaic.open() || mosaic.primary() != 1 ||
+      mosaic.candidates(300.0, 50.0, 10.0) != std::vector<size_t>{1, 0} ||
+      mosaic.candidates(50.0, 50.0, 10.0) != std::vector<size_t>{0} ||
+      mosaic.candidates(500.0, 50.0, 10.0) != std::vector<size_t>{1} ||
+      !mosaic.candidates(1000.0, 1000.0, 10.0).empty()) {
+    std::cout << "Incorrect raster candidates" << std::endl;
+    return 1;
+  }
+
+  //...Points in a only, the overlap, the hole in a and b only
+  const std::vector<double> x = {50.0, 300.0, 300.0, 500.0};
+  const std::vector<double> y = {50.0, 50.0, 250.0, 50.0};
+  const std::vector<double> resolution(x.size(), 20.0);
+  const std::vector<std::string> files = {a, b};
+
+  Griddata aFirst(x, y, resolution, files, 26915, 26915, {2, 1});
+  aFirst.setInterpolationFlags(Average);
+  if (!check(aFirst.computeValuesFromRaster(), {1.0, 1.0, 2.0, 2.0})) {
+    std::cout << "Incorrect values with raster a first" << std::endl;
+    return 1;
+  }
+
+  Griddata bFirst(x, y, resolution, files, 26915, 26915, {1, 2});
+  bFirst.setInterpolationFlags(Average);
+  if (!check(bFirst.computeValuesFromRaster(), {1.0, 2.0, 2.0, 2.0})) {
+    std::cout << "Incorrect values with raster b first" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
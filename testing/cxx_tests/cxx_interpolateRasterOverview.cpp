@@ -0,0 +1,107 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "RasterData.h"
+
+int main() {
+  using namespace Adcirc::Interpolation;
+  using Adcirc::Raster::Rasterdata;
+
+  const std::string rasterFile = "test_files/bathy_sampleraster.tif";
+
+  //...A downsampled raster averages the valid pixels in each 2x2 block
+  Rasterdata raster(rasterFile);
+  raster.open();
+  raster.read();
+  std::unique_ptr<Rasterdata> half = raster.downsample();
+  const double nodata = raster.nodata<double>();
+  if (half->nx() != (raster.nx() + 1) / 2 ||
+      half->ny() != (raster.ny() + 1) / 2 ||
+      std::abs(half->dx() - 2.0 * raster.dx()) > 1e-9) {
+    std::cout << "Downsampled raster has the wrong size" << std::endl;
+    return 1;
+  }
+  for (size_t j = 0; j < half->ny(); j += 7) {
+    for (size_t i = 0; i < half->nx(); i += 7) {
+      double sum = 0.0;
+      size_t n = 0;
+      for (size_t jj = 2 * j; jj < std::min(2 * j + 2, raster.ny()); ++jj) {
+        for (size_t ii = 2 * i; ii < std::min(2 * i + 2, raster.nx()); ++ii) {
+          const double z = raster.pixelValue<double>(ii, jj);
+          if (z != nodata) {
+            sum += z;
+            n++;
+          }
+        }
+      }
+      const double expected = n > 0 ? sum / static_cast<double>(n) : nodata;
+      if (std::abs(half->pixelValue<double>(i, j) - expected) > 1e-9) {
+        std::cout << "Incorrect downsampled value at " << i << ", " << j
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  //...Query points near the center of the raster with small and large
+  // search radii
+  const double dx = raster.dx();
+  const double xc = 0.5 * (raster.xmin() + raster.xmax());
+  const double yc = 0.5 * (raster.ymin() + raster.ymax());
+  std::vector<double> x, y, resolution;
+  for (size_t i = 0; i < 16; ++i) {
+    x.push_back(xc + static_cast<double>(i % 4) * 3.0 * dx);
+    y.push_back(yc + static_cast<double>(i / 4) * 3.0 * dx);
+    resolution.push_back(i < 8 ? 2.0 * dx : 64.0 * dx);
+  }
+
+  const Method methods[] = {Average, Highest};
+  for (const auto method : methods) {
+    Griddata full(x, y, resolution, rasterFile, 26915, 26915);
+    Griddata reduced(x, y, resolution, rasterFile, 26915, 26915);
+    full.setInterpolationFlags(method);
+    reduced.setInterpolationFlags(method);
+    full.setRasterInMemory(true);
+    reduced.setRasterInMemory(true);
+    reduced.setRasterOverviewFraction(0.25);
+
+    const std::vector<double> r = full.computeValuesFromRaster();
+    const std::vector<double> rr = reduced.computeValuesFromRaster();
+
+    for (size_t i = 0; i < x.size(); ++i) {
+      //...Small radii and methods other than the averages always use the
+      // full resolution raster
+      const bool exact = i < 8 || method != Average;
+      const double tolerance = exact ? 1e-9 : 0.05 * (1.0 + std::abs(r[i]));
+      if (std::abs(r[i] - rr[i]) > tolerance) {
+        std::cout << "Mismatch at point " << i << " for method " << method
+                  << ": " << r[i] << " " << rr[i] << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+static bool near(double a, double b) { return std::abs(a - b) < 1e-12; }
+
+//...An equilateral triangle and a right isosceles triangle sharing the edge
+// from (0,0) to (2,0), plus a separate 2x2 square that touches node (2,0)
+static int checkHandBuiltMesh() {
+  using namespace Adcirc::Geometry;
+  const double s3 = std::sqrt(3.0);
+  const double s2 = std::sqrt(2.0);
+
+  Mesh m;
+  m.resizeMesh(7, 3, 0, 0);
+  m.addNode(0, Node(1, 0.0, 0.0, 0.0));
+  m.addNode(1, Node(2, 2.0, 0.0, 0.0));
+  m.addNode(2, Node(3, 1.0, s3, 0.0));
+  m.addNode(3, Node(4, 1.0, -1.0, 0.0));
+  m.addNode(4, Node(5, 4.0, 0.0, 0.0));
+  m.addNode(5, Node(6, 4.0, 2.0, 0.0));
+  m.addNode(6, Node(7, 2.0, 2.0, 0.0));
+  m.addElement(0, Element(1, m.node(0), m.node(1), m.node(2)));
+  m.addElement(1, Element(2, m.node(0), m.node(3), m.node(1)));
+  m.addElement(2, Element(3, m.node(1), m.node(4), m.node(5), m.node(6)));
+
+  Adcirc::Utility::MeshQuality q(&m);
+  q.compute(1);
+
+  const std::vector<double> area = {s3, 1.0, 4.0};
+  const std::vector<double> minAngle = {60.0, 45.0, 90.0};
+  const std::vector<double> maxAngle = {60.0, 90.0, 90.0};
+  const std::vector<double> aspectRatio = {1.0, s2, 1.0};
+  const std::vector<double> skewness = {0.0, 0.25, 0.0};
+  const std::vector<double> size = {2.0, (2.0 + 2.0 * s2) / 3.0, 2.0};
+  const std::vector<double> orthogonality = {0.0, 0.0, 0.0};
+  for (size_t i = 0; i < 3; ++i) {
+    if (!near(q.area()[i], area[i]) || !near(q.minAngle()[i], minAngle[i]) ||
+        !near(q.maxAngle()[i], maxAngle[i]) ||
+        !near(q.aspectRatio()[i], aspectRatio[i]) ||
+        !near(q.skewness()[i], skewness[i]) ||
+        !near(q.elementSize()[i], size[i]) ||
+        !near(q.orthogonality()[i], orthogonality[i])) {
+      std::cout << "Element " << i << " of the hand built mesh has "
+                << "unexpected metrics" << std::endl;
+      return 1;
+    }
+  }
+
+  const std::vector<uint32_t> valence = {3, 5, 2, 2, 2, 2, 2};
+  const std::vector<double> meshSize = {
+      (size[0] + size[1]) / 2.0, (size[0] + size[1] + size[2]) / 3.0,
+      size[0], size[1], size[2], size[2], size[2]};
+  for (size_t i = 0; i < 7; ++i) {
+    if (q.valence()[i] != valence[i] || !near(q.meshSize()[i], meshSize[i])) {
+      std::cout << "Node " << i << " of the hand built mesh has unexpected "
+                << "metrics" << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+  if (checkHandBuiltMesh() != 0) return 1;
+
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  Adcirc::Utility::MeshQuality quality(mesh.get());
+  quality.compute(2);
+
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    if (quality.area()[i] <= 0.0) {
+      std::cout << "Element " << i << " has zero area" << std::endl;
+      return 1;
+    }
+    if (quality.minAngle()[i] <= 0.0 || quality.maxAngle()[i] >= 180.0 ||
+        quality.minAngle()[i] > quality.maxAngle()[i]) {
+      std::cout << "Element " << i << " has invalid angles" << std::endl;
+      return 1;
+    }
+    if (quality.skewness()[i] < 0.0 || quality.skewness()[i] > 1.0 ||
+        quality.orthogonality()[i] < 0.0 ||
+        quality.orthogonality()[i] > 1.0) {
+      std::cout << "Element " << i << " has invalid skewness or orthogonality"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  size_t sumValence = 0;
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    if (quality.valence()[i] == 0) {
+      std::cout << "Node " << i << " is disjoint" << std::endl;
+      return 1;
+    }
+    sumValence += quality.valence()[i];
+  }
+
+  //...Each edge is counted once from each end
+  size_t numEdges = mesh->topology()->edgeTable()->numEdges();
+  if (sumValence != 2 * numEdges) {
+    std::cout << "Valence does not match the number of edges" << std::endl;
+    return 1;
+  }
+
+  Adcirc::Utility::MeshChecker checker(mesh.get());
+  checker.setNumThreads(2);
+  if (checker.quality()->minAngle() != quality.minAngle()) {
+    std::cout << "MeshChecker quality does not match" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
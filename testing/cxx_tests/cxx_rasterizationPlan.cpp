@@ -0,0 +1,180 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#include "AdcircModules.h"
+
+//...Serial reference for one pixel using the rules of Mesh::toRaster
+static double reference(const double *v, const double *w, double nullvalue,
+                        bool partialWetting) {
+  const double dry = adcircmodules_default_value<double>();
+  bool b[3];
+  int numWet = 0;
+  for (size_t k = 0; k < 3; ++k) {
+    b[k] = v[k] == nullvalue || (partialWetting && v[k] == dry);
+    if (!b[k]) numWet++;
+  }
+  if (numWet == 3) return w[0] * v[0] + w[1] * v[1] + w[2] * v[2];
+  if (!partialWetting || numWet == 0) return nullvalue;
+  double ws = 0.0, s = 0.0;
+  for (size_t k = 0; k < 3; ++k) {
+    if (b[k]) continue;
+    ws += w[k];
+    s += w[k] * v[k];
+  }
+  if (numWet == 1) {
+    for (size_t k = 0; k < 3; ++k) {
+      if (!b[k]) return v[k];
+    }
+  }
+  return ws == 0.0 ? nullvalue : s / ws;
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  std::vector<double> z(mesh->numNodes());
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    z[i] = mesh->node(i)->z();
+  }
+
+  std::vector<double> extent = mesh->extent();
+  const double resolution = (extent[2] - extent[0]) / 200.0;
+
+  Adcirc::Utility::RasterizationPlan plan(mesh.get(), extent, resolution);
+  std::vector<float> r = plan.apply(z, -99999.0, false);
+
+  if (plan.numActivePixels() == 0) {
+    std::cout << "No pixels found inside the mesh" << std::endl;
+    return 1;
+  }
+
+  //...Compare against a direct search at every pixel
+  std::vector<double> w(3);
+  for (size_t j = 0; j < plan.ny(); ++j) {
+    for (size_t i = 0; i < plan.nx(); ++i) {
+      double x = plan.xmin() + (i + 0.5) * resolution;
+      double y = plan.ymax() - (j + 0.5) * resolution;
+      size_t e = mesh->findElement(x, y, w);
+      double expected = -99999.0;
+      if (e != adcircmodules_default_value<size_t>()) {
+        Element *el = mesh->element(e);
+        expected = 0.0;
+        for (size_t k = 0; k < 3; ++k) {
+          expected += w[k] * el->node(k)->z();
+        }
+      }
+      float v = r[j * plan.nx() + i];
+      if (std::abs(v - expected) > 1e-3 * std::max(1.0, std::abs(expected))) {
+        std::cout << "Pixel " << i << ", " << j << ": expected " << expected
+                  << ", got " << v << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  //...Dry and null nodes, covering pixels with one, two and three dry nodes
+  const double nullvalue = -99999.0;
+  std::vector<double> zdry = z;
+  for (size_t i = 0; i < zdry.size(); ++i) {
+    if (i % 3 == 0) zdry[i] = nullvalue;
+    if (i % 5 == 0) zdry[i] = adcircmodules_default_value<double>();
+  }
+  for (const bool partialWetting : {true, false}) {
+    //...Without partial wetting dry nodes are expected to hold the null value
+    if (!partialWetting) {
+      std::replace(zdry.begin(), zdry.end(),
+                   adcircmodules_default_value<double>(), nullvalue);
+    }
+    std::vector<float> rd = plan.apply(zdry, nullvalue, partialWetting);
+    size_t numDry[4] = {0, 0, 0, 0};
+    for (size_t j = 0; j < plan.ny(); ++j) {
+      for (size_t i = 0; i < plan.nx(); ++i) {
+        double x = plan.xmin() + (i + 0.5) * resolution;
+        double y = plan.ymax() - (j + 0.5) * resolution;
+        size_t e = mesh->findElement(x, y, w);
+        double expected = nullvalue;
+        if (e != adcircmodules_default_value<size_t>()) {
+          Element *el = mesh->element(e);
+          double v[3];
+          size_t nd = 0;
+          for (size_t k = 0; k < 3; ++k) {
+            v[k] = zdry[mesh->nodeIndexById(el->node(k)->id())];
+            if (v[k] == nullvalue ||
+                v[k] == adcircmodules_default_value<double>()) {
+              nd++;
+            }
+          }
+          numDry[nd]++;
+          expected = reference(v, w.data(), nullvalue, partialWetting);
+        }
+        float value = rd[j * plan.nx() + i];
+        if (std::abs(value - expected) >
+            1e-3 * std::max(1.0, std::abs(expected))) {
+          std::cout << "Dry pixel " << i << ", " << j << ": expected "
+                    << expected << ", got " << value << std::endl;
+          return 1;
+        }
+      }
+    }
+    if (numDry[1] == 0 || numDry[2] == 0 || numDry[3] == 0) {
+      std::cout << "Dry node cases were not covered" << std::endl;
+      return 1;
+    }
+  }
+
+  plan.save("test_files/ms-riv.rplan");
+  Adcirc::Utility::RasterizationPlan loaded;
+  loaded.load("test_files/ms-riv.rplan");
+  std::vector<float> r2 = loaded.apply(z, -99999.0, false);
+  if (loaded.numActivePixels() != plan.numActivePixels() || r2 != r) {
+    std::cout << "Loaded plan does not match" << std::endl;
+    return 1;
+  }
+
+  //...A plan referencing a node outside the mesh is rejected. The first node
+  // index follows the 72 byte header and the pixel indices
+  {
+    std::fstream f("test_files/ms-riv.rplan",
+                   std::ios::in | std::ios::out | std::ios::binary);
+    const uint32_t bad = static_cast<uint32_t>(mesh->numNodes());
+    f.seekp(72 + 8 * plan.numActivePixels());
+    f.write(reinterpret_cast<const char *>(&bad), sizeof(bad));
+  }
+  bool rejected = false;
+  try {
+    Adcirc::Utility::RasterizationPlan corrupt;
+    corrupt.load("test_files/ms-riv.rplan");
+  } catch (const std::exception &e) {
+    rejected = true;
+  }
+  if (!rejected) {
+    std::cout << "Corrupt plan was not rejected" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
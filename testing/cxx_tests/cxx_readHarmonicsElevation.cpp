@@ -21,6 +21,32 @@
 
 #include "AdcircModules.h"
 
+//...Reads the file again in small blocks so that records are split across
+// reads, including blocks shorter than one record, and compares every value
+static bool checkBlockReads(Adcirc::Harmonics::HarmonicsOutput &reference) {
+  for (const size_t bytes : {64, 997}) {
+    Adcirc::Harmonics::HarmonicsOutput split("test_files/fort.53");
+    split.setAsciiReadSize(bytes);
+    split.read();
+    for (size_t c = 0; c < reference.numConstituents(); ++c) {
+      for (size_t k = 0; k < 1; ++k) {
+        const double *a0 = reference.amplitudeData(c, k);
+        const double *p0 = reference.phaseData(c, k);
+        const double *a1 = split.amplitudeData(c, k);
+        const double *p1 = split.phaseData(c, k);
+        for (size_t i = 0; i < reference.numNodes(); ++i) {
+          if (a0[i] != a1[i] || p0[i] != p1[i]) {
+            std::cout << "Read with " << bytes << " byte blocks differs at "
+                      << "node " << i << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
 int main() {
   using namespace Adcirc::Geometry;
   using namespace Adcirc::Harmonics;
@@ -39,6 +65,8 @@ int main() {
     return 1;
   }
 
+  if (!checkBlockReads(*harm)) return 1;
+
   std::cout << "Validated read\n";
   std::cout.flush();
 
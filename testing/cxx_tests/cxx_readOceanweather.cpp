@@ -0,0 +1,112 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "AdcircModules.h"
+
+//...Values that fill the F10.4 columns so that adjacent values touch
+static double pressure(size_t domain, size_t snap, size_t i) {
+  return 1013.0 - 0.0001 * static_cast<double>(i + 100 * snap + domain);
+}
+
+static double wind(size_t domain, size_t snap, size_t i, size_t component) {
+  return -1234.5678 + static_cast<double>(i) * 0.25 +
+         static_cast<double>(10 * snap + domain + component);
+}
+
+static void writeBlock(FILE *f, size_t n, size_t domain, size_t snap,
+                       int type) {
+  for (size_t i = 0; i < n; ++i) {
+    const double v = type < 0 ? pressure(domain, snap, i)
+                              : wind(domain, snap, i, type);
+    std::fprintf(f, "%10.4f", v);
+    if (i % 8 == 7 || i == n - 1) std::fprintf(f, "\n");
+  }
+}
+
+static void writeOwi(const std::string &filename, size_t domain, size_t nx,
+                     size_t ny, bool isWind) {
+  FILE *f = std::fopen(filename.c_str(), "w");
+  std::fprintf(f, "%-55s%10s     %10s\n", "Oceanweather WIN/PRE Format",
+               "2005082800", "2005082801");
+  for (size_t snap = 0; snap < 2; ++snap) {
+    std::fprintf(f,
+                 "iLat=%4diLong=%4dDX=%6.4fDY=%6.4fSWLat=%8.5fSWLon=%8.4f"
+                 "DT=2005082800%02d\n",
+                 static_cast<int>(ny), static_cast<int>(nx), 0.25, 0.25,
+                 25.0 + domain, -90.0 - domain, static_cast<int>(15 * snap));
+    if (isWind) {
+      writeBlock(f, nx * ny, domain, snap, 0);
+      writeBlock(f, nx * ny, domain, snap, 1);
+    } else {
+      writeBlock(f, nx * ny, domain, snap, -1);
+    }
+  }
+  std::fclose(f);
+}
+
+int main() {
+  const size_t nx[] = {13, 20};
+  const size_t ny[] = {11, 8};
+
+  Adcirc::Oceanweather owi;
+  for (size_t d = 0; d < 2; ++d) {
+    const std::string base = "test_files/testwrite_owi_" + std::to_string(d);
+    writeOwi(base + ".pre", d, nx[d], ny[d], false);
+    writeOwi(base + ".win", d, nx[d], ny[d], true);
+    owi.addDomain(base + ".pre", base + ".win");
+  }
+
+  for (size_t snap = 0; snap < 2; ++snap) {
+    if (owi.read() != 0) {
+      std::cout << "Error reading snap " << snap << std::endl;
+      return 1;
+    }
+    Adcirc::OceanweatherRecord record = owi.record();
+    if (record.current_time() !=
+        Adcirc::CDate(2005, 8, 28, 0, static_cast<int>(15 * snap), 0)) {
+      std::cout << "Incorrect time for snap " << snap << std::endl;
+      return 1;
+    }
+    for (size_t d = 0; d < 2; ++d) {
+      const Adcirc::OceanweatherRecord::Domain *dom = record.domain(d);
+      if (dom->grid.nx != nx[d] || dom->grid.ny != ny[d] ||
+          dom->data_pressure.size() != nx[d] * ny[d]) {
+        std::cout << "Incorrect grid for domain " << d << std::endl;
+        return 1;
+      }
+      for (size_t i = 0; i < nx[d] * ny[d]; ++i) {
+        if (std::abs(dom->data_pressure[i] - pressure(d, snap, i)) > 1e-6 ||
+            std::abs(dom->data_u[i] - wind(d, snap, i, 0)) > 1e-6 ||
+            std::abs(dom->data_v[i] - wind(d, snap, i, 1)) > 1e-6) {
+          std::cout << "Incorrect value at " << i << " in domain " << d
+                    << std::endl;
+          return 1;
+        }
+      }
+    }
+  }
+  owi.close();
+
+  std::cout << "Oceanweather files read correctly" << std::endl;
+  return 0;
+}
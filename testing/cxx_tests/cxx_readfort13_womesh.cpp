@@ -56,5 +56,20 @@ int main() {
   std::cout << "Now attempting to re-write fort.13..." << std::endl;
   fort13->write("test_files/ms-riv-rewrite.13");
 
+  std::unique_ptr<NodalAttributes> rewrite(
+      new Adcirc::ModelParameters::NodalAttributes(
+          "test_files/ms-riv-rewrite.13"));
+  rewrite->read();
+  if (rewrite->numParameters() != fort13->numParameters()) return 1;
+  for (size_t i = 0; i < fort13->numParameters(); ++i) {
+    if (rewrite->metadata(i)->getDefaultValues() !=
+            fort13->metadata(i)->getDefaultValues() ||
+        rewrite->column(i)->data() != fort13->column(i)->data()) {
+      std::cout << "Rewritten attribute " << fort13->attributeNames(i)
+                << " does not match" << std::endl;
+      return 1;
+    }
+  }
+
   return 0;
 }
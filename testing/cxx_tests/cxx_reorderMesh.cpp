@@ -0,0 +1,73 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <iostream>
+#include <memory>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::Geometry;
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+
+  std::vector<double> x = mesh->x();
+  std::vector<std::vector<size_t>> connectivity = mesh->connectivity();
+
+  Adcirc::Output::OutputRecord record(1, mesh->numNodes(), false, false, 1);
+  record.setAll(x);
+
+  std::vector<size_t> order = mesh->reorder(ReorderReverseCuthillMcKee);
+  record.permute(order);
+
+  for (size_t i = 0; i < mesh->numNodes(); ++i) {
+    if (mesh->node(i)->x() != x[order[i]] ||
+        record.z(i) != mesh->node(i)->x()) {
+      std::cout << "Node " << i << " was not permuted correctly" << std::endl;
+      return 1;
+    }
+  }
+
+  //...Ids are kept as labels, so the connectivity by id is unchanged
+  for (size_t i = 0; i < mesh->numElements(); ++i) {
+    Element *e = mesh->element(i);
+    const auto &c = connectivity[e->id() - 1];
+    for (size_t j = 0; j < e->n(); ++j) {
+      if (e->node(j)->id() != c[j] || mesh->nodeById(c[j]) != e->node(j)) {
+        std::cout << "Element " << e->id() << " connectivity is incorrect"
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  size_t nearest =
+      mesh->findNearestNode(mesh->node(10)->x(), mesh->node(10)->y());
+  if (nearest != 10) {
+    std::cout << "Search tree was not rebuilt" << std::endl;
+    return 1;
+  }
+
+  mesh->reorder(ReorderHilbert, true);
+  if (!mesh->nodeOrderingIsLogical() || !mesh->elementOrderingIsLogical()) {
+    std::cout << "Renumbered mesh is not in order" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,293 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Mesh.h"
+#include "ReadOutput.h"
+#include "StationInterpolation.h"
+
+using Adcirc::Output::ReadOutput;
+using Adcirc::Output::StationInterpolation;
+using Adcirc::Output::StationInterpolationOptions;
+
+static bool checkVectorizedDryValues() {
+  const double dflt = -99999.0;
+  const size_t nPerPattern = 1000;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> value(-5.0, 5.0);
+  std::uniform_real_distribution<double> weight(0.0, 1.0);
+
+  //...Every combination of wet and dry vertices, from none to all three
+  std::array<std::vector<double>, 3> v;
+  std::array<std::vector<double>, 3> w;
+  for (size_t pattern = 0; pattern < 8; ++pattern) {
+    for (size_t i = 0; i < nPerPattern; ++i) {
+      double w0 = weight(gen);
+      double w1 = weight(gen) * (1.0 - w0);
+      std::array<double, 3> wt = {w0, w1, 1.0 - w0 - w1};
+      for (size_t k = 0; k < 3; ++k) {
+        const bool dry = (pattern >> k) & 1;
+        v[k].push_back(dry ? dflt : value(gen));
+        w[k].push_back(wt[k]);
+      }
+    }
+  }
+
+  const size_t n = v[0].size();
+  std::vector<double> result(n);
+  StationInterpolation::interpolateDryValues(
+      {v[0].data(), v[1].data(), v[2].data()},
+      {w[0].data(), w[1].data(), w[2].data()}, n, dflt, result.data());
+
+  for (size_t i = 0; i < n; ++i) {
+    const double expected = StationInterpolation::interpolateDryValues(
+        v[0][i], w[0][i], v[1][i], w[1][i], v[2][i], w[2][i], dflt);
+    if (std::memcmp(&expected, &result[i], sizeof(double)) != 0) {
+      std::cout << "Mismatch at point " << i << " with dry pattern "
+                << i / nPerPattern << ": " << result[i] << " vs " << expected
+                << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//...Runs the interpolation and compares every sample written to the output
+// file with the per-station interpolation of the same global record
+static bool checkRun(const StationInterpolationOptions &options,
+                     const std::string &meshFile) {
+  StationInterpolation interp(options);
+  interp.run();
+
+  Adcirc::Geometry::Mesh mesh(meshFile);
+  mesh.read();
+  mesh.buildElementalSearchTree();
+
+  StationInterpolationOptions o(options);
+  Adcirc::Output::Hmdf *stations = o.stations();
+  std::vector<StationInterpolation::Weight> weights(stations->nstations());
+  size_t numOutside = 0;
+  for (size_t j = 0; j < stations->nstations(); ++j) {
+    std::vector<double> wt;
+    size_t e = mesh.findElement(stations->station(j)->longitude(),
+                                stations->station(j)->latitude(), wt);
+    if (e == Adcirc::Geometry::Mesh::ELEMENT_NOT_FOUND) {
+      numOutside++;
+      continue;
+    }
+    weights[j].found = true;
+    for (size_t k = 0; k < 3; ++k) {
+      weights[j].node_index[k] =
+          mesh.nodeIndexById(mesh.element(e)->node(k)->id());
+      weights[j].weight[k] = wt[k];
+    }
+  }
+  if (numOutside == 0 || numOutside == stations->nstations()) {
+    std::cout << "Stations do not cover both sides of the mesh boundary"
+              << std::endl;
+    return false;
+  }
+
+  StationInterpolation reference(options);
+  ReadOutput global(options.globalfile());
+  global.open();
+  const double dflt = global.defaultValue();
+  const bool writeVector = global.metadata()->isVector() &&
+                           !options.magnitude() && !options.direction();
+
+  ReadOutput out(options.outputfile());
+  out.open();
+  const size_t nsnap = options.endsnap() - options.startsnap() + 1;
+  if (out.numSnaps() != nsnap || out.numNodes() != stations->nstations() ||
+      out.metadata()->isVector() != writeVector) {
+    std::cout << "Output file " << options.outputfile()
+              << " has the wrong shape" << std::endl;
+    return false;
+  }
+
+  size_t numWet = 0;
+  for (size_t i = 0; i < nsnap; ++i) {
+    global.read(options.startsnap() - 1 + i);
+    out.read();
+    Adcirc::Output::OutputRecord *g = global.dataAt(0);
+    Adcirc::Output::OutputRecord *r = out.dataAt(0);
+    if (std::abs(r->time() - g->time()) > 1e-6) {
+      std::cout << "Wrong time in snap " << i << std::endl;
+      return false;
+    }
+
+    for (size_t j = 0; j < stations->nstations(); ++j) {
+      std::array<double, 2> expected = {dflt, dflt};
+      if (weights[j].found) {
+        const auto &w = weights[j];
+        if (writeVector) {
+          expected[0] = StationInterpolation::interpolateDryValues(
+              g->u(w.node_index[0]), w.weight[0], g->u(w.node_index[1]),
+              w.weight[1], g->u(w.node_index[2]), w.weight[2], dflt);
+          expected[1] = StationInterpolation::interpolateDryValues(
+              g->v(w.node_index[0]), w.weight[0], g->v(w.node_index[1]),
+              w.weight[1], g->v(w.node_index[2]), w.weight[2], dflt);
+        } else if (options.hasPositiveDirection()) {
+          expected[0] = reference.interpScalar(
+              global, weights[j], stations->station(j)->positiveDirection());
+        } else {
+          expected[0] = reference.interpScalar(global, weights[j]);
+        }
+      }
+
+      const size_t dim = writeVector ? 2 : 1;
+      for (size_t k = 0; k < dim; ++k) {
+        const double v = writeVector ? (k == 0 ? r->u(j) : r->v(j)) : r->z(j);
+        if (std::abs(v - expected[k]) >
+            1e-9 * std::max(1.0, std::abs(expected[k]))) {
+          std::cout << options.outputfile() << ": mismatch at snap " << i
+                    << ", station " << j << ": " << v << " vs "
+                    << expected[k] << std::endl;
+          return false;
+        }
+        if (expected[k] != dflt) numWet++;
+      }
+    }
+    global.clearAt(0);
+    out.clearAt(0);
+  }
+
+  if (numWet == 0) {
+    std::cout << options.outputfile() << " has no wet values" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//...Checks that an exception raised in either half of the double buffered
+// loop reaches the caller
+static bool checkThrows(const StationInterpolationOptions &options,
+                        const std::string &message) {
+  try {
+    StationInterpolation interp(options);
+    interp.run();
+  } catch (const std::exception &e) {
+    if (std::string(e.what()).find(message) != std::string::npos) {
+      return true;
+    }
+    std::cout << "Unexpected error: " << e.what() << std::endl;
+    return false;
+  }
+  std::cout << "Expected error: " << message << std::endl;
+  return false;
+}
+
+int main() {
+  if (!checkVectorizedDryValues()) return 1;
+
+  //...The test locations plus one station far outside the mesh
+  const std::string stationFile = "test_files/testwrite_stations.txt";
+  {
+    std::ifstream in("test_scripts/locations.txt");
+    std::string line;
+    std::getline(in, line);
+    std::ofstream station(stationFile);
+    station << std::stoul(line) + 1 << "\n";
+    while (std::getline(in, line)) station << line << "\n";
+    station << "1000000.0 1000000.0\n";
+  }
+
+  StationInterpolationOptions scalar;
+  scalar.setMesh("test_files/internal_overflow.grd");
+  scalar.setGlobalfile("test_files/fort.63");
+  scalar.readStations(stationFile);
+  scalar.setStartsnap(1);
+  {
+    ReadOutput g(scalar.globalfile());
+    g.open();
+    scalar.setEndsnap(g.numSnaps());
+  }
+
+  scalar.setOutputfile("test_files/testwrite_interp_wse.61");
+  if (!checkRun(scalar, scalar.mesh())) return 1;
+
+  //...Treat the water levels as angles in degrees
+  StationInterpolationOptions angle(scalar);
+  angle.setAngle(true);
+  angle.setOutputfile("test_files/testwrite_interp_angle.61");
+  if (!checkRun(angle, scalar.mesh())) return 1;
+
+  StationInterpolationOptions vector;
+  vector.setGlobalfile("test_files/fort.64.nc");
+  vector.readStations(stationFile);
+  {
+    ReadOutput g(vector.globalfile());
+    g.open();
+    vector.setStartsnap(2);
+    vector.setEndsnap(g.numSnaps());
+  }
+
+  vector.setOutputfile("test_files/testwrite_interp_vel.62");
+  if (!checkRun(vector, vector.globalfile())) return 1;
+
+  StationInterpolationOptions magnitude(vector);
+  magnitude.setMagnitude(true);
+  magnitude.setOutputfile("test_files/testwrite_interp_mag.61");
+  if (!checkRun(magnitude, vector.globalfile())) return 1;
+
+  StationInterpolationOptions signedMagnitude(magnitude);
+  for (size_t i = 0; i < signedMagnitude.stations()->nstations(); ++i) {
+    signedMagnitude.setPositiveDirection(
+        i, 25.0 * static_cast<double>(i) - 180.0);
+  }
+  signedMagnitude.usePositiveDirection(true);
+  signedMagnitude.setOutputfile("test_files/testwrite_interp_magdir.61");
+  if (!checkRun(signedMagnitude, vector.globalfile())) return 1;
+
+  StationInterpolationOptions direction(vector);
+  direction.setDirection(true);
+  direction.setOutputfile("test_files/testwrite_interp_dir.61");
+  if (!checkRun(direction, vector.globalfile())) return 1;
+
+  //...Errors from the interpolation and from reading the next snap
+  StationInterpolationOptions badAngle(direction);
+  badAngle.setAngle(true);
+  if (!checkThrows(badAngle, "scalar angle was expected")) return 1;
+
+  StationInterpolationOptions pastEnd(scalar);
+  pastEnd.setEndsnap(scalar.endsnap() + 1);
+  if (!checkThrows(pastEnd, "Error reading ascii record")) return 1;
+
+  for (const char *f :
+       {"testwrite_stations.txt", "testwrite_interp_wse.61",
+        "testwrite_interp_angle.61", "testwrite_interp_vel.62",
+        "testwrite_interp_mag.61", "testwrite_interp_magdir.61",
+        "testwrite_interp_dir.61"}) {
+    std::remove((std::string("test_files/") + f).c_str());
+  }
+
+  std::cout << "Station interpolation matches the per-station form"
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,173 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "StringConversion.h"
+
+using Adcirc::StringConversion;
+
+//...Parses a token followed by a terminator and checks that the value and
+// the number of characters consumed match strtod bit for bit. An empty
+// terminator places the token at the end of the buffer
+static bool check(const std::string &token, const std::string &terminator) {
+  const std::string buffer = "  " + token + terminator;
+  const char *p = buffer.data();
+  const char *end = buffer.data() + buffer.size();
+  double value = 0.0;
+  const bool ok = StringConversion::parseDouble(p, end, value);
+
+  char *next = nullptr;
+  const double expected = std::strtod(token.c_str(), &next);
+  const size_t consumed = static_cast<size_t>(next - token.c_str());
+
+  if (consumed == 0) {
+    if (ok) {
+      std::cout << "Parsed \"" << token << "\" which strtod rejects"
+                << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  uint64_t a, b;
+  std::memcpy(&a, &value, sizeof(double));
+  std::memcpy(&b, &expected, sizeof(double));
+  if (!ok || a != b || p != buffer.data() + 2 + consumed) {
+    std::cout << "Mismatch for \"" << token << "\" followed by "
+              << static_cast<int>(terminator.empty() ? 0 : terminator[0])
+              << ": " << value << " vs " << expected << std::endl;
+    return false;
+  }
+  return true;
+}
+
+static bool checkAllTerminators(const std::string &token) {
+  for (const char *t : {"", " ", ",", "\r\n", "\t"}) {
+    if (!check(token, t)) return false;
+  }
+  return true;
+}
+
+static std::string randomToken(std::mt19937_64 &gen) {
+  std::uniform_int_distribution<int> digit(0, 9);
+  std::uniform_int_distribution<int> numDigits(1, 24);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_int_distribution<int> smallExponent(-30, 30);
+  std::uniform_int_distribution<int> largeExponent(-340, 340);
+
+  std::string t;
+  const int sign = percent(gen);
+  if (sign < 30) t += '-';
+  if (sign >= 90) t += '+';
+  if (percent(gen) < 20) t += std::string(percent(gen) % 4 + 1, '0');
+
+  const int n = numDigits(gen);
+  std::string digits;
+  for (int i = 0; i < n; ++i) {
+    digits += static_cast<char>('0' + digit(gen));
+  }
+  if (percent(gen) < 80) {
+    digits.insert(static_cast<size_t>(percent(gen) % (n + 1)), ".");
+  }
+  t += digits;
+
+  const int e = percent(gen);
+  if (e < 40) {
+    t += (e % 2 ? 'e' : 'E') + std::to_string(smallExponent(gen));
+  } else if (e < 50) {
+    t += "e" + std::to_string(largeExponent(gen));
+  }
+  return t;
+}
+
+int main() {
+  const std::vector<std::string> cases = {
+      "0", "-0", "0.0", "+3.25", ".5", "5.", "1", "0.1",
+      "0.30000000000000004", "8.22651718E-001", "123.456E+002",
+      //...19 and 20 significant digits
+      "1234567890123456789", "12345678901234567890", "0.1234567890123456789",
+      "0.12345678901234567890",
+      //...Mantissa at and above 2^53
+      "9007199254740992", "9007199254740993", "9007199254740993.0",
+      "18446744073709551615", "18446744073709551616",
+      //...Exponents at and beyond the exact powers of ten
+      "1e22", "1e23", "1.5e-22", "1.5e-23", "123e20", "123e-25", "1e308",
+      "1e309", "4.9e-324", "2.2250738585072014e-308",
+      "1.7976931348623157e308",
+      //...Leading zeros
+      "00012.5", "0000000000000000001.5", "0.0000000000000000000001",
+      "000000000000000000000000000001",
+      //...Incomplete exponents and trailing text
+      "1.5e", "1.5e+", "1.5e-x", "2.5abc", "0x10",
+      //...Values strtod handles on the slow path or rejects
+      "nan", "-nan", "NaN", "inf", "-inf", "infinity", "-", ".", "+", "abc",
+      "e5"};
+  for (const auto &c : cases) {
+    if (!checkAllTerminators(c)) return 1;
+  }
+
+  std::mt19937_64 gen(53);
+  for (size_t i = 0; i < 500000; ++i) {
+    if (!checkAllTerminators(randomToken(gen))) return 1;
+  }
+
+  //...Consecutive values on one line and an empty remainder
+  const std::string line = "  1.5, -2.25\t3e2\r\n";
+  const char *p = line.data();
+  const char *end = line.data() + line.size();
+  std::vector<double> values;
+  double v;
+  while (StringConversion::parseDouble(p, end, v)) {
+    values.push_back(v);
+    if (p < end && *p == ',') ++p;
+  }
+  if (values != std::vector<double>{1.5, -2.25, 300.0} || p != end) {
+    std::cout << "Consecutive values were not parsed" << std::endl;
+    return 1;
+  }
+
+  //...Unsigned integers
+  const std::string ints = "  42 +7 18446744073709551615";
+  p = ints.data();
+  end = ints.data() + ints.size();
+  size_t a, b, c;
+  if (!StringConversion::parseSizet(p, end, a) ||
+      !StringConversion::parseSizet(p, end, b) ||
+      !StringConversion::parseSizet(p, end, c) || a != 42 || b != 7 ||
+      c != 18446744073709551615ULL || p != end ||
+      StringConversion::parseSizet(p, end, a)) {
+    std::cout << "Unsigned integers were not parsed" << std::endl;
+    return 1;
+  }
+  const std::string bad = " x1";
+  p = bad.data();
+  if (StringConversion::parseSizet(p, bad.data() + bad.size(), a)) {
+    std::cout << "Invalid unsigned integer was accepted" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Number parsing matches strtod" << std::endl;
+  return 0;
+}
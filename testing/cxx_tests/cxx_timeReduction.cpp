@@ -0,0 +1,159 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AdcircModules.h"
+
+int main() {
+  using namespace Adcirc::Output;
+
+  //...Reduce the file in a single streaming pass
+  std::unique_ptr<ReadOutput> output(new ReadOutput("test_files/fort.63"));
+  output->open();
+  const size_t numNodes = output->numNodes();
+  const double dflt = output->defaultValue();
+
+  TimeReduction reduction(numNodes);
+  reduction.setDefaultValue(dflt);
+  size_t imax = reduction.addReduction(ReduceMaximum);
+  size_t imin = reduction.addReduction(ReduceMinimum);
+  size_t imean = reduction.addReduction(ReduceMean);
+  size_t itmax = reduction.addReduction(ReduceTimeOfMaximum);
+  size_t itmin = reduction.addReduction(ReduceTimeOfMinimum);
+  size_t idur = reduction.addReduction(ReduceDurationAbove, 0.0);
+  reduction.update(output.get());
+  output->close();
+
+  //...Compute the same quantities by holding every snap in memory
+  std::unique_ptr<ReadOutput> check(new ReadOutput("test_files/fort.63"));
+  check->open();
+  std::vector<double> zmax(numNodes, dflt), tmax(numNodes, dflt);
+  std::vector<double> zmin(numNodes, dflt), tmin(numNodes, dflt);
+  std::vector<double> sum(numNodes, 0.0), count(numNodes, 0.0);
+  std::vector<double> duration(numNodes, 0.0);
+  double lastTime = 0.0;
+  for (size_t s = 0; s < check->numSnaps(); ++s) {
+    check->read();
+    OutputRecord *r = check->dataAt(s);
+    double dt = s == 0 ? 0.0 : r->time() - lastTime;
+    lastTime = r->time();
+    for (size_t i = 0; i < numNodes; ++i) {
+      double z = r->z(i);
+      if (z == dflt) continue;
+      if (zmax[i] == dflt || z > zmax[i]) {
+        zmax[i] = z;
+        tmax[i] = r->time();
+      }
+      if (zmin[i] == dflt || z < zmin[i]) {
+        zmin[i] = z;
+        tmin[i] = r->time();
+      }
+      sum[i] += z;
+      count[i] += 1.0;
+      if (z > 0.0) duration[i] += dt;
+    }
+  }
+  check->close();
+
+  if (reduction.numSnaps() != check->numSnaps()) {
+    std::cout << "Wrong number of snaps reduced" << std::endl;
+    return 1;
+  }
+
+  std::vector<double> vmax = reduction.values(imax);
+  std::vector<double> vmin = reduction.values(imin);
+  std::vector<double> vmean = reduction.values(imean);
+  std::vector<double> vtmax = reduction.values(itmax);
+  std::vector<double> vtmin = reduction.values(itmin);
+  std::vector<double> vdur = reduction.values(idur);
+  for (size_t i = 0; i < numNodes; ++i) {
+    double mean = count[i] > 0.0 ? sum[i] / count[i] : dflt;
+    if (vmax[i] != zmax[i] || vtmax[i] != tmax[i] || vmin[i] != zmin[i] ||
+        vtmin[i] != tmin[i] ||
+        std::abs(vmean[i] - mean) > 1e-9 ||
+        std::abs(vdur[i] - duration[i]) > 1e-6) {
+      std::cout << "Mismatch at node " << i << ": " << vmax[i] << " "
+                << zmax[i] << " " << vtmax[i] << " " << tmax[i] << " "
+                << vmin[i] << " " << zmin[i] << " " << vtmin[i] << " "
+                << tmin[i] << " " << vmean[i] << " " << mean << " " << vdur[i]
+                << " " << duration[i] << std::endl;
+      return 1;
+    }
+  }
+
+  OutputRecord record = reduction.result(imax);
+  if (record.numNodes() != numNodes || record.z(10) != vmax[10] ||
+      record.time() != lastTime) {
+    std::cout << "Result record does not match the reduction" << std::endl;
+    return 1;
+  }
+
+  //...Vector records are reduced using the magnitude
+  std::unique_ptr<ReadOutput> vel(new ReadOutput("test_files/fort.64.nc"));
+  vel->open();
+  const size_t numVelNodes = vel->numNodes();
+  const double vdflt = vel->defaultValue();
+  TimeReduction velReduction(numVelNodes);
+  velReduction.setDefaultValue(vdflt);
+  size_t iumax = velReduction.addReduction(ReduceMaximum);
+  size_t iumin = velReduction.addReduction(ReduceMinimum);
+  size_t iutmax = velReduction.addReduction(ReduceTimeOfMaximum);
+
+  std::vector<double> umax(numVelNodes, vdflt), umin(numVelNodes, vdflt);
+  std::vector<double> utmax(numVelNodes, vdflt);
+  for (size_t s = 0; s < vel->numSnaps(); ++s) {
+    vel->read();
+    OutputRecord *r = vel->dataAt(s);
+    velReduction.update(r);
+    for (size_t i = 0; i < numVelNodes; ++i) {
+      if (r->u(i) == vdflt || r->v(i) == vdflt) continue;
+      double m = std::hypot(r->u(i), r->v(i));
+      if (umax[i] == vdflt || m > umax[i]) {
+        umax[i] = m;
+        utmax[i] = r->time();
+      }
+      if (umin[i] == vdflt || m < umin[i]) umin[i] = m;
+    }
+  }
+  vel->close();
+
+  std::vector<double> vumax = velReduction.values(iumax);
+  std::vector<double> vumin = velReduction.values(iumin);
+  std::vector<double> vutmax = velReduction.values(iutmax);
+  size_t numWet = 0;
+  for (size_t i = 0; i < numVelNodes; ++i) {
+    if (vumax[i] != umax[i] || vumin[i] != umin[i] || vutmax[i] != utmax[i]) {
+      std::cout << "Magnitude mismatch at node " << i << ": " << vumax[i]
+                << " " << umax[i] << " " << vumin[i] << " " << umin[i] << " "
+                << vutmax[i] << " " << utmax[i] << std::endl;
+      return 1;
+    }
+    if (umax[i] != vdflt && umax[i] > umin[i]) ++numWet;
+  }
+  if (numWet == 0) {
+    std::cout << "No velocity varies over time" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Time reductions match the reference values" << std::endl;
+  return 0;
+}
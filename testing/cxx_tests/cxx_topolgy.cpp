@@ -62,6 +62,35 @@ int main() {
       return 1;
   }
 
+  //...Replacing an element without changing the element count must not
+  // leave the previous edge table in use
+  EdgeTable *edges = mesh->topology()->edgeTable();
+  const size_t numEdges = edges->numEdges();
+  Element *e1 = mesh->element(1);
+  Element replacement(mesh->element(0)->id(), e1->node(0), e1->node(1),
+                      e1->node(2));
+  mesh->addElement(0, replacement);
+  if (edges->initialized()) {
+    std::cout << "Edge table was not invalidated" << std::endl;
+    return 1;
+  }
+
+  edges = mesh->topology()->edgeTable();
+  bool found = false;
+  for (size_t i = 0; i < edges->numEdges() && !found; ++i) {
+    const auto n = edges->nodes(i);
+    const bool match = (n.first == e1->node(0) && n.second == e1->node(1)) ||
+                       (n.first == e1->node(1) && n.second == e1->node(0));
+    if (!match) continue;
+    const auto el = edges->elements(i);
+    found = el.first == mesh->element(0) || el.second == mesh->element(0);
+  }
+  if (!found || edges->numEdges() == 0 || numEdges == 0) {
+    std::cout << "Edge table was not rebuilt after the element changed"
+              << std::endl;
+    return 1;
+  }
+
 
   return 0;
 }
@@ -16,11 +16,14 @@
 // You should have received a copy of the GNU General Public License
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
 #include <vector>
 
 #include "AdcircModules.h"
+#include "gdal_priv.h"
 
 int main() {
   using namespace Adcirc::Geometry;
@@ -36,5 +39,97 @@ int main() {
   // output->read();
   // mesh->toRaster("adcirc_wse.img",output->data(0)->values(),mesh->extent(),0.001,-99999.0);
 
+  //...A GeoTIFF is written in 256x256 blocks. At this resolution the raster
+  // spans several blocks in both directions and each pixel must match the
+  // value found by a serial element search
+  const double resolution = 0.0005;
+  const double nullvalue = -9999.0;
+  const std::vector<double> extent = mesh->extent();
+  mesh->toRaster("test_files/testwrite_blocks.tif", mesh->z(), extent,
+                 resolution, nullvalue);
+
+  GDALAllRegister();
+  GDALDataset *raster = static_cast<GDALDataset *>(
+      GDALOpen("test_files/testwrite_blocks.tif", GA_ReadOnly));
+  const int nx = raster->GetRasterXSize();
+  const int ny = raster->GetRasterYSize();
+  int bx, by;
+  raster->GetRasterBand(1)->GetBlockSize(&bx, &by);
+  if (nx <= bx || ny <= by) {
+    std::cout << "Raster does not span multiple blocks" << std::endl;
+    return 1;
+  }
+  std::vector<float> pixels(static_cast<size_t>(nx) * ny);
+  raster->GetRasterBand(1)->RasterIO(GF_Read, 0, 0, nx, ny, pixels.data(), nx,
+                                     ny, GDT_Float32, 0, 0);
+  GDALClose(static_cast<GDALDatasetH>(raster));
+
+  const double xmin = std::min(extent[0], extent[2]);
+  const double ymax = std::max(extent[1], extent[3]);
+  size_t nvalid = 0;
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const double x = xmin + (i + 0.5) * resolution;
+      const double y = ymax - (j + 0.5) * resolution;
+      std::vector<double> w(3);
+      const size_t e = mesh->findElement(x, y, w);
+      double expected = nullvalue;
+      if (e < mesh->numElements()) {
+        const Element *el = mesh->element(e);
+        expected = 0.0;
+        for (size_t k = 0; k < 3; ++k) {
+          expected += w[k] * el->node(k)->z();
+        }
+        nvalid++;
+      }
+      const float actual = pixels[static_cast<size_t>(j) * nx + i];
+      if (std::abs(actual - expected) > 1e-4) {
+        std::cout << "Pixel " << i << ", " << j << " differs: " << actual
+                  << " vs " << expected << std::endl;
+        return 1;
+      }
+    }
+  }
+  if (nvalid == 0) {
+    std::cout << "No pixels were inside the mesh" << std::endl;
+    return 1;
+  }
+
+  //...A rasterization plan written with dry and null nodes must match the
+  // mesh rasterizer with and without partial wetting
+  std::vector<double> zdry = mesh->z();
+  for (size_t i = 0; i < zdry.size(); ++i) {
+    if (i % 3 == 0) zdry[i] = nullvalue;
+    if (i % 5 == 0) zdry[i] = adcircmodules_default_value<double>();
+  }
+  Adcirc::Utility::RasterizationPlan plan(mesh.get(), extent, resolution);
+  for (const bool partialWetting : {true, false}) {
+    //...Without partial wetting dry nodes are expected to hold the null value
+    if (!partialWetting) {
+      std::replace(zdry.begin(), zdry.end(),
+                   adcircmodules_default_value<double>(), nullvalue);
+    }
+    mesh->toRaster("test_files/testwrite_mesh.tif", zdry, extent, resolution,
+                   nullvalue, "none", "none", partialWetting);
+    plan.toRaster("test_files/testwrite_plan.tif", zdry, nullvalue, "none",
+                  "none", partialWetting);
+    std::vector<float> a(pixels.size()), b(pixels.size());
+    for (auto f : {std::make_pair("test_files/testwrite_mesh.tif", &a),
+                   std::make_pair("test_files/testwrite_plan.tif", &b)}) {
+      GDALDataset *ds =
+          static_cast<GDALDataset *>(GDALOpen(f.first, GA_ReadOnly));
+      ds->GetRasterBand(1)->RasterIO(GF_Read, 0, 0, nx, ny, f.second->data(),
+                                     nx, ny, GDT_Float32, 0, 0);
+      GDALClose(static_cast<GDALDatasetH>(ds));
+    }
+    for (size_t k = 0; k < a.size(); ++k) {
+      if (std::abs(a[k] - b[k]) > 1e-4 * std::max(1.0f, std::abs(a[k]))) {
+        std::cout << "Plan differs from mesh raster at " << k << ": " << b[k]
+                  << " vs " << a[k] << std::endl;
+        return 1;
+      }
+    }
+  }
+
   return 0;
 }
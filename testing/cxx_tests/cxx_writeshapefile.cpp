@@ -16,10 +16,49 @@
 // You should have received a copy of the GNU General Public License
 // along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
 //------------------------------------------------------------------------//
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "AdcircModules.h"
+#include "FeatureTable.h"
+#include "ShapefileWriter.h"
+
+std::vector<unsigned char> readFile(const std::string &filename) {
+  std::ifstream f(filename, std::ios::binary);
+  return std::vector<unsigned char>(std::istreambuf_iterator<char>(f),
+                                    std::istreambuf_iterator<char>());
+}
+
+int32_t int32BE(const std::vector<unsigned char> &b, size_t p) {
+  return static_cast<int32_t>(
+      (static_cast<uint32_t>(b[p]) << 24) |
+      (static_cast<uint32_t>(b[p + 1]) << 16) |
+      (static_cast<uint32_t>(b[p + 2]) << 8) | static_cast<uint32_t>(b[p + 3]));
+}
+
+int32_t int32LE(const std::vector<unsigned char> &b, size_t p) {
+  return static_cast<int32_t>(
+      (static_cast<uint32_t>(b[p + 3]) << 24) |
+      (static_cast<uint32_t>(b[p + 2]) << 16) |
+      (static_cast<uint32_t>(b[p + 1]) << 8) | static_cast<uint32_t>(b[p]));
+}
+
+double doubleLE(const std::vector<unsigned char> &b, size_t p) {
+  uint64_t u = 0;
+  for (size_t i = 0; i < 8; ++i) {
+    u |= static_cast<uint64_t>(b[p + i]) << (8 * i);
+  }
+  double d;
+  std::memcpy(&d, &u, sizeof(d));
+  return d;
+}
 
 int main() {
   using namespace Adcirc::Geometry;
@@ -30,5 +69,84 @@ int main() {
   mesh->toElementShapefile("test_files/ms-riv-elements.shp");
   mesh->toBoundaryShapefile("test_files/ms-riv-boundaries.shp");
   mesh->toBoundaryLineShapefile("test_files/ms-riv-boundarylines.shp");
+  mesh->toVectorFile("test_files/ms-riv-elements-vector.shp",
+                     FeatureElements);
+
+  //...Read the element shapefile back and check the record count, the
+  // first polygon and its element id attribute
+  const auto shp = readFile("test_files/ms-riv-elements-vector.shp");
+  const auto shx = readFile("test_files/ms-riv-elements-vector.shx");
+  const auto dbf = readFile("test_files/ms-riv-elements-vector.dbf");
+  const size_t ne = mesh->numElements();
+
+  if (shp.size() < 100 || shx.size() != 100 + 8 * ne ||
+      static_cast<size_t>(int32BE(shp, 24)) * 2 != shp.size() ||
+      int32LE(shp, 32) != 5) {
+    std::cout << "Invalid .shp/.shx header" << std::endl;
+    return 1;
+  }
+
+  const size_t r0 = static_cast<size_t>(int32BE(shx, 100)) * 2 + 8;
+  const Element *e0 = mesh->element(0);
+  if (int32LE(shp, r0) != 5 || int32LE(shp, r0 + 36) != 1 ||
+      int32LE(shp, r0 + 40) != static_cast<int32_t>(e0->n() + 1)) {
+    std::cout << "Invalid first polygon record" << std::endl;
+    return 1;
+  }
+  const size_t np = e0->n() + 1;
+  const double x0 = doubleLE(shp, r0 + 48);
+  const double y0 = doubleLE(shp, r0 + 56);
+  const double xn = doubleLE(shp, r0 + 48 + 16 * (np - 1));
+  const double yn = doubleLE(shp, r0 + 56 + 16 * (np - 1));
+  bool vertexFound = false;
+  for (size_t k = 0; k < e0->n(); ++k) {
+    if (e0->node(k)->x() == x0 && e0->node(k)->y() == y0) vertexFound = true;
+  }
+  if (!vertexFound || x0 != xn || y0 != yn) {
+    std::cout << "First polygon does not match element 1" << std::endl;
+    return 1;
+  }
+
+  const size_t headerLength = dbf[8] | (dbf[9] << 8);
+  const size_t recordLength = dbf[10] | (dbf[11] << 8);
+  if (static_cast<size_t>(int32LE(dbf, 4)) != ne ||
+      dbf.size() != headerLength + recordLength * ne + 1) {
+    std::cout << "Invalid .dbf record count" << std::endl;
+    return 1;
+  }
+  const std::string elementId(
+      reinterpret_cast<const char *>(dbf.data()) + headerLength + 1, 16);
+  if (std::stoull(elementId) != e0->id()) {
+    std::cout << "Invalid element id attribute: " << elementId << std::endl;
+    return 1;
+  }
+
+  //...Values wider than their field are written as the overflow marker and
+  // the header carries the current date
+  Adcirc::FileIO::FeatureTable table(
+      Adcirc::FileIO::FeatureTable::FeaturePoint, false);
+  const size_t field = table.addField(
+      "value", Adcirc::FileIO::FeatureTable::FieldInteger, 4);
+  table.allocate(2, 1);
+  table.setVertex(0, 0.0, 0.0);
+  table.setVertex(1, 1.0, 1.0);
+  table.setInteger(field, 0, 12);
+  table.setInteger(field, 1, 123456);
+  Adcirc::FileIO::ShapefileWriter("test_files/testwrite_overflow.shp")
+      .write(table);
+  const auto odbf = readFile("test_files/testwrite_overflow.dbf");
+  const size_t oh = odbf[8] | (odbf[9] << 8);
+  const std::string v0(reinterpret_cast<const char *>(odbf.data()) + oh + 1,
+                       4);
+  const std::string v1(reinterpret_cast<const char *>(odbf.data()) + oh + 6,
+                       4);
+  const std::time_t now = std::time(nullptr);
+  if (v0 != "  12" || v1 != "****" ||
+      odbf[1] != std::localtime(&now)->tm_year) {
+    std::cout << "Invalid overflow handling: " << v0 << ", " << v1
+              << std::endl;
+    return 1;
+  }
+
   return 0;
 }
@@ -0,0 +1,102 @@
+//------------------------------GPL---------------------------------------//
+// This file is part of ADCIRCModules.
+//
+// (c) 2015-2018 Zachary Cobell
+//
+// ADCIRCModules is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// ADCIRCModules is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with ADCIRCModules.  If not, see <http://www.gnu.org/licenses/>.
+//------------------------------------------------------------------------//
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AdcircModules.h"
+#include "gdal_priv.h"
+#include "ogrsf_frmts.h"
+
+//...Reads a vector file written by Mesh::toVectorFile and checks the
+// feature count, the geometry of the first element and one of its
+// attributes
+static bool checkElements(const std::string &filename,
+                          Adcirc::Geometry::Mesh *mesh) {
+  GDALDataset *ds = static_cast<GDALDataset *>(
+      GDALOpenEx(filename.c_str(), GDAL_OF_VECTOR, nullptr, nullptr, nullptr));
+  if (ds == nullptr) {
+    std::cout << "Could not open " << filename << std::endl;
+    return false;
+  }
+
+  OGRLayer *layer = ds->GetLayer(0);
+  const Adcirc::Geometry::Element *e0 = mesh->element(0);
+  bool ok = layer->GetFeatureCount() ==
+            static_cast<GIntBig>(mesh->numElements());
+
+  //...Formats with a spatial index may reorder features, so the first
+  // element is selected by its id
+  const std::string filter = "elementid = " + std::to_string(e0->id());
+  layer->SetAttributeFilter(filter.c_str());
+  layer->ResetReading();
+  OGRFeature *f = layer->GetNextFeature();
+  ok = ok && f != nullptr;
+  if (ok) {
+    ok = f->GetFieldAsInteger64("node1") ==
+         static_cast<GIntBig>(e0->node(0)->id());
+    const OGRGeometry *g = f->GetGeometryRef();
+    ok = ok && g != nullptr &&
+         wkbFlatten(g->getGeometryType()) == wkbPolygon;
+    if (ok) {
+      auto *ring =
+          const_cast<OGRPolygon *>(static_cast<const OGRPolygon *>(g))
+              ->getExteriorRing();
+      ok = ring->getNumPoints() == static_cast<int>(e0->n() + 1);
+      for (size_t k = 0; k < e0->n() && ok; ++k) {
+        bool found = false;
+        for (int v = 0; v < ring->getNumPoints(); ++v) {
+          if (ring->getX(v) == e0->node(k)->x() &&
+              ring->getY(v) == e0->node(k)->y()) {
+            found = true;
+          }
+        }
+        ok = found;
+      }
+    }
+    OGRFeature::DestroyFeature(f);
+  }
+  GDALClose(static_cast<GDALDatasetH>(ds));
+
+  if (!ok) {
+    std::cout << "Invalid element features in " << filename << std::endl;
+  }
+  return ok;
+}
+
+int main() {
+  using namespace Adcirc::Geometry;
+  std::unique_ptr<Mesh> mesh(new Mesh("test_files/ms-riv.grd"));
+  mesh->read();
+  mesh->defineProjection(4326, true);
+
+  GDALAllRegister();
+  const std::vector<std::string> files = {
+      "test_files/testwrite_elements.shp", "test_files/testwrite_elements.gpkg",
+      "test_files/testwrite_elements.fgb"};
+  for (const auto &f : files) {
+    std::remove(f.c_str());
+    mesh->toVectorFile(f, FeatureElements);
+    if (!checkElements(f, mesh.get())) return 1;
+  }
+
+  return 0;
+}